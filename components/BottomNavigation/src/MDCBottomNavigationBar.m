@@ -18,6 +18,7 @@
 
 #import <MDFInternationalization/MDFInternationalization.h>
 
+#import "MaterialLocalizedStrings.h"
 #import "MaterialMath.h"
 #import "MaterialShadowElevations.h"
 #import "MaterialShadowLayer.h"
@@ -562,10 +563,8 @@ static NSString *const kOfAnnouncement = @"of";
     [self.inkControllers addObject:controller];
 
     if (self.shouldPretendToBeATabBar) {
-      NSString *key = kMaterialBottomNavigationStringTable
-          [kStr_MaterialBottomNavigationItemCountAccessibilityHint];
-      NSString *itemOfTotalString = NSLocalizedStringFromTableInBundle(
-          key, kMaterialBottomNavigationStringsTableName, [[self class] bundle], kOfString);
+      NSString *itemOfTotalString = [[[self class] stringTable]
+          stringForID:kStr_MaterialBottomNavigationItemCountAccessibilityHint];
       NSString *localizedPosition =
           [NSString localizedStringWithFormat:itemOfTotalString, (i + 1), (int)items.count];
       itemView.button.accessibilityHint = localizedPosition;
@@ -747,6 +746,20 @@ static NSString *const kOfAnnouncement = @"of";
   [self setNeedsLayout];
 }
 
+#pragma mark - Strings
+
++ (MDCLocalizedStringTable *)stringTable {
+  static MDCLocalizedStringTable *stringTable;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    stringTable = [MDCLocalizedStringTable tableNamed:kMaterialBottomNavigationStringsTableName
+                                             inBundle:[self bundle]
+                                                 keys:kMaterialBottomNavigationStringTable
+                                                count:kNumMaterialBottomNavigationStrings];
+  });
+  return stringTable;
+}
+
 #pragma mark - Resource bundle
 
 + (NSBundle *)bundle {
@@ -20,6 +20,7 @@
 #import "MDCBottomNavigationItemBadge.h"
 #import "MaterialBottomNavigationStrings.h"
 #import "MaterialBottomNavigationStrings_table.h"
+#import "MaterialLocalizedStrings.h"
 #import "MaterialMath.h"
 
 // A number large enough to be larger than any reasonable screen dimension but small enough that
@@ -44,7 +45,6 @@ static const NSTimeInterval kMDCBottomNavigationItemViewTransitionDuration = 0.1
 
 // The Bundle for string resources.
 static NSString *const kMaterialBottomNavigationBundle = @"MaterialBottomNavigation.bundle";
-static NSString *const kMDCBottomNavigationItemViewTabString = @"tab";
 
 @interface MDCBottomNavigationItemView ()
 
@@ -412,11 +412,8 @@ static NSString *const kMDCBottomNavigationItemViewTabString = @"tab";
   }
 
   if (self.shouldPretendToBeATab) {
-    NSString *key = kMaterialBottomNavigationStringTable
-        [kStr_MaterialBottomNavigationTabElementAccessibilityLabel];
-    NSString *tabString = NSLocalizedStringFromTableInBundle(
-        key, kMaterialBottomNavigationStringsTableName, [[self class] bundle],
-        kMDCBottomNavigationItemViewTabString);
+    NSString *tabString = [[[self class] stringTable]
+        stringForID:kStr_MaterialBottomNavigationTabElementAccessibilityLabel];
     [labelComponents addObject:tabString];
   }
 
@@ -600,6 +597,20 @@ static NSString *const kMDCBottomNavigationItemViewTabString = @"tab";
   self.label.numberOfLines = [self renderedTitleNumberOfLines];
 }
 
+#pragma mark - Strings
+
++ (MDCLocalizedStringTable *)stringTable {
+  static MDCLocalizedStringTable *stringTable;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    stringTable = [MDCLocalizedStringTable tableNamed:kMaterialBottomNavigationStringsTableName
+                                             inBundle:[self bundle]
+                                                 keys:kMaterialBottomNavigationStringTable
+                                                count:kNumMaterialBottomNavigationStrings];
+  });
+  return stringTable;
+}
+
 #pragma mark - Resource bundle
 
 + (NSBundle *)bundle {
@@ -21,7 +21,7 @@ static NSString *const kMaterialBottomNavigationStringTable[] = {
     @"MaterialBottomNavigationItemCountAccessibilityHint",
     @"MaterialBottomNavigationTabElementAccessibilityLabel",
 };
-#define kNumMaterialBottomNavigationStrings 1
+#define kNumMaterialBottomNavigationStrings 2
 #define kMaterialBottomNavigationStringsOffset 0
 #define kMaterialBottomNavigationStringsEnd 10000
 static NSString *const kMaterialBottomNavigationStringsTableName = @"MaterialBottomNavigation";
@@ -19,11 +19,14 @@
 + (void)applyShapeScheme:(id<MDCShapeScheming>)shapeScheme
     toBottomSheetController:(MDCBottomSheetController *)bottomSheetController {
   // Shape Generator for the Extended state of the Bottom Sheet.
-  MDCRectangleShapeGenerator *rectangleShapePreferred = [[MDCRectangleShapeGenerator alloc] init];
   // For a Bottom Sheet the corner values that can be set are the top corners.
-  rectangleShapePreferred.topLeftCorner = shapeScheme.largeComponentShape.topLeftCorner;
-  rectangleShapePreferred.topRightCorner = shapeScheme.largeComponentShape.topRightCorner;
-  [bottomSheetController setShapeGenerator:rectangleShapePreferred forState:MDCSheetStatePreferred];
+  MDCShapeCategory *shapeCategory = [shapeScheme.largeComponentShape copy];
+  shapeCategory.bottomLeftCorner = [[MDCCornerTreatment alloc] init];
+  shapeCategory.bottomRightCorner = [[MDCCornerTreatment alloc] init];
+  MDCImmutableRectangleShapeGenerator *rectangleShapePreferred =
+      [MDCImmutableRectangleShapeGenerator shapeGeneratorForShapeCategory:shapeCategory];
+  [bottomSheetController setShapeGenerator:[rectangleShapePreferred shapeGeneratorForComponent]
+                                  forState:MDCSheetStatePreferred];
 }
 
 @end
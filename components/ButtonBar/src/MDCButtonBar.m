@@ -19,6 +19,7 @@
 #import "MaterialApplication.h"
 #import "MaterialButtons.h"
 #import "private/MDCAppBarButtonBarBuilder.h"
+#import "private/MDCButtonBar+Private.h"
 
 static const CGFloat kButtonBarMaxHeight = 56;
 static const CGFloat kButtonBarMinHeight = 24;
@@ -29,11 +30,48 @@ static char *const kKVOContextMDCButtonBar = "kKVOContextMDCButtonBar";
 // This is required because @selector(enabled) throws a compiler warning of unrecognized selector.
 static NSString *const kEnabledSelector = @"enabled";
 
+// Items are compared by identity so that equal but distinct items each get their own button view.
+static const NSPointerFunctionsOptions kItemPointerFunctionsOptions =
+    NSPointerFunctionsStrongMemory | NSPointerFunctionsObjectPointerPersonality;
+
+static NSArray<NSString *> *ObservedItemKeyPaths(void) {
+  static NSArray<NSString *> *keyPaths;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    keyPaths = @[
+      NSStringFromSelector(@selector(accessibilityHint)),
+      NSStringFromSelector(@selector(accessibilityIdentifier)),
+      NSStringFromSelector(@selector(accessibilityLabel)),
+      NSStringFromSelector(@selector(accessibilityValue)), kEnabledSelector,
+      NSStringFromSelector(@selector(image)), NSStringFromSelector(@selector(tag)),
+      NSStringFromSelector(@selector(tintColor)), NSStringFromSelector(@selector(title))
+    ];
+  });
+  return keyPaths;
+}
+
+static NSHashTable<UIBarButtonItem *> *ItemSet(NSArray<UIBarButtonItem *> *items) {
+  NSHashTable<UIBarButtonItem *> *itemSet =
+      [NSHashTable hashTableWithOptions:kItemPointerFunctionsOptions];
+  for (UIBarButtonItem *item in items) {
+    [itemSet addObject:item];
+  }
+  return itemSet;
+}
+
 @implementation MDCButtonBar {
   id _buttonItemsLock;
   NSArray<__kindof UIView *> *_buttonViews;
+  // The button view of each item, used to reuse views across reloads.
+  NSMapTable<UIBarButtonItem *, UIView *> *_buttonViewsByItem;
 
   MDCAppBarButtonBarBuilder *_defaultBuilder;
+
+  NSUInteger _createdButtonViewCount;
+  NSUInteger _reusedButtonViewCount;
+  NSUInteger _removedButtonViewCount;
+  NSUInteger _addedItemObserverCount;
+  NSUInteger _removedItemObserverCount;
 }
 
 - (void)dealloc {
@@ -210,7 +248,10 @@ static NSString *const kEnabledSelector = @"enabled";
   }
 }
 
-- (NSArray<UIView *> *)viewsForItems:(NSArray<UIBarButtonItem *> *)barButtonItems {
+// Returns the views for the given items, taking the views of items that already had one out of
+// reusableViews instead of building new ones.
+- (NSArray<UIView *> *)viewsForItems:(NSArray<UIBarButtonItem *> *)barButtonItems
+                        reusingViews:(NSMapTable<UIBarButtonItem *, UIView *> *)reusableViews {
   if (![barButtonItems count]) {
     return nil;
   }
@@ -225,20 +266,44 @@ static NSString *const kEnabledSelector = @"enabled";
         if (idx == [barButtonItems count] - 1) {
           hints |= MDCBarButtonItemLayoutHintsIsLastButton;
         }
-        UIView *view = [self->_defaultBuilder buttonBar:self viewForItem:item layoutHints:hints];
-        if (!view) {
-          return;
+        UIView *view = [reusableViews objectForKey:item];
+        if (view && ![self->_defaultBuilder view:view representsItem:item]) {
+          // The item's custom view changed. The stale view stays in reusableViews so that it is
+          // removed with the other views that were not reused.
+          view = nil;
+        }
+        BOOL needsSizing;
+        if (view) {
+          // A view can only be reused once, even if its item appears more than once.
+          [reusableViews removeObjectForKey:item];
+          needsSizing = [self->_defaultBuilder buttonBar:self
+                                              updateView:view
+                                                 forItem:item
+                                             layoutHints:hints];
+          self->_reusedButtonViewCount += 1;
+        } else {
+          view = [self->_defaultBuilder buttonBar:self viewForItem:item layoutHints:hints];
+          if (!view) {
+            return;
+          }
+          self->_createdButtonViewCount += 1;
+          needsSizing = YES;
         }
 
-        [view sizeToFit];
-        if (item.width > 0) {
-          CGRect frame = view.frame;
-          frame.size.width = item.width;
-          view.frame = frame;
+        if (needsSizing) {
+          [view sizeToFit];
+          if (item.width > 0) {
+            CGRect frame = view.frame;
+            frame.size.width = item.width;
+            view.frame = frame;
+          }
         }
 
-        [self addSubview:view];
+        if (view.superview != self) {
+          [self addSubview:view];
+        }
         [views addObject:view];
+        [self->_buttonViewsByItem setObject:view forKey:item];
       }];
   return views;
 }
@@ -393,32 +458,38 @@ static NSString *const kEnabledSelector = @"enabled";
       return;
     }
 
-    NSArray<NSString *> *keyPaths = @[
-      NSStringFromSelector(@selector(accessibilityHint)),
-      NSStringFromSelector(@selector(accessibilityIdentifier)),
-      NSStringFromSelector(@selector(accessibilityLabel)),
-      NSStringFromSelector(@selector(accessibilityValue)), kEnabledSelector,
-      NSStringFromSelector(@selector(image)), NSStringFromSelector(@selector(tag)),
-      NSStringFromSelector(@selector(tintColor)), NSStringFromSelector(@selector(title))
-    ];
+    NSArray<NSString *> *keyPaths = ObservedItemKeyPaths();
+
+    // Each item is observed once, so only the items that were added or removed need their
+    // observers updated.
+    NSHashTable<UIBarButtonItem *> *oldItems = ItemSet(_items);
+    NSHashTable<UIBarButtonItem *> *newItems = ItemSet(items);
 
     // Remove old observers
-    for (UIBarButtonItem *item in _items) {
+    for (UIBarButtonItem *item in oldItems) {
+      if ([newItems containsObject:item]) {
+        continue;
+      }
       for (NSString *keyPath in keyPaths) {
         [item removeObserver:self forKeyPath:keyPath context:kKVOContextMDCButtonBar];
       }
+      _removedItemObserverCount += [keyPaths count];
     }
 
     _items = [items copy];
 
     // Register new observers
-    for (UIBarButtonItem *item in _items) {
+    for (UIBarButtonItem *item in newItems) {
+      if ([oldItems containsObject:item]) {
+        continue;
+      }
       for (NSString *keyPath in keyPaths) {
         [item addObserver:self
                forKeyPath:keyPath
                   options:NSKeyValueObservingOptionNew
                   context:kKVOContextMDCButtonBar];
       }
+      _addedItemObserverCount += [keyPaths count];
     }
 
     [self reloadButtonViews];
@@ -516,14 +587,51 @@ static NSString *const kEnabledSelector = @"enabled";
 }
 
 - (void)reloadButtonViews {
-  // TODO(featherless): Recycle buttons.
-  for (UIView *view in _buttonViews) {
-    [view removeFromSuperview];
+  NSMapTable<UIBarButtonItem *, UIView *> *reusableViews = _buttonViewsByItem;
+  _buttonViewsByItem = [NSMapTable mapTableWithKeyOptions:kItemPointerFunctionsOptions
+                                             valueOptions:NSPointerFunctionsStrongMemory];
+  _buttonViews = [self viewsForItems:_items reusingViews:reusableViews];
+
+  // Anything left over belongs to an item that is no longer in the bar.
+  for (UIView *view in [reusableViews objectEnumerator]) {
+    if ([_buttonViews indexOfObjectIdenticalTo:view] == NSNotFound) {
+      [view removeFromSuperview];
+      _removedButtonViewCount += 1;
+    }
   }
-  _buttonViews = [self viewsForItems:_items];
 
   [self invalidateIntrinsicContentSize];
   [self setNeedsLayout];
 }
 
+#pragma mark - Recycling
+
+- (NSUInteger)createdButtonViewCount {
+  return _createdButtonViewCount;
+}
+
+- (NSUInteger)reusedButtonViewCount {
+  return _reusedButtonViewCount;
+}
+
+- (NSUInteger)removedButtonViewCount {
+  return _removedButtonViewCount;
+}
+
+- (NSUInteger)addedItemObserverCount {
+  return _addedItemObserverCount;
+}
+
+- (NSUInteger)removedItemObserverCount {
+  return _removedItemObserverCount;
+}
+
+- (void)resetRecyclingCounters {
+  _createdButtonViewCount = 0;
+  _reusedButtonViewCount = 0;
+  _removedButtonViewCount = 0;
+  _addedItemObserverCount = 0;
+  _removedItemObserverCount = 0;
+}
+
 @end
@@ -24,6 +24,26 @@
           viewForItem:(UIBarButtonItem *)barButtonItem
           layoutHints:(MDCBarButtonItemLayoutHints)layoutHints;
 
+/**
+ Returns whether a view previously returned by buttonBar:viewForItem:layoutHints: still represents
+ the given item. It does not once the item's custom view has been replaced or removed, or once an
+ item that was given a button has been given a custom view.
+ */
+- (BOOL)view:(UIView *)view representsItem:(UIBarButtonItem *)barButtonItem;
+
+/**
+ Updates the layout-dependent properties of a view previously returned by
+ buttonBar:viewForItem:layoutHints: so that it can be reused for the given layout hints.
+
+ Properties that mirror the item are kept up to date by the button bar and are not touched.
+
+ @return YES if the view needs to be resized.
+ */
+- (BOOL)buttonBar:(MDCButtonBar *)buttonBar
+       updateView:(UIView *)view
+          forItem:(UIBarButtonItem *)barButtonItem
+      layoutHints:(MDCBarButtonItemLayoutHints)layoutHints;
+
 /** The title color for the bar button items. */
 @property(nonatomic, strong) UIColor *buttonTitleColor;
 
@@ -169,6 +169,42 @@ static const UIEdgeInsets kButtonInset = {0, 12, 0, 12};
   return button;
 }
 
+- (BOOL)view:(UIView *)view representsItem:(UIBarButtonItem *)buttonItem {
+  // A custom view set since the view was built is only picked up once it has been transferred.
+  [self transferCustomViewOwnershipForBarButtonItem:buttonItem];
+  UIView *customView =
+      buttonItem.mdc_customView ? buttonItem.mdc_customView : buttonItem.customView;
+  if (customView) {
+    return view == customView;
+  }
+  return [view isKindOfClass:[MDCButtonBarButton class]];
+}
+
+- (BOOL)buttonBar:(MDCButtonBar *)buttonBar
+       updateView:(UIView *)view
+          forItem:(UIBarButtonItem *)buttonItem
+      layoutHints:(MDCBarButtonItemLayoutHints)layoutHints {
+  // Custom views are owned by their item and are never configured by the builder.
+  if (![view isKindOfClass:[MDCButtonBarButton class]] || view == buttonItem.mdc_customView) {
+    return NO;
+  }
+  MDCButtonBarButton *button = (MDCButtonBarButton *)view;
+
+  // The insets depend on the button's position within the bar, which may have changed.
+  UIEdgeInsets contentInsets = [MDCAppBarButtonBarBuilder
+      contentInsetsForButton:button
+              layoutPosition:buttonBar.layoutPosition
+                 layoutHints:layoutHints
+             layoutDirection:[buttonBar mdf_effectiveUserInterfaceLayoutDirection]
+          userInterfaceIdiom:[self usePadInsetsForButtonBar:buttonBar] ? UIUserInterfaceIdiomPad
+                                                                       : UIUserInterfaceIdiomPhone];
+  if (UIEdgeInsetsEqualToEdgeInsets(button.contentEdgeInsets, contentInsets)) {
+    return NO;
+  }
+  button.contentEdgeInsets = contentInsets;
+  return YES;
+}
+
 #pragma mark - Private
 
 // Used to determine whether or not to apply insets relevant for iPad or use smaller iPhone size
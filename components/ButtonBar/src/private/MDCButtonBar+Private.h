@@ -23,3 +23,29 @@
 - (void)didTapButton:(UIButton *)button event:(UIEvent *)event;
 
 @end
+
+/**
+ Counters describing how much work reloading the button views has done. Used to verify that
+ changes to @c items reuse existing button views.
+ */
+@interface MDCButtonBar (Recycling)
+
+/** The number of button views created by the builder. */
+@property(nonatomic, readonly) NSUInteger createdButtonViewCount;
+
+/** The number of existing button views reused for an item after a reload. */
+@property(nonatomic, readonly) NSUInteger reusedButtonViewCount;
+
+/** The number of button views removed because their item was removed. */
+@property(nonatomic, readonly) NSUInteger removedButtonViewCount;
+
+/** The number of key-value observers added to items. */
+@property(nonatomic, readonly) NSUInteger addedItemObserverCount;
+
+/** The number of key-value observers removed from items. */
+@property(nonatomic, readonly) NSUInteger removedItemObserverCount;
+
+/** Resets all of the counters to zero. */
+- (void)resetRecyclingCounters;
+
+@end
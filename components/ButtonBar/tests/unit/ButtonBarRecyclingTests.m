@@ -0,0 +1,167 @@
+// Copyright 2015-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#import <XCTest/XCTest.h>
+
+#import "MDCButtonBar+Private.h"
+#import "MaterialButtonBar.h"
+
+@interface ButtonBarRecyclingTests : XCTestCase
+@property(nonatomic, strong) MDCButtonBar *buttonBar;
+@property(nonatomic, strong) UIBarButtonItem *firstItem;
+@property(nonatomic, strong) UIBarButtonItem *secondItem;
+@property(nonatomic, strong) UIBarButtonItem *thirdItem;
+@end
+
+@implementation ButtonBarRecyclingTests
+
+- (void)setUp {
+  [super setUp];
+
+  self.buttonBar = [[MDCButtonBar alloc] init];
+  self.firstItem = [[UIBarButtonItem alloc] initWithTitle:@"First"
+                                                    style:UIBarButtonItemStylePlain
+                                                   target:nil
+                                                   action:nil];
+  self.secondItem = [[UIBarButtonItem alloc] initWithTitle:@"Second"
+                                                     style:UIBarButtonItemStylePlain
+                                                    target:nil
+                                                    action:nil];
+  self.thirdItem = [[UIBarButtonItem alloc] initWithTitle:@"Third"
+                                                    style:UIBarButtonItemStylePlain
+                                                   target:nil
+                                                   action:nil];
+}
+
+- (void)tearDown {
+  self.buttonBar = nil;
+  self.firstItem = nil;
+  self.secondItem = nil;
+  self.thirdItem = nil;
+
+  [super tearDown];
+}
+
+- (void)testSwappingToTheSameItemsReusesEveryButtonView {
+  // Given
+  self.buttonBar.items = @[ self.firstItem, self.secondItem ];
+  NSArray<UIView *> *originalSubviews = [self.buttonBar.subviews copy];
+  [self.buttonBar resetRecyclingCounters];
+
+  // When
+  self.buttonBar.items = @[ self.secondItem, self.firstItem ];
+  self.buttonBar.items = @[ self.firstItem, self.secondItem ];
+
+  // Then
+  XCTAssertEqual(self.buttonBar.createdButtonViewCount, 0U);
+  XCTAssertEqual(self.buttonBar.reusedButtonViewCount, 4U);
+  XCTAssertEqual(self.buttonBar.removedButtonViewCount, 0U);
+  XCTAssertEqual(self.buttonBar.addedItemObserverCount, 0U);
+  XCTAssertEqual(self.buttonBar.removedItemObserverCount, 0U);
+  XCTAssertEqualObjects([NSSet setWithArray:self.buttonBar.subviews],
+                        [NSSet setWithArray:originalSubviews]);
+}
+
+- (void)testReplacingAnItemOnlyCreatesAViewForTheNewItem {
+  // Given
+  self.buttonBar.items = @[ self.firstItem, self.secondItem ];
+  CGRect firstItemRect = [self.buttonBar rectForItem:self.firstItem
+                                   inCoordinateSpace:self.buttonBar];
+  [self.buttonBar resetRecyclingCounters];
+
+  // When
+  self.buttonBar.items = @[ self.firstItem, self.thirdItem ];
+
+  // Then
+  XCTAssertEqual(self.buttonBar.createdButtonViewCount, 1U);
+  XCTAssertEqual(self.buttonBar.reusedButtonViewCount, 1U);
+  XCTAssertEqual(self.buttonBar.removedButtonViewCount, 1U);
+  XCTAssertGreaterThan(self.buttonBar.addedItemObserverCount, 0U);
+  XCTAssertEqual(self.buttonBar.addedItemObserverCount, self.buttonBar.removedItemObserverCount);
+  XCTAssertEqual(self.buttonBar.subviews.count, 2U);
+  XCTAssertTrue(CGSizeEqualToSize(
+      [self.buttonBar rectForItem:self.firstItem inCoordinateSpace:self.buttonBar].size,
+      firstItemRect.size));
+}
+
+- (void)testReusedButtonViewsStillObserveTheirItems {
+  // Given
+  self.buttonBar.uppercasesButtonTitles = NO;
+  self.buttonBar.items = @[ self.firstItem, self.secondItem ];
+  self.buttonBar.items = @[ self.secondItem, self.firstItem ];
+
+  // When
+  self.firstItem.title = @"Renamed";
+
+  // Then
+  UIButton *firstButton = nil;
+  for (UIView *view in self.buttonBar.subviews) {
+    if ([view isKindOfClass:[UIButton class]] &&
+        [[(UIButton *)view titleForState:UIControlStateNormal] isEqualToString:@"Renamed"]) {
+      firstButton = (UIButton *)view;
+    }
+  }
+  XCTAssertNotNil(firstButton);
+}
+
+- (void)testReplacingAnItemsCustomViewRebuildsItsView {
+  // Given
+  UIView *originalCustomView = [[UIView alloc] initWithFrame:CGRectMake(0, 0, 20, 20)];
+  UIView *newCustomView = [[UIView alloc] initWithFrame:CGRectMake(0, 0, 30, 20)];
+  self.firstItem.customView = originalCustomView;
+  self.buttonBar.items = @[ self.firstItem, self.secondItem ];
+  [self.buttonBar resetRecyclingCounters];
+
+  // When
+  self.firstItem.customView = newCustomView;
+  self.buttonBar.items = @[ self.firstItem, self.secondItem ];
+
+  // Then
+  XCTAssertEqual(newCustomView.superview, self.buttonBar);
+  XCTAssertNil(originalCustomView.superview);
+  XCTAssertEqual(self.buttonBar.createdButtonViewCount, 1U);
+  XCTAssertEqual(self.buttonBar.reusedButtonViewCount, 1U);
+  XCTAssertEqual(self.buttonBar.removedButtonViewCount, 1U);
+}
+
+- (void)testGivingAnItemACustomViewReplacesItsButton {
+  // Given
+  UIView *customView = [[UIView alloc] initWithFrame:CGRectMake(0, 0, 20, 20)];
+  self.buttonBar.items = @[ self.firstItem, self.secondItem ];
+  [self.buttonBar resetRecyclingCounters];
+
+  // When
+  self.firstItem.customView = customView;
+  self.buttonBar.items = @[ self.firstItem, self.secondItem ];
+
+  // Then
+  XCTAssertEqual(customView.superview, self.buttonBar);
+  XCTAssertEqual(self.buttonBar.subviews.count, 2U);
+  XCTAssertEqual(self.buttonBar.createdButtonViewCount, 1U);
+  XCTAssertEqual(self.buttonBar.removedButtonViewCount, 1U);
+}
+
+- (void)testRemovingAllItemsRemovesEveryButtonView {
+  // Given
+  self.buttonBar.items = @[ self.firstItem, self.secondItem ];
+  [self.buttonBar resetRecyclingCounters];
+
+  // When
+  self.buttonBar.items = nil;
+
+  // Then
+  XCTAssertEqual(self.buttonBar.removedButtonViewCount, 2U);
+  XCTAssertEqual(self.buttonBar.subviews.count, 0U);
+}
+
+@end
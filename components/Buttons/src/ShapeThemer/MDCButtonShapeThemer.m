@@ -18,12 +18,8 @@
 
 + (void)applyShapeScheme:(nonnull id<MDCShapeScheming>)shapeScheme
                 toButton:(nonnull MDCButton *)button {
-  MDCRectangleShapeGenerator *rectangleShape = [[MDCRectangleShapeGenerator alloc] init];
-  rectangleShape.topLeftCorner = shapeScheme.smallComponentShape.topLeftCorner;
-  rectangleShape.topRightCorner = shapeScheme.smallComponentShape.topRightCorner;
-  rectangleShape.bottomLeftCorner = shapeScheme.smallComponentShape.bottomLeftCorner;
-  rectangleShape.bottomRightCorner = shapeScheme.smallComponentShape.bottomRightCorner;
-  button.shapeGenerator = rectangleShape;
+  button.shapeGenerator = [[MDCImmutableRectangleShapeGenerator
+      shapeGeneratorForShapeCategory:shapeScheme.smallComponentShape] shapeGeneratorForComponent];
 }
 
 @end
@@ -21,12 +21,21 @@ static const CGFloat kFloatingButtonBaselineShapePercentageValue = (CGFloat)0.5;
 + (void)applyShapeScheme:(nonnull id<MDCShapeScheming> __unused)shapeScheme
                 toButton:(nonnull MDCFloatingButton *)button {
   // This is an override of the default scheme to fit the baseline values.
-  MDCRectangleShapeGenerator *rectangleShape = [[MDCRectangleShapeGenerator alloc] init];
-  MDCCornerTreatment *cornerTreatment =
-      [MDCCornerTreatment cornerWithRadius:kFloatingButtonBaselineShapePercentageValue
-                                 valueType:MDCCornerTreatmentValueTypePercentage];
-  [rectangleShape setCorners:cornerTreatment];
-  button.shapeGenerator = rectangleShape;
+  static MDCImmutableRectangleShapeGenerator *rectangleShape;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    MDCShapeCategory *shapeCategory = [[MDCShapeCategory alloc] init];
+    MDCCornerTreatment *cornerTreatment =
+        [MDCCornerTreatment cornerWithRadius:kFloatingButtonBaselineShapePercentageValue
+                                   valueType:MDCCornerTreatmentValueTypePercentage];
+    shapeCategory.topLeftCorner = cornerTreatment;
+    shapeCategory.topRightCorner = cornerTreatment;
+    shapeCategory.bottomLeftCorner = cornerTreatment;
+    shapeCategory.bottomRightCorner = cornerTreatment;
+    rectangleShape =
+        [MDCImmutableRectangleShapeGenerator shapeGeneratorForShapeCategory:shapeCategory];
+  });
+  button.shapeGenerator = [rectangleShape shapeGeneratorForComponent];
 }
 
 @end
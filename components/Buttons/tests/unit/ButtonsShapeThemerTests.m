@@ -57,6 +57,37 @@
                         self.shapeScheme.smallComponentShape.bottomRightCorner);
 }
 
+- (void)testMDCButtonShapeThemerSharesTheShapeGeneratorBetweenButtons {
+  // Given
+  MDCButton *otherButton = [[MDCButton alloc] init];
+
+  // When
+  [MDCButtonShapeThemer applyShapeScheme:self.shapeScheme toButton:self.button];
+  [MDCButtonShapeThemer applyShapeScheme:self.shapeScheme toButton:otherButton];
+
+  // Then
+  XCTAssertNotNil(self.button.shapeGenerator);
+  XCTAssertEqual(self.button.shapeGenerator, otherButton.shapeGenerator);
+}
+
+- (void)testMDCButtonShapeThemerGivesEachButtonAMutableGeneratorWhenSharingIsOff {
+  // Given
+  MDCButton *otherButton = [[MDCButton alloc] init];
+  MDCImmutableRectangleShapeGenerator.sharesGeneratorsBetweenComponents = NO;
+
+  // When
+  [MDCButtonShapeThemer applyShapeScheme:self.shapeScheme toButton:self.button];
+  [MDCButtonShapeThemer applyShapeScheme:self.shapeScheme toButton:otherButton];
+  MDCImmutableRectangleShapeGenerator.sharesGeneratorsBetweenComponents = YES;
+  MDCRectangleShapeGenerator *rectangleGenerator =
+      (MDCRectangleShapeGenerator *)self.button.shapeGenerator;
+  rectangleGenerator.topLeftCorner = [MDCCornerTreatment cornerWithCut:10];
+
+  // Then
+  XCTAssertNotEqual(self.button.shapeGenerator, otherButton.shapeGenerator);
+  XCTAssertEqualObjects(rectangleGenerator.topLeftCorner, [MDCCornerTreatment cornerWithCut:10]);
+}
+
 - (void)testMDCFloatingButtonShapeThemer {
   // Given
   MDCFloatingButton *FAB = [[MDCFloatingButton alloc] initWithFrame:CGRectZero
@@ -26,12 +26,8 @@
 }
 
 + (id<MDCShapeGenerating>)cardShapeGeneratorFromScheme:(id<MDCShapeScheming>)shapeScheme {
-  MDCRectangleShapeGenerator *rectangleShape = [[MDCRectangleShapeGenerator alloc] init];
-  rectangleShape.topLeftCorner = shapeScheme.mediumComponentShape.topLeftCorner;
-  rectangleShape.topRightCorner = shapeScheme.mediumComponentShape.topRightCorner;
-  rectangleShape.bottomLeftCorner = shapeScheme.mediumComponentShape.bottomLeftCorner;
-  rectangleShape.bottomRightCorner = shapeScheme.mediumComponentShape.bottomRightCorner;
-  return rectangleShape;
+  return [[MDCImmutableRectangleShapeGenerator
+      shapeGeneratorForShapeCategory:shapeScheme.mediumComponentShape] shapeGeneratorForComponent];
 }
 
 @end
@@ -16,7 +16,6 @@
 
 #import <MDFInternationalization/MDFInternationalization.h>
 
-#import "MaterialMath.h"
 #import "MaterialTextFields.h"
 
 NSString *const MDCEmptyTextString = @"";
@@ -403,125 +402,9 @@ const UIEdgeInsets MDCChipFieldDefaultContentEdgeInsets = {
 - (UIImage *)drawClearButton {
   CGSize clearButtonSize =
       CGSizeMake(MDCChipFieldClearImageSquareWidthHeight, MDCChipFieldClearImageSquareWidthHeight);
-
-  CGRect bounds = CGRectMake(0, 0, clearButtonSize.width, clearButtonSize.height);
-  UIGraphicsBeginImageContextWithOptions(bounds.size, false, 0);
-  [UIColor.grayColor setFill];
-  [MDCPathForClearButtonImageFrame(bounds) fill];
-  UIImage *image = UIGraphicsGetImageFromCurrentImageContext();
-  UIGraphicsEndImageContext();
-
-  image = [image imageWithRenderingMode:UIImageRenderingModeAlwaysTemplate];
-  return image;
-}
-
-static inline UIBezierPath *MDCPathForClearButtonImageFrame(CGRect frame) {
-  // GENERATED CODE
-
-  CGRect innerBounds =
-      CGRectMake(CGRectGetMinX(frame) + 2, CGRectGetMinY(frame) + 2,
-                 MDCFloor((frame.size.width - 2) * (CGFloat)0.90909 + (CGFloat)0.5),
-                 MDCFloor((frame.size.height - 2) * (CGFloat)0.90909 + (CGFloat)0.5));
-  UIBezierPath *ic_clear_path = [UIBezierPath bezierPath];
-  [ic_clear_path moveToPoint:CGPointMake(CGRectGetMinX(innerBounds) +
-                                             (CGFloat)0.50000 * innerBounds.size.width,
-                                         CGRectGetMinY(innerBounds) + 0 * innerBounds.size.height)];
-  [ic_clear_path
-      addCurveToPoint:CGPointMake(
-                          CGRectGetMinX(innerBounds) + 1 * innerBounds.size.width,
-                          CGRectGetMinY(innerBounds) + (CGFloat)0.50000 * innerBounds.size.height)
-        controlPoint1:CGPointMake(
-                          CGRectGetMinX(innerBounds) + (CGFloat)0.77600 * innerBounds.size.width,
-                          CGRectGetMinY(innerBounds) + 0 * innerBounds.size.height)
-        controlPoint2:CGPointMake(
-                          CGRectGetMinX(innerBounds) + 1 * innerBounds.size.width,
-                          CGRectGetMinY(innerBounds) + (CGFloat)0.22400 * innerBounds.size.height)];
-  [ic_clear_path
-      addCurveToPoint:CGPointMake(
-                          CGRectGetMinX(innerBounds) + (CGFloat)0.50000 * innerBounds.size.width,
-                          CGRectGetMinY(innerBounds) + 1 * innerBounds.size.height)
-        controlPoint1:CGPointMake(
-                          CGRectGetMinX(innerBounds) + 1 * innerBounds.size.width,
-                          CGRectGetMinY(innerBounds) + (CGFloat)0.77600 * innerBounds.size.height)
-        controlPoint2:CGPointMake(
-                          CGRectGetMinX(innerBounds) + (CGFloat)0.77600 * innerBounds.size.width,
-                          CGRectGetMinY(innerBounds) + 1 * innerBounds.size.height)];
-  [ic_clear_path
-      addCurveToPoint:CGPointMake(
-                          CGRectGetMinX(innerBounds) + 0 * innerBounds.size.width,
-                          CGRectGetMinY(innerBounds) + (CGFloat)0.50000 * innerBounds.size.height)
-        controlPoint1:CGPointMake(
-                          CGRectGetMinX(innerBounds) + (CGFloat)0.22400 * innerBounds.size.width,
-                          CGRectGetMinY(innerBounds) + 1 * innerBounds.size.height)
-        controlPoint2:CGPointMake(
-                          CGRectGetMinX(innerBounds) + 0 * innerBounds.size.width,
-                          CGRectGetMinY(innerBounds) + (CGFloat)0.77600 * innerBounds.size.height)];
-  [ic_clear_path
-      addCurveToPoint:CGPointMake(
-                          CGRectGetMinX(innerBounds) + (CGFloat)0.50000 * innerBounds.size.width,
-                          CGRectGetMinY(innerBounds) + 0 * innerBounds.size.height)
-        controlPoint1:CGPointMake(
-                          CGRectGetMinX(innerBounds) + 0 * innerBounds.size.width,
-                          CGRectGetMinY(innerBounds) + (CGFloat)0.22400 * innerBounds.size.height)
-        controlPoint2:CGPointMake(
-                          CGRectGetMinX(innerBounds) + (CGFloat)0.22400 * innerBounds.size.width,
-                          CGRectGetMinY(innerBounds) + 0 * innerBounds.size.height)];
-  [ic_clear_path closePath];
-  [ic_clear_path
-      moveToPoint:CGPointMake(
-                      CGRectGetMinX(innerBounds) + (CGFloat)0.73417 * innerBounds.size.width,
-                      CGRectGetMinY(innerBounds) + (CGFloat)0.31467 * innerBounds.size.height)];
-  [ic_clear_path
-      addLineToPoint:CGPointMake(
-                         CGRectGetMinX(innerBounds) + (CGFloat)0.68700 * innerBounds.size.width,
-                         CGRectGetMinY(innerBounds) + (CGFloat)0.26750 * innerBounds.size.height)];
-  [ic_clear_path
-      addLineToPoint:CGPointMake(
-                         CGRectGetMinX(innerBounds) + (CGFloat)0.50083 * innerBounds.size.width,
-                         CGRectGetMinY(innerBounds) + (CGFloat)0.45367 * innerBounds.size.height)];
-  [ic_clear_path
-      addLineToPoint:CGPointMake(
-                         CGRectGetMinX(innerBounds) + (CGFloat)0.31467 * innerBounds.size.width,
-                         CGRectGetMinY(innerBounds) + (CGFloat)0.26750 * innerBounds.size.height)];
-  [ic_clear_path
-      addLineToPoint:CGPointMake(
-                         CGRectGetMinX(innerBounds) + (CGFloat)0.26750 * innerBounds.size.width,
-                         CGRectGetMinY(innerBounds) + (CGFloat)0.31467 * innerBounds.size.height)];
-  [ic_clear_path
-      addLineToPoint:CGPointMake(
-                         CGRectGetMinX(innerBounds) + (CGFloat)0.45367 * innerBounds.size.width,
-                         CGRectGetMinY(innerBounds) + (CGFloat)0.50083 * innerBounds.size.height)];
-  [ic_clear_path
-      addLineToPoint:CGPointMake(
-                         CGRectGetMinX(innerBounds) + (CGFloat)0.26750 * innerBounds.size.width,
-                         CGRectGetMinY(innerBounds) + (CGFloat)0.68700 * innerBounds.size.height)];
-  [ic_clear_path
-      addLineToPoint:CGPointMake(
-                         CGRectGetMinX(innerBounds) + (CGFloat)0.31467 * innerBounds.size.width,
-                         CGRectGetMinY(innerBounds) + (CGFloat)0.73417 * innerBounds.size.height)];
-  [ic_clear_path
-      addLineToPoint:CGPointMake(
-                         CGRectGetMinX(innerBounds) + (CGFloat)0.50083 * innerBounds.size.width,
-                         CGRectGetMinY(innerBounds) + (CGFloat)0.54800 * innerBounds.size.height)];
-  [ic_clear_path
-      addLineToPoint:CGPointMake(
-                         CGRectGetMinX(innerBounds) + (CGFloat)0.68700 * innerBounds.size.width,
-                         CGRectGetMinY(innerBounds) + (CGFloat)0.73417 * innerBounds.size.height)];
-  [ic_clear_path
-      addLineToPoint:CGPointMake(
-                         CGRectGetMinX(innerBounds) + (CGFloat)0.73417 * innerBounds.size.width,
-                         CGRectGetMinY(innerBounds) + (CGFloat)0.68700 * innerBounds.size.height)];
-  [ic_clear_path
-      addLineToPoint:CGPointMake(
-                         CGRectGetMinX(innerBounds) + (CGFloat)0.54800 * innerBounds.size.width,
-                         CGRectGetMinY(innerBounds) + (CGFloat)0.50083 * innerBounds.size.height)];
-  [ic_clear_path
-      addLineToPoint:CGPointMake(
-                         CGRectGetMinX(innerBounds) + (CGFloat)0.73417 * innerBounds.size.width,
-                         CGRectGetMinY(innerBounds) + (CGFloat)0.31467 * innerBounds.size.height)];
-  [ic_clear_path closePath];
-
-  return ic_clear_path;
+  return [[MDCTextInputGlyphCache sharedCache] imageForGlyph:MDCTextInputGlyphClear
+                                                        size:clearButtonSize
+                                                       scale:0];
 }
 
 - (void)deleteChip:(id)sender {
@@ -94,6 +94,10 @@ static inline CGSize CGSizeExpandWithInsets(CGSize size, UIEdgeInsets edgeInsets
                     size.height + UIEdgeInsetsVertical(edgeInsets));
 }
 
+static inline BOOL MDCChipValueChanged(id oldValue, id newValue) {
+  return oldValue != newValue && ![oldValue isEqual:newValue];
+}
+
 static inline CGSize CGSizeShrinkWithInsets(CGSize size, UIEdgeInsets edgeInsets) {
   return CGSizeMake(size.width - UIEdgeInsetsHorizontal(edgeInsets),
                     size.height - UIEdgeInsetsVertical(edgeInsets));
@@ -123,6 +127,11 @@ static inline CGSize CGSizeShrinkWithInsets(CGSize size, UIEdgeInsets edgeInsets
   UIFont *_titleFont;
 
   BOOL _mdc_adjustsFontForContentSizeCategory;
+
+  // The state the state-dependent properties were last applied for by -updateState.
+  UIControlState _appliedState;
+  BOOL _hasAppliedState;
+  NSUInteger _stateMutationCount;
 }
 
 @dynamic layer;
@@ -569,16 +578,77 @@ static inline CGSize CGSizeShrinkWithInsets(CGSize size, UIEdgeInsets edgeInsets
 }
 
 - (void)updateState {
-  [self updateBackgroundColor];
-  [self updateBorderColor];
-  [self updateBorderWidth];
-  [self updateElevation];
-  [self updateInkColor];
-  [self updateRippleColor];
-  [self updateShadowColor];
-  [self updateTitleFont];
-  [self updateTitleColor];
-  [self updateAccessibility];
+  // The per-state setters keep the applied properties in sync with the current state, so a state
+  // transition only needs to apply the properties whose value differs between the two states. The
+  // first transition applies everything because the initializers only apply some of them.
+  UIControlState state = self.state;
+  if (_hasAppliedState && state == _appliedState) {
+    return;
+  }
+  BOOL applyAll = !_hasAppliedState;
+  UIControlState previousState = _appliedState;
+  _appliedState = state;
+  _hasAppliedState = YES;
+
+  if (applyAll || MDCChipValueChanged([self backgroundColorForState:previousState],
+                                      [self backgroundColorForState:state])) {
+    [self updateBackgroundColor];
+    ++_stateMutationCount;
+  }
+  if (applyAll || MDCChipValueChanged([self borderColorForState:previousState],
+                                      [self borderColorForState:state])) {
+    [self updateBorderColor];
+    ++_stateMutationCount;
+  }
+  if (applyAll || [self borderWidthForState:previousState] != [self borderWidthForState:state]) {
+    [self updateBorderWidth];
+    ++_stateMutationCount;
+  }
+  if (applyAll || [self elevationForState:previousState] != [self elevationForState:state]) {
+    [self updateElevation];
+    ++_stateMutationCount;
+  }
+  BOOL inkColorChanged =
+      MDCChipValueChanged([self inkColorForState:previousState], [self inkColorForState:state]);
+  if (applyAll || inkColorChanged) {
+    [self updateInkColor];
+    ++_stateMutationCount;
+  }
+  // The stateful ripple view applies its own colors, except in states it does not support.
+  BOOL rippleSupportChanged = ([self rippleStateForControlState:previousState] == nil) !=
+                              ([self rippleStateForControlState:state] == nil);
+  if (applyAll || inkColorChanged || rippleSupportChanged) {
+    [self updateRippleColor];
+    ++_stateMutationCount;
+  }
+  if (applyAll || MDCChipValueChanged([self shadowColorForState:previousState],
+                                      [self shadowColorForState:state])) {
+    [self updateShadowColor];
+    ++_stateMutationCount;
+  }
+  // The title font does not depend on the state.
+  if (applyAll) {
+    [self updateTitleFont];
+    ++_stateMutationCount;
+  }
+  if (applyAll || MDCChipValueChanged([self titleColorForState:previousState],
+                                      [self titleColorForState:state])) {
+    [self updateTitleColor];
+    ++_stateMutationCount;
+  }
+  UIControlState accessibilityStates = UIControlStateSelected | UIControlStateDisabled;
+  if (applyAll || ((previousState ^ state) & accessibilityStates) != 0) {
+    [self updateAccessibility];
+    ++_stateMutationCount;
+  }
+}
+
+- (NSUInteger)stateMutationCount {
+  return _stateMutationCount;
+}
+
+- (void)resetStateMutationCount {
+  _stateMutationCount = 0;
 }
 
 #pragma mark - Custom touch handling
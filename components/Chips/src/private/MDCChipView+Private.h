@@ -25,3 +25,21 @@
 - (void)rippleViewTouchesEnded:(NSSet<UITouch *> *)touches withEvent:(UIEvent *)event;
 
 @end
+
+/**
+ Counts the state-dependent properties applied by state transitions. Used to verify that changing
+ @c enabled, @c highlighted or @c selected only applies the properties that differ between the old
+ and the new state.
+ */
+@interface MDCChipView (StateTransitions)
+
+/**
+ The number of state-dependent properties, such as the background color or the elevation, that
+ state transitions have applied.
+ */
+@property(nonatomic, readonly) NSUInteger stateMutationCount;
+
+/** Resets @c stateMutationCount to zero. */
+- (void)resetStateMutationCount;
+
+@end
@@ -0,0 +1,122 @@
+// Copyright 2015-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "MDCChipView+Private.h"
+#import "MaterialChips.h"
+#import "MaterialShadowElevations.h"
+
+/**
+ Verifies that @c MDCChipView only applies the state-dependent properties that differ between the
+ old and the new state.
+ */
+@interface ChipViewStateTransitionTests : XCTestCase
+@property(nonatomic, strong) MDCChipView *chip;
+@end
+
+@implementation ChipViewStateTransitionTests
+
+- (void)setUp {
+  [super setUp];
+
+  self.chip = [[MDCChipView alloc] init];
+  // The first transition applies every property; settle it before each test.
+  self.chip.selected = YES;
+  self.chip.selected = NO;
+  [self.chip resetStateMutationCount];
+}
+
+- (void)tearDown {
+  self.chip = nil;
+
+  [super tearDown];
+}
+
+- (void)testFirstTransitionAppliesEveryProperty {
+  // Given
+  MDCChipView *chip = [[MDCChipView alloc] init];
+
+  // When
+  chip.highlighted = YES;
+
+  // Then
+  XCTAssertEqual(chip.stateMutationCount, 10U);
+  XCTAssertEqualObjects(chip.titleLabel.textColor,
+                        [chip titleColorForState:UIControlStateHighlighted]);
+}
+
+- (void)testHighlightingOnlyAppliesElevation {
+  // When
+  self.chip.highlighted = YES;
+
+  // Then
+  XCTAssertEqual(self.chip.stateMutationCount, 1U);
+  XCTAssertEqualWithAccuracy([self.chip elevationForState:self.chip.state],
+                             MDCShadowElevationRaisedButtonPressed, 0.001);
+}
+
+- (void)testRepeatedHighlightingAppliesNothing {
+  // Given
+  self.chip.highlighted = YES;
+  [self.chip resetStateMutationCount];
+
+  // When
+  self.chip.highlighted = YES;
+  self.chip.highlighted = YES;
+
+  // Then
+  XCTAssertEqual(self.chip.stateMutationCount, 0U);
+}
+
+- (void)testSelectingAppliesBackgroundColorAndAccessibility {
+  // When
+  self.chip.selected = YES;
+
+  // Then
+  XCTAssertEqual(self.chip.stateMutationCount, 2U);
+  XCTAssertEqualObjects(self.chip.backgroundColor,
+                        [self.chip backgroundColorForState:UIControlStateSelected]);
+  XCTAssertTrue((self.chip.accessibilityTraits & UIAccessibilityTraitSelected) != 0);
+}
+
+- (void)testDisablingAppliesOnlyChangedProperties {
+  // When
+  self.chip.enabled = NO;
+
+  // Then
+  // Background color, ripple color, title color and accessibility.
+  XCTAssertEqual(self.chip.stateMutationCount, 4U);
+  XCTAssertEqualObjects(self.chip.titleLabel.textColor,
+                        [self.chip titleColorForState:UIControlStateDisabled]);
+  XCTAssertTrue((self.chip.accessibilityTraits & UIAccessibilityTraitNotEnabled) != 0);
+}
+
+- (void)testPerStateValuesSetAfterTransitionsAreApplied {
+  // Given
+  self.chip.highlighted = YES;
+
+  // When
+  [self.chip setBorderWidth:3 forState:UIControlStateHighlighted];
+  self.chip.highlighted = NO;
+  [self.chip resetStateMutationCount];
+  self.chip.highlighted = YES;
+
+  // Then
+  // Border width and elevation.
+  XCTAssertEqual(self.chip.stateMutationCount, 2U);
+  XCTAssertEqualWithAccuracy(self.chip.layer.borderWidth, 3, 0.001);
+}
+
+@end
@@ -25,3 +25,29 @@
 @interface MDCCollectionViewFlowLayout : UICollectionViewFlowLayout
 
 @end
+
+/**
+ The invalidation context class of MDCCollectionViewFlowLayout.
+
+ MDCCollectionViewFlowLayout caches the styled layout attributes it returns, so that scrolling does
+ not restyle every visible element. Any invalidation drops the cached attributes of the invalidated
+ elements unless invalidateStyledAttributes is NO.
+
+ The layout notices changes to the editor and to the styler's own properties, but not to the values
+ returned by the styler's delegate. After such a change, invalidate the affected elements with a
+ context whose invalidateStyledAttributes is YES.
+ */
+@interface MDCCollectionViewFlowLayoutInvalidationContext
+    : UICollectionViewFlowLayoutInvalidationContext
+
+/**
+ Whether the invalidation restyles the layout attributes of the invalidated elements.
+
+ Set this to NO when neither the positions of the elements nor their styling changed, for example
+ when only the bounds of the collection view moved.
+
+ Defaults to YES.
+ */
+@property(nonatomic) BOOL invalidateStyledAttributes;
+
+@end
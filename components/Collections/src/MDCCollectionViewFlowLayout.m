@@ -29,6 +29,90 @@ NSString *const kCollectionGridDecorationView = @"MDCCollectionGridDecorationVie
 
 static const NSInteger kSupplementaryViewZIndex = 99;
 
+/**
+ A snapshot of the editor and styler state that styled layout attributes depend on. Changes to
+ these properties do not always invalidate the layout, so styled attributes are dropped whenever
+ the snapshot taken for a query differs from the one they were styled with.
+ */
+@interface MDCCollectionViewFlowLayoutStyleState : NSObject {
+ @public
+  BOOL _editing;
+  NSInteger _dismissingSection;
+  NSIndexPath *_dismissingCellIndexPath;
+  NSIndexPath *_reorderingCellIndexPath;
+  MDCCollectionViewCellLayoutType _cellLayoutType;
+  MDCCollectionViewCellStyle _cellStyle;
+  NSInteger _gridColumnCount;
+  CGFloat _gridPadding;
+  CGFloat _cardBorderRadius;
+  UIColor *_cellBackgroundColor;
+  UIColor *_separatorColor;
+  UIEdgeInsets _separatorInset;
+  CGFloat _separatorLineHeight;
+  BOOL _shouldHideSeparators;
+}
+@end
+
+@implementation MDCCollectionViewFlowLayoutStyleState
+
+- (BOOL)isEqual:(id)object {
+  if (object == self) {
+    return YES;
+  }
+  if (![object isKindOfClass:[MDCCollectionViewFlowLayoutStyleState class]]) {
+    return NO;
+  }
+  MDCCollectionViewFlowLayoutStyleState *other = (MDCCollectionViewFlowLayoutStyleState *)object;
+  return _editing == other->_editing && _dismissingSection == other->_dismissingSection &&
+         (_dismissingCellIndexPath == other->_dismissingCellIndexPath ||
+          [_dismissingCellIndexPath isEqual:other->_dismissingCellIndexPath]) &&
+         (_reorderingCellIndexPath == other->_reorderingCellIndexPath ||
+          [_reorderingCellIndexPath isEqual:other->_reorderingCellIndexPath]) &&
+         _cellLayoutType == other->_cellLayoutType && _cellStyle == other->_cellStyle &&
+         _gridColumnCount == other->_gridColumnCount && _gridPadding == other->_gridPadding &&
+         _cardBorderRadius == other->_cardBorderRadius &&
+         _cellBackgroundColor == other->_cellBackgroundColor &&
+         _separatorColor == other->_separatorColor &&
+         UIEdgeInsetsEqualToEdgeInsets(_separatorInset, other->_separatorInset) &&
+         _separatorLineHeight == other->_separatorLineHeight &&
+         _shouldHideSeparators == other->_shouldHideSeparators;
+}
+
+- (NSUInteger)hash {
+  return (NSUInteger)_cellStyle ^ ((NSUInteger)_cellLayoutType << 4) ^
+         ((NSUInteger)_editing << 8) ^ (NSUInteger)_dismissingSection;
+}
+
+@end
+
+/**
+ Layout attributes styled by MDCCollectionViewFlowLayout, together with the inputs they were
+ styled from that can change without invalidating the layout.
+ */
+@interface MDCCollectionViewStyledAttributes : NSObject {
+ @public
+  MDCCollectionViewLayoutAttributes *_attributes;
+  CGRect _sourceFrame;
+  BOOL _hasSectionHeader;
+  BOOL _hasSectionFooter;
+}
+@end
+
+@implementation MDCCollectionViewStyledAttributes
+@end
+
+@implementation MDCCollectionViewFlowLayoutInvalidationContext
+
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    _invalidateStyledAttributes = YES;
+  }
+  return self;
+}
+
+@end
+
 @implementation MDCCollectionViewFlowLayout {
   NSMutableArray<NSIndexPath *> *_deletedIndexPaths;
   NSMutableArray<NSIndexPath *> *_insertedIndexPaths;
@@ -37,6 +121,22 @@ static const NSInteger kSupplementaryViewZIndex = 99;
   NSMutableIndexSet *_headerSections;
   NSMutableIndexSet *_footerSections;
   NSMutableDictionary *_decorationViewAttributeCache;
+
+  // The frame of each section from 0 through count - 1, as the union of its item frames. Used to
+  // size the grid background decoration views. Later sections have not been computed yet.
+  NSMutableArray<NSValue *> *_sectionFrames;
+
+  // Set when the data source counts are invalidated, until prepareForCollectionViewUpdates:
+  // reports which sections the updates touched.
+  BOOL _sectionFramesAwaitingUpdates;
+
+  // Styled attributes of cells by index path, and of supplementary views by kind and index path.
+  // They stay valid while scrolling and are dropped by invalidation or a change of style state.
+  NSMutableDictionary<NSIndexPath *, MDCCollectionViewStyledAttributes *> *_styledCellAttributes;
+  NSMutableDictionary<NSString *,
+                      NSMutableDictionary<NSIndexPath *, MDCCollectionViewStyledAttributes *> *>
+      *_styledSupplementaryAttributes;
+  MDCCollectionViewFlowLayoutStyleState *_styledAttributesStyleState;
 }
 
 - (instancetype)init {
@@ -65,6 +165,9 @@ static const NSInteger kSupplementaryViewZIndex = 99;
 
   // Register decoration view for grid background.
   _decorationViewAttributeCache = [NSMutableDictionary dictionary];
+  _sectionFrames = [NSMutableArray array];
+  _styledCellAttributes = [NSMutableDictionary dictionary];
+  _styledSupplementaryAttributes = [NSMutableDictionary dictionary];
   [self registerClass:[MDCCollectionGridBackgroundView class]
       forDecorationViewOfKind:kCollectionGridDecorationView];
 }
@@ -94,16 +197,21 @@ static const NSInteger kSupplementaryViewZIndex = 99;
   // If performing appearance animation, increase bounds height in order to retrieve additional
   // offscreen attributes needed during animation.
   rect = [self boundsForAppearanceAnimationWithInitialBounds:rect];
-  NSMutableArray<__kindof UICollectionViewLayoutAttributes *> *attributes =
-      [[NSMutableArray alloc] initWithArray:[super layoutAttributesForElementsInRect:rect]
-                                  copyItems:YES];
+  NSArray<__kindof UICollectionViewLayoutAttributes *> *superAttributes =
+      [super layoutAttributesForElementsInRect:rect];
 
   // Store index path sections of any headers/footers within these attributes.
-  [self storeSupplementaryViewsWithAttributes:attributes];
+  [self storeSupplementaryViewsWithAttributes:superAttributes];
 
-  // Set layout attributes.
-  for (MDCCollectionViewLayoutAttributes *attr in attributes) {
-    [self updateAttribute:attr];
+  // Set layout attributes. The appearance animation adjusts the attributes it is given, so it
+  // gets copies of the cached styled attributes.
+  [self validateStyledAttributes];
+  BOOL shouldCopyStyledAttributes = self.styler.shouldAnimateCellsOnAppearance;
+  NSMutableArray<__kindof UICollectionViewLayoutAttributes *> *attributes =
+      [NSMutableArray arrayWithCapacity:superAttributes.count];
+  for (UICollectionViewLayoutAttributes *superAttr in superAttributes) {
+    MDCCollectionViewLayoutAttributes *attr = [self styledAttributesForAttributes:superAttr];
+    [attributes addObject:shouldCopyStyledAttributes ? [attr copy] : attr];
   }
 
   // Add info bar header/footer supplementary view if necessary.
@@ -119,15 +227,28 @@ static const NSInteger kSupplementaryViewZIndex = 99;
 }
 
 - (BOOL)shouldInvalidateLayoutForBoundsChange:(CGRect)newBounds {
-  if (!CGSizeEqualToSize(self.collectionView.bounds.size, newBounds.size) ||
-      self.editor.isEditing) {
+  if (!CGSizeEqualToSize(self.collectionView.bounds.size, newBounds.size)) {
     // Invalidate the layout to force cells to respect the new collection view bounds. Doing here
     // removes necessity to implement methods -willRotateToInterfaceOrientation:duration: and/or
     // -viewWillTransitionToSize:withTransitionCoordinator: on the collection view controller.
     [self invalidateLayout];
     return YES;
   }
-  return NO;
+  // While editing, the info bars stay fixed to the visible bounds. See
+  // -invalidationContextForBoundsChange:.
+  return self.editor.isEditing;
+}
+
+- (UICollectionViewLayoutInvalidationContext *)invalidationContextForBoundsChange:
+    (CGRect)newBounds {
+  UICollectionViewLayoutInvalidationContext *context =
+      [super invalidationContextForBoundsChange:newBounds];
+  if (CGSizeEqualToSize(self.collectionView.bounds.size, newBounds.size) &&
+      [context isKindOfClass:[MDCCollectionViewFlowLayoutInvalidationContext class]]) {
+    // Scrolling only moves the info bars, whose attributes are never cached.
+    ((MDCCollectionViewFlowLayoutInvalidationContext *)context).invalidateStyledAttributes = NO;
+  }
+  return context;
 }
 
 - (void)invalidateLayout {
@@ -135,6 +256,30 @@ static const NSInteger kSupplementaryViewZIndex = 99;
 
   // Clear decoration attribute cache.
   [_decorationViewAttributeCache removeAllObjects];
+  [_sectionFrames removeAllObjects];
+  _sectionFramesAwaitingUpdates = NO;
+  [self removeAllStyledAttributes];
+}
+
+- (void)invalidateLayoutWithContext:(UICollectionViewLayoutInvalidationContext *)context {
+  [super invalidateLayoutWithContext:context];
+
+  if ([context isKindOfClass:[MDCCollectionViewFlowLayoutInvalidationContext class]] &&
+      !((MDCCollectionViewFlowLayoutInvalidationContext *)context).invalidateStyledAttributes &&
+      !context.invalidateEverything && !context.invalidateDataSourceCounts) {
+    // Neither the positions nor the styling of the elements changed.
+    return;
+  }
+  [self invalidateStyledAttributesWithContext:context];
+
+  // Collection view updates only invalidate the data source counts, and only move the sections
+  // from the first updated one onwards. Anything else may move every section.
+  if (context.invalidateDataSourceCounts && !context.invalidateEverything) {
+    _sectionFramesAwaitingUpdates = YES;
+  } else {
+    [_sectionFrames removeAllObjects];
+    _sectionFramesAwaitingUpdates = NO;
+  }
 }
 
 #pragma mark - UICollectionViewLayout (UISubclassingHooks)
@@ -143,10 +288,13 @@ static const NSInteger kSupplementaryViewZIndex = 99;
   return [MDCCollectionViewLayoutAttributes class];
 }
 
++ (Class)invalidationContextClass {
+  return [MDCCollectionViewFlowLayoutInvalidationContext class];
+}
+
 - (UICollectionViewLayoutAttributes *)layoutAttributesForItemAtIndexPath:(NSIndexPath *)indexPath {
-  UICollectionViewLayoutAttributes *attr =
-      [[super layoutAttributesForItemAtIndexPath:indexPath] copy];
-  return [self updateAttribute:(MDCCollectionViewLayoutAttributes *)attr];
+  [self validateStyledAttributes];
+  return [self styledAttributesForAttributes:[super layoutAttributesForItemAtIndexPath:indexPath]];
 }
 
 - (UICollectionViewLayoutAttributes *)layoutAttributesForSupplementaryViewOfKind:(NSString *)kind
@@ -157,13 +305,16 @@ static const NSInteger kSupplementaryViewZIndex = 99;
   if ([kind isEqualToString:UICollectionElementKindSectionHeader] ||
       [kind isEqualToString:UICollectionElementKindSectionFooter]) {
     // Update section headers/Footers attributes.
-    attr = [[super layoutAttributesForSupplementaryViewOfKind:kind atIndexPath:indexPath] copy];
+    [self validateStyledAttributes];
+    UICollectionViewLayoutAttributes *superAttr =
+        [super layoutAttributesForSupplementaryViewOfKind:kind atIndexPath:indexPath];
+    attr = [self styledAttributesForAttributes:superAttr];
     if (!attr) {
       attr =
           [MDCCollectionViewLayoutAttributes layoutAttributesForSupplementaryViewOfKind:kind
                                                                           withIndexPath:indexPath];
+      [self updateAttribute:(MDCCollectionViewLayoutAttributes *)attr];
     }
-    [self updateAttribute:(MDCCollectionViewLayoutAttributes *)attr];
 
   } else {
     // Update editing info bar attributes.
@@ -212,16 +363,7 @@ static const NSInteger kSupplementaryViewZIndex = 99;
     [_decorationViewAttributeCache setObject:decorationAttr forKey:indexPath];
   }
 
-  // Determine section frame by summing all of its item frames.
-  CGRect sectionFrame = CGRectNull;
-  for (NSInteger i = 0; i < [self numberOfItemsInSection:indexPath.section]; ++i) {
-    indexPath = [NSIndexPath indexPathForItem:i inSection:indexPath.section];
-    UICollectionViewLayoutAttributes *attribute =
-        [self layoutAttributesForItemAtIndexPath:indexPath];
-    if (!CGRectIsNull(attribute.frame)) {
-      sectionFrame = CGRectUnion(sectionFrame, attribute.frame);
-    }
-  }
+  CGRect sectionFrame = [self frameForSection:indexPath.section];
   if (!CGRectIsNull(sectionFrame)) {
     decorationAttr.frame = sectionFrame;
   }
@@ -243,6 +385,7 @@ static const NSInteger kSupplementaryViewZIndex = 99;
   _insertedIndexPaths = [NSMutableArray array];
   _deletedSections = [NSMutableIndexSet indexSet];
   _insertedSections = [NSMutableIndexSet indexSet];
+  [self invalidateSectionFramesForUpdates:updateItems];
 
   for (UICollectionViewUpdateItem *item in updateItems) {
     if (item.updateAction == UICollectionUpdateActionDelete) {
@@ -353,6 +496,184 @@ static const NSInteger kSupplementaryViewZIndex = 99;
   }
 }
 
+#pragma mark - Styled Attributes
+
+- (MDCCollectionViewFlowLayoutStyleState *)currentStyleState {
+  MDCCollectionViewFlowLayoutStyleState *state =
+      [[MDCCollectionViewFlowLayoutStyleState alloc] init];
+  id<MDCCollectionViewEditing> editor = self.editor;
+  if (editor) {
+    state->_editing = editor.isEditing;
+    state->_dismissingSection = editor.dismissingSection;
+    state->_dismissingCellIndexPath = editor.dismissingCellIndexPath;
+    state->_reorderingCellIndexPath = editor.reorderingCellIndexPath;
+  }
+  id<MDCCollectionViewStyling> styler = self.styler;
+  if (styler) {
+    state->_cellLayoutType = styler.cellLayoutType;
+    state->_cellStyle = styler.cellStyle;
+    state->_gridColumnCount = styler.gridColumnCount;
+    state->_gridPadding = styler.gridPadding;
+    state->_cardBorderRadius = styler.cardBorderRadius;
+    state->_cellBackgroundColor = styler.cellBackgroundColor;
+    state->_separatorColor = styler.separatorColor;
+    state->_separatorInset = styler.separatorInset;
+    state->_separatorLineHeight = styler.separatorLineHeight;
+    state->_shouldHideSeparators = styler.shouldHideSeparators;
+  }
+  return state;
+}
+
+- (void)validateStyledAttributes {
+  MDCCollectionViewFlowLayoutStyleState *state = [self currentStyleState];
+  if (![state isEqual:_styledAttributesStyleState]) {
+    [self removeAllStyledAttributes];
+    _styledAttributesStyleState = state;
+  }
+}
+
+- (void)removeAllStyledAttributes {
+  [_styledCellAttributes removeAllObjects];
+  [_styledSupplementaryAttributes removeAllObjects];
+}
+
+- (void)invalidateStyledAttributesWithContext:(UICollectionViewLayoutInvalidationContext *)context {
+  NSArray<NSIndexPath *> *invalidatedItems = context.invalidatedItemIndexPaths;
+  NSDictionary<NSString *, NSArray<NSIndexPath *> *> *invalidatedSupplementaryViews =
+      context.invalidatedSupplementaryIndexPaths;
+  if (context.invalidateEverything || context.invalidateDataSourceCounts ||
+      (!invalidatedItems && !invalidatedSupplementaryViews)) {
+    [self removeAllStyledAttributes];
+    return;
+  }
+
+  // Only drop the invalidated elements. Other elements whose frames moved are restyled when their
+  // frame no longer matches the one they were styled with.
+  if (invalidatedItems) {
+    [_styledCellAttributes removeObjectsForKeys:invalidatedItems];
+  }
+  [invalidatedSupplementaryViews
+      enumerateKeysAndObjectsUsingBlock:^(NSString *kind, NSArray<NSIndexPath *> *indexPaths,
+                                          __unused BOOL *stop) {
+        [self->_styledSupplementaryAttributes[kind] removeObjectsForKeys:indexPaths];
+      }];
+}
+
+/**
+ Returns the styled attributes for the given superclass attributes, reusing the cached styled
+ attributes of the same element when they were styled from the same frame and section state.
+ */
+- (MDCCollectionViewLayoutAttributes *)styledAttributesForAttributes:
+    (UICollectionViewLayoutAttributes *)attributes {
+  if (!attributes) {
+    return nil;
+  }
+
+  NSMutableDictionary<NSIndexPath *, MDCCollectionViewStyledAttributes *> *styledAttributes;
+  if (attributes.representedElementCategory == UICollectionElementCategoryCell) {
+    styledAttributes = _styledCellAttributes;
+  } else if (attributes.representedElementCategory ==
+             UICollectionElementCategorySupplementaryView) {
+    NSString *kind = attributes.representedElementKind;
+    styledAttributes = _styledSupplementaryAttributes[kind];
+    if (!styledAttributes) {
+      styledAttributes = [NSMutableDictionary dictionary];
+      _styledSupplementaryAttributes[kind] = styledAttributes;
+    }
+  } else {
+    return [self updateAttribute:(MDCCollectionViewLayoutAttributes *)[attributes copy]];
+  }
+
+  // Ordinal positions depend on which sections show a header or footer in the current query.
+  NSIndexPath *indexPath = attributes.indexPath;
+  BOOL hasSectionHeader = [_headerSections containsIndex:indexPath.section];
+  BOOL hasSectionFooter = [_footerSections containsIndex:indexPath.section];
+  MDCCollectionViewStyledAttributes *entry = styledAttributes[indexPath];
+  if (entry && entry->_hasSectionHeader == hasSectionHeader &&
+      entry->_hasSectionFooter == hasSectionFooter &&
+      CGRectEqualToRect(entry->_sourceFrame, attributes.frame)) {
+    return entry->_attributes;
+  }
+
+  entry = [[MDCCollectionViewStyledAttributes alloc] init];
+  entry->_sourceFrame = attributes.frame;
+  entry->_hasSectionHeader = hasSectionHeader;
+  entry->_hasSectionFooter = hasSectionFooter;
+  entry->_attributes =
+      [self updateAttribute:(MDCCollectionViewLayoutAttributes *)[attributes copy]];
+  styledAttributes[indexPath] = entry;
+  return entry->_attributes;
+}
+
+#pragma mark - Section Frames
+
+- (void)invalidateSectionFramesForUpdates:(NSArray<UICollectionViewUpdateItem *> *)updateItems {
+  if (!_sectionFramesAwaitingUpdates) {
+    return;
+  }
+  _sectionFramesAwaitingUpdates = NO;
+
+  // Sections before the first updated one keep their frames. Batch updates without any update
+  // items are used to animate size changes, which can move every section.
+  NSUInteger firstUpdatedSection = updateItems.count > 0 ? _sectionFrames.count : 0;
+  for (UICollectionViewUpdateItem *item in updateItems) {
+    NSIndexPath *before = item.indexPathBeforeUpdate;
+    NSIndexPath *after = item.indexPathAfterUpdate;
+    if (before) {
+      firstUpdatedSection = MIN(firstUpdatedSection, (NSUInteger)before.section);
+    }
+    if (after) {
+      firstUpdatedSection = MIN(firstUpdatedSection, (NSUInteger)after.section);
+    }
+  }
+  if (firstUpdatedSection < _sectionFrames.count) {
+    [_sectionFrames
+        removeObjectsInRange:NSMakeRange(firstUpdatedSection,
+                                         _sectionFrames.count - firstUpdatedSection)];
+  }
+}
+
+- (CGRect)frameForSection:(NSInteger)section {
+  if (_sectionFramesAwaitingUpdates) {
+    // The data source counts changed without collection view updates, so any section may have
+    // moved.
+    [_sectionFrames removeAllObjects];
+    _sectionFramesAwaitingUpdates = NO;
+  }
+  if (section < 0 || section >= self.collectionView.numberOfSections) {
+    return CGRectNull;
+  }
+  while ((NSInteger)_sectionFrames.count <= section) {
+    CGRect sectionFrame = [self unionOfItemFramesInSection:(NSInteger)_sectionFrames.count];
+    [_sectionFrames addObject:[NSValue valueWithCGRect:sectionFrame]];
+  }
+  return _sectionFrames[section].CGRectValue;
+}
+
+- (CGRect)unionOfItemFramesInSection:(NSInteger)section {
+  // Of the styling applied by updateAttribute:, only inlays change an item's frame, so only inlaid
+  // items need their attributes copied and restyled.
+  NSMutableIndexSet *inlaidItems = [NSMutableIndexSet indexSet];
+  for (NSIndexPath *inlaidIndexPath in [self.styler indexPathsForInlaidItems]) {
+    if (inlaidIndexPath.section == section) {
+      [inlaidItems addIndex:inlaidIndexPath.item];
+    }
+  }
+
+  CGRect sectionFrame = CGRectNull;
+  NSInteger numberOfItems = [self numberOfItemsInSection:section];
+  for (NSInteger i = 0; i < numberOfItems; ++i) {
+    NSIndexPath *indexPath = [NSIndexPath indexPathForItem:i inSection:section];
+    UICollectionViewLayoutAttributes *attribute =
+        [inlaidItems containsIndex:i] ? [self layoutAttributesForItemAtIndexPath:indexPath]
+                                      : [super layoutAttributesForItemAtIndexPath:indexPath];
+    if (attribute && !CGRectIsNull(attribute.frame)) {
+      sectionFrame = CGRectUnion(sectionFrame, attribute.frame);
+    }
+  }
+  return sectionFrame;
+}
+
 #pragma mark - Private
 
 - (MDCCollectionViewLayoutAttributes *)updateAttribute:(MDCCollectionViewLayoutAttributes *)attr {
@@ -679,7 +1000,8 @@ static const NSInteger kSupplementaryViewZIndex = 99;
     BOOL shouldShowGridBackground = NO;
     NSMutableArray<__kindof UICollectionViewLayoutAttributes *> *decorationAttributes =
         [NSMutableArray array];
-    for (MDCCollectionViewLayoutAttributes *attr in attributes) {
+    for (NSUInteger i = 0; i < attributes.count; ++i) {
+      MDCCollectionViewLayoutAttributes *attr = attributes[i];
       NSInteger section = attr.indexPath.section;
 
       // Only add one decoration view per section.
@@ -698,8 +1020,11 @@ static const NSInteger kSupplementaryViewZIndex = 99;
         [decorationAttributes addObject:decorationAttr];
         [sectionSet addObject:@(section)];
       }
-      if (shouldShowGridBackground) {
-        attr.backgroundImage = nil;
+      if (shouldShowGridBackground && attr.backgroundImage) {
+        // The attributes may be cached styled attributes, so clear the background of a copy.
+        MDCCollectionViewLayoutAttributes *attrCopy = [attr copy];
+        attrCopy.backgroundImage = nil;
+        attributes[i] = attrCopy;
       }
     }
     [attributes addObjectsFromArray:decorationAttributes];
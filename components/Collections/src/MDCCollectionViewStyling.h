@@ -120,8 +120,9 @@ typedef NS_ENUM(NSUInteger, MDCCollectionViewCellLayoutType) {
 /**
  Returns an image for use with the given cell style and ordinal position within section.
 
- The returned image is cached internally after the first request. Changing any of the display
- properties will invalidate the cached images.
+ The returned image is stored in a bounded cache keyed by background color, cell style, border
+ radius and screen scale after the first request, so images are shared between collection views
+ that draw the same backgrounds.
 
  @param attr The cell's layout attributes.
  @return Image as determined by cell style and section ordinal position.
@@ -129,6 +130,28 @@ typedef NS_ENUM(NSUInteger, MDCCollectionViewCellLayoutType) {
 - (nullable UIImage *)backgroundImageForCellLayoutAttributes:
     (nonnull MDCCollectionViewLayoutAttributes *)attr;
 
+@optional
+
+/**
+ Renders the background images for the current cell styles of every section on a background
+ queue, so that they do not have to be drawn on the main thread when cells first appear.
+
+ This method is optional so that existing stylers keep conforming; check
+ @c respondsToSelector: before calling it.
+
+ Call this after configuring the styler and before the collection view first scrolls. Images are
+ rendered for @c cellBackgroundColor and for each color in @c additionalColors, which should list
+ the colors returned by @c collectionView:cellBackgroundColorAtIndexPath:.
+
+ @param additionalColors Background colors to render in addition to @c cellBackgroundColor.
+ @param completion Called on the main queue once every image has been rendered.
+ */
+- (void)prerenderBackgroundImagesWithAdditionalColors:
+            (nullable NSArray<UIColor *> *)additionalColors
+                                           completion:(nullable void (^)(void))completion;
+
+@required
+
 #pragma mark - Cell Separator
 
 /** Separator color. Defaults to #E0E0E0. */
@@ -16,6 +16,7 @@
 
 #import "MaterialCollectionsStrings.h"
 #import "MaterialCollectionsStrings_table.h"
+#import "MaterialLocalizedStrings.h"
 
 // The Bundle for string resources.
 static NSString *const kBundleName = @"MaterialCollections.bundle";
@@ -33,10 +34,7 @@ static NSString *const kBundleName = @"MaterialCollections.bundle";
 }
 
 - (NSString *)stringForId:(MaterialCollectionsStringId)stringID {
-  NSString *stringKey = kMaterialCollectionsStringTable[stringID];
-  NSBundle *bundle = [[self class] bundle];
-  NSString *tableName = [kBundleName stringByDeletingPathExtension];
-  return [bundle localizedStringForKey:stringKey value:nil table:tableName];
+  return [[[self class] stringTable] stringForID:stringID];
 }
 
 - (NSString *)deleteButtonString {
@@ -47,6 +45,20 @@ static NSString *const kBundleName = @"MaterialCollections.bundle";
   return [self stringForId:kStr_MaterialCollectionsInfoBarGestureHint];
 }
 
+#pragma mark - Strings
+
++ (MDCLocalizedStringTable *)stringTable {
+  static MDCLocalizedStringTable *stringTable;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    stringTable = [MDCLocalizedStringTable tableNamed:kMaterialCollectionsStringsTableName
+                                             inBundle:[self bundle]
+                                                 keys:kMaterialCollectionsStringTable
+                                                count:kNumMaterialCollectionsStrings];
+  });
+  return stringTable;
+}
+
 #pragma mark - Resource bundle
 
 + (NSBundle *)bundle {
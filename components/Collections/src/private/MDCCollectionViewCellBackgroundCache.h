@@ -0,0 +1,109 @@
+// Copyright 2015-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#import <UIKit/UIKit.h>
+
+/** The options that select which variant of a cell background image is drawn. */
+typedef NS_OPTIONS(NSUInteger, MDCCollectionViewCellBackgroundStyle) {
+  MDCCollectionViewCellBackgroundStyleFlat = 0,
+  MDCCollectionViewCellBackgroundStyleTop = 1 << 0,
+  MDCCollectionViewCellBackgroundStyleBottom = 1 << 1,
+  MDCCollectionViewCellBackgroundStyleCard = 1 << 2,
+  MDCCollectionViewCellBackgroundStyleGrouped = 1 << 3,
+  MDCCollectionViewCellBackgroundStyleHighlighted = 1 << 4,
+};
+
+/**
+ Identifies a rendered cell background image by everything that affects its pixels: the fill
+ color's RGBA components, the background style, the border radius and the screen scale.
+
+ Colors that cannot be converted to RGBA, such as pattern colors, are compared with -isEqual:.
+ */
+@interface MDCCollectionViewCellBackgroundKey : NSObject <NSCopying>
+
+/** The fill color of the background. */
+@property(nonatomic, readonly, nonnull) UIColor *color;
+
+/** The variant of the background. */
+@property(nonatomic, readonly) MDCCollectionViewCellBackgroundStyle style;
+
+/** The corner radius of card backgrounds. */
+@property(nonatomic, readonly) CGFloat borderRadius;
+
+/** The scale the image is rendered at. */
+@property(nonatomic, readonly) CGFloat scale;
+
+- (nonnull instancetype)initWithColor:(nonnull UIColor *)color
+                                style:(MDCCollectionViewCellBackgroundStyle)style
+                         borderRadius:(CGFloat)borderRadius
+                                scale:(CGFloat)scale NS_DESIGNATED_INITIALIZER;
+
+- (nonnull instancetype)init NS_UNAVAILABLE;
+
+@end
+
+/**
+ A bounded least-recently-used cache of rendered cell background images.
+
+ Once @c countLimit images are stored, adding another one evicts the image that was looked up
+ least recently. MDCCollectionViewCellBackgroundCache is safe to use from any thread so that
+ images can be rendered ahead of time on a background queue.
+ */
+@interface MDCCollectionViewCellBackgroundCache : NSObject
+
+/** A process-wide cache shared by every collection view styler. */
++ (nonnull instancetype)sharedCache;
+
+/** Creates a cache that holds at most @c countLimit images. */
+- (nonnull instancetype)initWithCountLimit:(NSUInteger)countLimit NS_DESIGNATED_INITIALIZER;
+
+/** Creates a cache with a default count limit of 64 images. */
+- (nonnull instancetype)init;
+
+/** The maximum number of images held by the cache. */
+@property(nonatomic, readonly) NSUInteger countLimit;
+
+/** The number of images currently held by the cache. */
+@property(nonatomic, readonly) NSUInteger count;
+
+/** The number of lookups that returned a cached image. */
+@property(nonatomic, readonly) NSUInteger hitCount;
+
+/** The number of lookups that did not find a cached image. */
+@property(nonatomic, readonly) NSUInteger missCount;
+
+/** The number of images removed to stay within @c countLimit. */
+@property(nonatomic, readonly) NSUInteger evictionCount;
+
+/**
+ Returns the image stored for @c key and marks it as most recently used, or returns nil if there
+ is none. Updates @c hitCount or @c missCount.
+ */
+- (nullable UIImage *)imageForKey:(nonnull MDCCollectionViewCellBackgroundKey *)key;
+
+/**
+ Returns whether an image is stored for @c key without updating the counters or the order of
+ eviction.
+ */
+- (BOOL)containsImageForKey:(nonnull MDCCollectionViewCellBackgroundKey *)key;
+
+/** Stores @c image for @c key as the most recently used image, evicting if needed. */
+- (void)setImage:(nonnull UIImage *)image forKey:(nonnull MDCCollectionViewCellBackgroundKey *)key;
+
+/** Removes every image from the cache. Does not reset the counters. */
+- (void)removeAllImages;
+
+/** Resets @c hitCount, @c missCount and @c evictionCount to zero. */
+- (void)resetCounters;
+
+@end
@@ -0,0 +1,190 @@
+// Copyright 2015-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#import "MDCCollectionViewCellBackgroundCache.h"
+
+static const NSUInteger kDefaultCountLimit = 64;
+
+@implementation MDCCollectionViewCellBackgroundKey {
+  BOOL _hasComponents;
+  CGFloat _components[4];
+  NSUInteger _hash;
+}
+
+- (instancetype)initWithColor:(UIColor *)color
+                        style:(MDCCollectionViewCellBackgroundStyle)style
+                 borderRadius:(CGFloat)borderRadius
+                        scale:(CGFloat)scale {
+  self = [super init];
+  if (self) {
+    _color = color;
+    _style = style;
+    _borderRadius = borderRadius;
+    _scale = scale;
+    _hasComponents = [color getRed:&_components[0]
+                             green:&_components[1]
+                              blue:&_components[2]
+                             alpha:&_components[3]];
+    NSUInteger hash = _hasComponents ? 0 : color.hash;
+    for (NSInteger i = 0; i < 4; i++) {
+      hash = hash * 31 + (NSUInteger)(NSInteger)(_components[i] * 255);
+    }
+    _hash = ((hash * 31 + style) * 31 + (NSUInteger)(borderRadius * 100)) * 31 +
+            (NSUInteger)(scale * 10);
+  }
+  return self;
+}
+
+- (id)copyWithZone:(__unused NSZone *)zone {
+  // Keys are immutable.
+  return self;
+}
+
+- (BOOL)isEqual:(id)object {
+  if (object == self) {
+    return YES;
+  }
+  if (![object isKindOfClass:[MDCCollectionViewCellBackgroundKey class]]) {
+    return NO;
+  }
+  MDCCollectionViewCellBackgroundKey *other = (MDCCollectionViewCellBackgroundKey *)object;
+  if (_hash != other->_hash || _style != other->_style || _borderRadius != other->_borderRadius ||
+      _scale != other->_scale || _hasComponents != other->_hasComponents) {
+    return NO;
+  }
+  if (!_hasComponents) {
+    return [_color isEqual:other->_color];
+  }
+  for (NSInteger i = 0; i < 4; i++) {
+    if (_components[i] != other->_components[i]) {
+      return NO;
+    }
+  }
+  return YES;
+}
+
+- (NSUInteger)hash {
+  return _hash;
+}
+
+@end
+
+@implementation MDCCollectionViewCellBackgroundCache {
+  NSMutableDictionary<MDCCollectionViewCellBackgroundKey *, UIImage *> *_images;
+  // Keys ordered from least to most recently used.
+  NSMutableOrderedSet<MDCCollectionViewCellBackgroundKey *> *_recentKeys;
+  NSUInteger _hitCount;
+  NSUInteger _missCount;
+  NSUInteger _evictionCount;
+}
+
++ (instancetype)sharedCache {
+  static MDCCollectionViewCellBackgroundCache *sharedCache;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    sharedCache = [[MDCCollectionViewCellBackgroundCache alloc] init];
+  });
+  return sharedCache;
+}
+
+- (instancetype)init {
+  return [self initWithCountLimit:kDefaultCountLimit];
+}
+
+- (instancetype)initWithCountLimit:(NSUInteger)countLimit {
+  self = [super init];
+  if (self) {
+    _countLimit = MAX(countLimit, (NSUInteger)1);
+    _images = [NSMutableDictionary dictionaryWithCapacity:_countLimit];
+    _recentKeys = [NSMutableOrderedSet orderedSetWithCapacity:_countLimit];
+  }
+  return self;
+}
+
+- (NSUInteger)count {
+  @synchronized(self) {
+    return _images.count;
+  }
+}
+
+- (NSUInteger)hitCount {
+  @synchronized(self) {
+    return _hitCount;
+  }
+}
+
+- (NSUInteger)missCount {
+  @synchronized(self) {
+    return _missCount;
+  }
+}
+
+- (NSUInteger)evictionCount {
+  @synchronized(self) {
+    return _evictionCount;
+  }
+}
+
+- (UIImage *)imageForKey:(MDCCollectionViewCellBackgroundKey *)key {
+  @synchronized(self) {
+    UIImage *image = _images[key];
+    if (!image) {
+      _missCount += 1;
+      return nil;
+    }
+    _hitCount += 1;
+    if (_recentKeys.lastObject != key) {
+      [_recentKeys removeObject:key];
+      [_recentKeys addObject:key];
+    }
+    return image;
+  }
+}
+
+- (BOOL)containsImageForKey:(MDCCollectionViewCellBackgroundKey *)key {
+  @synchronized(self) {
+    return _images[key] != nil;
+  }
+}
+
+- (void)setImage:(UIImage *)image forKey:(MDCCollectionViewCellBackgroundKey *)key {
+  @synchronized(self) {
+    if (_images[key]) {
+      [_recentKeys removeObject:key];
+    } else if (_images.count >= _countLimit) {
+      MDCCollectionViewCellBackgroundKey *leastRecentKey = _recentKeys.firstObject;
+      [_recentKeys removeObjectAtIndex:0];
+      [_images removeObjectForKey:leastRecentKey];
+      _evictionCount += 1;
+    }
+    _images[key] = image;
+    [_recentKeys addObject:key];
+  }
+}
+
+- (void)removeAllImages {
+  @synchronized(self) {
+    [_images removeAllObjects];
+    [_recentKeys removeAllObjects];
+  }
+}
+
+- (void)resetCounters {
+  @synchronized(self) {
+    _hitCount = 0;
+    _missCount = 0;
+    _evictionCount = 0;
+  }
+}
+
+@end
@@ -14,6 +14,8 @@
 
 #import "MDCCollectionViewStyling.h"
 
+@class MDCCollectionViewCellBackgroundCache;
+
 /**
  The MDCCollectionViewStyler class provides a default implementation for a UICollectionView to set
  its style properties.
@@ -32,4 +34,10 @@
 - (nonnull instancetype)initWithCollectionView:(nonnull UICollectionView *)collectionView
     NS_DESIGNATED_INITIALIZER;
 
+/**
+ The cache that cell background images are looked up in and rendered into. Defaults to
+ @c +[MDCCollectionViewCellBackgroundCache sharedCache].
+ */
+@property(nonatomic, strong, nonnull) MDCCollectionViewCellBackgroundCache *backgroundImageCache;
+
 @end
@@ -14,22 +14,13 @@
 
 #import "MDCCollectionViewStyler.h"
 
+#import "MDCCollectionViewCellBackgroundCache.h"
 #import "MDCCollectionViewStylingDelegate.h"
 #import "MaterialCollectionLayoutAttributes.h"
 #import "MaterialPalettes.h"
 
 #include <tgmath.h>
 
-typedef NS_OPTIONS(NSUInteger, BackgroundCacheKey) {
-  BackgroundCacheKeyFlat = 0,
-  BackgroundCacheKeyTop = 1 << 0,
-  BackgroundCacheKeyBottom = 1 << 1,
-  BackgroundCacheKeyCard = 1 << 2,
-  BackgroundCacheKeyGrouped = 1 << 3,
-  BackgroundCacheKeyHighlighted = 1 << 4,
-  BackgroundCacheKeyMax = 1 << 5,
-};
-
 const CGFloat MDCCollectionViewCellStyleCardSectionInset = 8;
 
 /** Cell content view insets for card-style cells */
@@ -80,13 +71,6 @@ NS_INLINE CGRect RectShift(CGRect rect, CGFloat dx, CGFloat dy) {
 
 @interface MDCCollectionViewStyler ()
 
-/**
- A dictionary of NSPointerArray caches, keyed by UIColor, for cached cell background images
- using that background color. Index into the NSPointerArray using the results of
- backgroundCacheKeyForCardStyle:isGroupedStyle:isTop:isBottom:isHighlighted:
- */
-@property(nonatomic, readonly) NSMutableDictionary *cellBackgroundCaches;
-
 /** An set of index paths for items that are inlaid. */
 @property(nonatomic, strong) NSMutableSet *inlaidIndexPathSet;
 
@@ -144,7 +128,7 @@ NS_INLINE CGRect RectShift(CGRect rect, CGFloat dx, CGFloat dy) {
     _animateCellsOnAppearanceDuration = kCollectionViewAnimatedAppearanceDuration;
 
     // Caching.
-    _cellBackgroundCaches = [NSMutableDictionary dictionary];
+    _backgroundImageCache = [MDCCollectionViewCellBackgroundCache sharedCache];
   }
   return self;
 }
@@ -155,6 +139,19 @@ NS_INLINE CGRect RectShift(CGRect rect, CGFloat dx, CGFloat dy) {
   return (self == object) && ![self shouldInvalidateLayoutForStyleChange];
 }
 
+- (void)setDelegate:(id<MDCCollectionViewStylingDelegate>)delegate {
+  if (_delegate == delegate) {
+    return;
+  }
+  _delegate = delegate;
+
+  // The layout can not tell when the delegate changes, so drop the attributes it styled with the
+  // previous one.
+  [self invalidateLayoutForStyleChange];
+  UICollectionViewLayout *layout = self.collectionView.collectionViewLayout;
+  [layout invalidateLayoutWithContext:[[[[layout class] invalidationContextClass] alloc] init]];
+}
+
 #pragma mark - Cell Appearance Animation
 
 - (void)setShouldAnimateCellsOnAppearance:(BOOL)shouldAnimateCellsOnAppearance {
@@ -179,27 +176,77 @@ NS_INLINE CGRect RectShift(CGRect rect, CGFloat dx, CGFloat dy) {
 
 #pragma mark - Caching
 
-- (BackgroundCacheKey)backgroundCacheKeyForCardStyle:(BOOL)isCardStyle
-                                      isGroupedStyle:(BOOL)isGroupedStyle
-                                               isTop:(BOOL)isTop
-                                            isBottom:(BOOL)isBottom
-                                       isHighlighted:(BOOL)isHighlighted {
+- (MDCCollectionViewCellBackgroundStyle)backgroundStyleForCardStyle:(BOOL)isCardStyle
+                                                     isGroupedStyle:(BOOL)isGroupedStyle
+                                                              isTop:(BOOL)isTop
+                                                           isBottom:(BOOL)isBottom
+                                                      isHighlighted:(BOOL)isHighlighted {
   if (!isCardStyle && !isGroupedStyle) {
-    return BackgroundCacheKeyFlat;
+    return MDCCollectionViewCellBackgroundStyleFlat;
   }
-  BackgroundCacheKey options = isTop ? BackgroundCacheKeyTop : 0;
-  options |= isBottom ? BackgroundCacheKeyBottom : 0;
-  options |= isCardStyle ? BackgroundCacheKeyCard : 0;
-  options |= isGroupedStyle ? BackgroundCacheKeyGrouped : 0;
-  options |= isHighlighted ? BackgroundCacheKeyHighlighted : 0;
+  MDCCollectionViewCellBackgroundStyle options =
+      isTop ? MDCCollectionViewCellBackgroundStyleTop : 0;
+  options |= isBottom ? MDCCollectionViewCellBackgroundStyleBottom : 0;
+  options |= isCardStyle ? MDCCollectionViewCellBackgroundStyleCard : 0;
+  options |= isGroupedStyle ? MDCCollectionViewCellBackgroundStyleGrouped : 0;
+  options |= isHighlighted ? MDCCollectionViewCellBackgroundStyleHighlighted : 0;
   NSAssert(isCardStyle != isGroupedStyle, @"Cannot be both card and grouped style");
   return options;
 }
 
-- (NSPointerArray *)cellBackgroundCache {
-  NSPointerArray *cache = [NSPointerArray strongObjectsPointerArray];
-  cache.count = BackgroundCacheKeyMax;
-  return cache;
+- (void)prerenderBackgroundImagesWithAdditionalColors:(NSArray<UIColor *> *)additionalColors
+                                           completion:(void (^)(void))completion {
+  // Gather the styles in use while on the main thread, since they may come from the delegate.
+  NSMutableIndexSet *cellStyles = [NSMutableIndexSet indexSetWithIndex:(NSUInteger)_cellStyle];
+  NSInteger numberOfSections = [_collectionView numberOfSections];
+  for (NSInteger section = 0; section < numberOfSections; section++) {
+    [cellStyles addIndex:(NSUInteger)[self cellStyleAtSectionIndex:section]];
+  }
+  NSMutableOrderedSet<UIColor *> *colors =
+      [NSMutableOrderedSet orderedSetWithObject:_cellBackgroundColor];
+  if (additionalColors) {
+    [colors addObjectsFromArray:additionalColors];
+  }
+  CGFloat scale = [[UIScreen mainScreen] scale];
+  BOOL isGridLayout = (_cellLayoutType == MDCCollectionViewCellLayoutTypeGrid);
+
+  NSMutableArray<MDCCollectionViewCellBackgroundKey *> *keys = [NSMutableArray array];
+  [cellStyles enumerateIndexesUsingBlock:^(NSUInteger cellStyle, __unused BOOL *stop) {
+    BOOL isCardStyle = cellStyle == MDCCollectionViewCellStyleCard;
+    BOOL isGroupedStyle = cellStyle == MDCCollectionViewCellStyleGrouped;
+    CGFloat borderRadius = isCardStyle ? self.cardBorderRadius : 0;
+    NSMutableIndexSet *backgroundStyles = [NSMutableIndexSet indexSet];
+    for (NSInteger position = 0; position < 4; position++) {
+      // Grid backgrounds are always drawn as both the top and bottom of their section.
+      BOOL isTop = isGridLayout || (position & 1);
+      BOOL isBottom = isGridLayout || (position & 2);
+      [backgroundStyles addIndex:[self backgroundStyleForCardStyle:isCardStyle
+                                                    isGroupedStyle:isGroupedStyle
+                                                             isTop:isTop
+                                                          isBottom:isBottom
+                                                     isHighlighted:NO]];
+    }
+    for (UIColor *color in colors) {
+      [backgroundStyles enumerateIndexesUsingBlock:^(NSUInteger style, __unused BOOL *stop) {
+        [keys addObject:[[MDCCollectionViewCellBackgroundKey alloc] initWithColor:color
+                                                                            style:style
+                                                                     borderRadius:borderRadius
+                                                                            scale:scale]];
+      }];
+    }
+  }];
+
+  MDCCollectionViewCellBackgroundCache *cache = _backgroundImageCache;
+  dispatch_async(dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^{
+    for (MDCCollectionViewCellBackgroundKey *key in keys) {
+      if (![cache containsImageForKey:key]) {
+        [cache setImage:[self renderBackgroundImageForKey:key] forKey:key];
+      }
+    }
+    if (completion) {
+      dispatch_async(dispatch_get_main_queue(), completion);
+    }
+  });
 }
 
 #pragma mark - Separators
@@ -240,7 +287,6 @@ NS_INLINE CGRect RectShift(CGRect rect, CGFloat dx, CGFloat dy) {
   if (_cellStyle == cellStyle) {
     return;
   }
-  [_cellBackgroundCaches removeAllObjects];
   [self invalidateLayoutForStyleChange];
   _cellStyle = cellStyle;
 }
@@ -548,16 +594,12 @@ NS_INLINE CGRect RectShift(CGRect rect, CGFloat dx, CGFloat dy) {
 
   BOOL isHighlighted = NO;
 
-  BackgroundCacheKey backgroundCacheKey = [self backgroundCacheKeyForCardStyle:isCardStyle
-                                                                isGroupedStyle:isGroupedStyle
-                                                                         isTop:isTop
-                                                                      isBottom:isBottom
-                                                                 isHighlighted:isHighlighted];
-
-  if (backgroundCacheKey > BackgroundCacheKeyMax) {
-    NSAssert(NO, @"Invalid styler cell background cache key");
-    return nil;
-  }
+  MDCCollectionViewCellBackgroundStyle backgroundStyle =
+      [self backgroundStyleForCardStyle:isCardStyle
+                         isGroupedStyle:isGroupedStyle
+                                  isTop:isTop
+                               isBottom:isBottom
+                          isHighlighted:isHighlighted];
 
   // Get cell color.
   UIColor *backgroundColor = _cellBackgroundColor;
@@ -569,16 +611,32 @@ NS_INLINE CGRect RectShift(CGRect rect, CGFloat dx, CGFloat dy) {
     }
   }
 
-  NSPointerArray *cellBackgroundCache = _cellBackgroundCaches[backgroundColor];
-  if (!cellBackgroundCache) {
-    cellBackgroundCache = [self cellBackgroundCache];
-    _cellBackgroundCaches[backgroundColor] = cellBackgroundCache;
-  } else if ([cellBackgroundCache pointerAtIndex:backgroundCacheKey]) {
-    return (__bridge UIImage *)[cellBackgroundCache pointerAtIndex:backgroundCacheKey];
+  MDCCollectionViewCellBackgroundKey *key =
+      [[MDCCollectionViewCellBackgroundKey alloc] initWithColor:backgroundColor
+                                                          style:backgroundStyle
+                                                   borderRadius:borderRadius
+                                                          scale:[[UIScreen mainScreen] scale]];
+  UIImage *image = [_backgroundImageCache imageForKey:key];
+  if (!image) {
+    image = [self renderBackgroundImageForKey:key];
+    [_backgroundImageCache setImage:image forKey:key];
   }
+  return image;
+}
+
+// Only reads from @c key, so that images can be rendered off the main thread.
+- (UIImage *)renderBackgroundImageForKey:(MDCCollectionViewCellBackgroundKey *)key {
+  MDCCollectionViewCellBackgroundStyle backgroundStyle = key.style;
+  BOOL isTop = (backgroundStyle & MDCCollectionViewCellBackgroundStyleTop) != 0;
+  BOOL isBottom = (backgroundStyle & MDCCollectionViewCellBackgroundStyleBottom) != 0;
+  BOOL isCardStyle = (backgroundStyle & MDCCollectionViewCellBackgroundStyleCard) != 0;
+  BOOL isGroupedStyle = (backgroundStyle & MDCCollectionViewCellBackgroundStyleGrouped) != 0;
+  BOOL isHighlighted = (backgroundStyle & MDCCollectionViewCellBackgroundStyleHighlighted) != 0;
+  CGFloat borderRadius = key.borderRadius;
+  CGFloat scale = key.scale;
 
   CGRect imageRect = CGRectMake(0, 0, kCellImageSize.width, kCellImageSize.height);
-  UIGraphicsBeginImageContextWithOptions(imageRect.size, NO, 0);
+  UIGraphicsBeginImageContextWithOptions(imageRect.size, NO, scale);
 
   CGContextRef cx = UIGraphicsGetCurrentContext();
 
@@ -586,7 +644,7 @@ NS_INLINE CGRect RectShift(CGRect rect, CGFloat dx, CGFloat dy) {
   CGContextClearRect(cx, imageRect);
 
   // Inner background color
-  CGContextSetFillColorWithColor(cx, backgroundColor.CGColor);
+  CGContextSetFillColorWithColor(cx, key.color.CGColor);
 
   CGRect contentFrame = imageRect;
 
@@ -621,7 +679,8 @@ NS_INLINE CGRect RectShift(CGRect rect, CGFloat dx, CGFloat dy) {
                                  isTop:isTop
                               isBottom:isBottom
                                 isCard:(isCardStyle || isGroupedStyle)
-                          borderRadius:borderRadius];
+                          borderRadius:borderRadius
+                                 scale:scale];
     CGContextSetShadowWithColor(cx, kCollectionViewCellDefaultShadowOffset(),
                                 kCollectionViewCellDefaultShadowWidth,
                                 kCollectionViewCellDefaultShadowColor().CGColor);
@@ -635,13 +694,14 @@ NS_INLINE CGRect RectShift(CGRect rect, CGFloat dx, CGFloat dy) {
                                  isTop:isTop
                               isBottom:isBottom
                                 isCard:(isCardStyle || isGroupedStyle)
-                          borderRadius:borderRadius];
+                          borderRadius:borderRadius
+                                 scale:scale];
     CGContextFillPath(cx);
     CGContextRestoreGState(cx);
   }
   // Draw border paths for cells. We want the cell border to overlap the shadow and the content.
   if ((isCardStyle || isGroupedStyle) && !isHighlighted) {
-    CGFloat minPixelOffset = [self minPixelOffset];
+    CGFloat minPixelOffset = [self minPixelOffsetForScale:scale];
     CGRect borderFrame = CGRectInset(contentFrame, -minPixelOffset, -minPixelOffset);
     CGContextSaveGState(cx);
     CGContextSetLineWidth(cx, kCollectionViewCellDefaultBorderWidth);
@@ -651,25 +711,23 @@ NS_INLINE CGRect RectShift(CGRect rect, CGFloat dx, CGFloat dy) {
                              isTop:isTop
                           isBottom:isBottom
                             isCard:isCardStyle
-                      borderRadius:borderRadius];
+                      borderRadius:borderRadius
+                             scale:scale];
     CGContextStrokePath(cx);
     CGContextRestoreGState(cx);
   }
 
   UIImage *image = UIGraphicsGetImageFromCurrentImageContext();
   UIGraphicsEndImageContext();
-  UIImage *resizableImage = [self resizableImage:image];
-  [cellBackgroundCache replacePointerAtIndex:backgroundCacheKey
-                                 withPointer:(__bridge void *)(resizableImage)];
-  return resizableImage;
+  return [self resizableImage:image];
 }
 
 #pragma mark - Private Context Paths
 
 // We want to draw the borders and shadows on single retina-pixel boundaries if possible, but
 // we need to avoid doing this on non-retina devices because it'll look blurry.
-- (CGFloat)minPixelOffset {
-  return 1 / [[UIScreen mainScreen] scale];
+- (CGFloat)minPixelOffsetForScale:(CGFloat)scale {
+  return 1 / scale;
 }
 
 - (UIImage *)resizableImage:(UIImage *)image {
@@ -685,9 +743,10 @@ NS_INLINE CGRect RectShift(CGRect rect, CGFloat dx, CGFloat dy) {
                                isTop:(BOOL)isTop
                             isBottom:(BOOL)isBottom
                               isCard:(BOOL)isCard
-                        borderRadius:(CGFloat)borderRadius {
+                        borderRadius:(CGFloat)borderRadius
+                               scale:(CGFloat)scale {
   // Draw background paths for cell.
-  CGFloat minPixelOffset = (isCard) ? [self minPixelOffset] : 0;
+  CGFloat minPixelOffset = (isCard) ? [self minPixelOffsetForScale:scale] : 0;
   CGFloat minX = CGRectGetMinX(rect) + minPixelOffset;
   CGFloat midX = CGRectGetMidX(rect) + minPixelOffset;
   CGFloat maxX = CGRectGetMaxX(rect) - minPixelOffset;
@@ -725,9 +784,10 @@ NS_INLINE CGRect RectShift(CGRect rect, CGFloat dx, CGFloat dy) {
                            isTop:(BOOL)isTop
                         isBottom:(BOOL)isBottom
                           isCard:(BOOL)isCard
-                    borderRadius:(CGFloat)borderRadius {
+                    borderRadius:(CGFloat)borderRadius
+                           scale:(CGFloat)scale {
   // Draw border paths for cell.
-  CGFloat minPixelOffset = (isCard) ? [self minPixelOffset] : 0;
+  CGFloat minPixelOffset = (isCard) ? [self minPixelOffsetForScale:scale] : 0;
   CGFloat minX = CGRectGetMinX(rect) + minPixelOffset;
   CGFloat midX = CGRectGetMidX(rect) + minPixelOffset;
   CGFloat maxX = CGRectGetMaxX(rect) - minPixelOffset;
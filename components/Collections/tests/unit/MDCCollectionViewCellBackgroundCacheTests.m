@@ -0,0 +1,150 @@
+// Copyright 2015-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#import <XCTest/XCTest.h>
+
+#import "MDCCollectionViewCellBackgroundCache.h"
+#import "MDCCollectionViewStyler.h"
+#import "MaterialCollectionLayoutAttributes.h"
+#import "MaterialCollections.h"
+
+static MDCCollectionViewCellBackgroundKey *KeyWithColor(UIColor *color, CGFloat borderRadius) {
+  return [[MDCCollectionViewCellBackgroundKey alloc]
+      initWithColor:color
+              style:MDCCollectionViewCellBackgroundStyleCard
+       borderRadius:borderRadius
+              scale:2];
+}
+
+static MDCCollectionViewLayoutAttributes *CellAttributes(void) {
+  return [MDCCollectionViewLayoutAttributes
+      layoutAttributesForCellWithIndexPath:[NSIndexPath indexPathForItem:0 inSection:0]];
+}
+
+@interface MDCCollectionViewCellBackgroundCacheTests : XCTestCase
+@property(nonatomic, strong) MDCCollectionViewCellBackgroundCache *cache;
+@property(nonatomic, strong) UICollectionView *collectionView;
+@end
+
+@implementation MDCCollectionViewCellBackgroundCacheTests
+
+- (void)setUp {
+  [super setUp];
+
+  self.cache = [[MDCCollectionViewCellBackgroundCache alloc] initWithCountLimit:8];
+  self.collectionView =
+      [[UICollectionView alloc] initWithFrame:CGRectMake(0, 0, 320, 480)
+                         collectionViewLayout:[[UICollectionViewFlowLayout alloc] init]];
+}
+
+- (void)tearDown {
+  self.collectionView = nil;
+  self.cache = nil;
+
+  [super tearDown];
+}
+
+- (MDCCollectionViewStyler *)cardStyler {
+  MDCCollectionViewStyler *styler =
+      [[MDCCollectionViewStyler alloc] initWithCollectionView:self.collectionView];
+  styler.backgroundImageCache = self.cache;
+  styler.cellStyle = MDCCollectionViewCellStyleCard;
+  return styler;
+}
+
+- (void)testKeysCompareColorsByComponents {
+  // Given
+  UIColor *white = [UIColor colorWithWhite:1 alpha:1];
+  UIColor *rgbWhite = [UIColor colorWithRed:1 green:1 blue:1 alpha:1];
+
+  // Then
+  XCTAssertEqualObjects(KeyWithColor(white, 2), KeyWithColor(rgbWhite, 2));
+  XCTAssertEqual(KeyWithColor(white, 2).hash, KeyWithColor(rgbWhite, 2).hash);
+  XCTAssertNotEqualObjects(KeyWithColor(white, 2), KeyWithColor(white, 4));
+  XCTAssertNotEqualObjects(KeyWithColor(white, 2), KeyWithColor(UIColor.redColor, 2));
+}
+
+- (void)testEvictsLeastRecentlyUsedImage {
+  // Given
+  MDCCollectionViewCellBackgroundCache *cache =
+      [[MDCCollectionViewCellBackgroundCache alloc] initWithCountLimit:2];
+  MDCCollectionViewCellBackgroundKey *first = KeyWithColor(UIColor.redColor, 0);
+  MDCCollectionViewCellBackgroundKey *second = KeyWithColor(UIColor.greenColor, 0);
+  MDCCollectionViewCellBackgroundKey *third = KeyWithColor(UIColor.blueColor, 0);
+  UIImage *image = [[UIImage alloc] init];
+  [cache setImage:image forKey:first];
+  [cache setImage:image forKey:second];
+
+  // When
+  XCTAssertNotNil([cache imageForKey:first]);
+  [cache setImage:image forKey:third];
+
+  // Then
+  XCTAssertEqual(cache.count, 2U);
+  XCTAssertEqual(cache.evictionCount, 1U);
+  XCTAssertTrue([cache containsImageForKey:first]);
+  XCTAssertFalse([cache containsImageForKey:second]);
+  XCTAssertTrue([cache containsImageForKey:third]);
+}
+
+- (void)testStylersShareImagesForTheSameBackground {
+  // Given
+  MDCCollectionViewStyler *firstStyler = [self cardStyler];
+  MDCCollectionViewStyler *secondStyler = [self cardStyler];
+
+  // When
+  UIImage *firstImage = [firstStyler backgroundImageForCellLayoutAttributes:CellAttributes()];
+  UIImage *secondImage = [secondStyler backgroundImageForCellLayoutAttributes:CellAttributes()];
+
+  // Then
+  XCTAssertNotNil(firstImage);
+  XCTAssertEqual(firstImage, secondImage);
+  XCTAssertEqual(self.cache.missCount, 1U);
+  XCTAssertEqual(self.cache.hitCount, 1U);
+}
+
+- (void)testChangingBorderRadiusRendersNewImage {
+  // Given
+  MDCCollectionViewStyler *styler = [self cardStyler];
+  UIImage *image = [styler backgroundImageForCellLayoutAttributes:CellAttributes()];
+
+  // When
+  styler.cardBorderRadius = 8;
+  UIImage *roundedImage = [styler backgroundImageForCellLayoutAttributes:CellAttributes()];
+
+  // Then
+  XCTAssertNotEqual(image, roundedImage);
+  XCTAssertEqual(self.cache.missCount, 2U);
+}
+
+- (void)testPrerenderedImagesAreCacheHits {
+  // Given
+  MDCCollectionViewStyler *styler = [self cardStyler];
+  XCTestExpectation *expectation = [self expectationWithDescription:@"prerendered"];
+
+  // When
+  [styler prerenderBackgroundImagesWithAdditionalColors:@[ UIColor.redColor ]
+                                             completion:^{
+                                               [expectation fulfill];
+                                             }];
+  [self waitForExpectationsWithTimeout:5 handler:nil];
+  UIImage *image = [styler backgroundImageForCellLayoutAttributes:CellAttributes()];
+
+  // Then
+  XCTAssertNotNil(image);
+  XCTAssertEqual(self.cache.count, 8U);
+  XCTAssertEqual(self.cache.hitCount, 1U);
+  XCTAssertEqual(self.cache.missCount, 0U);
+}
+
+@end
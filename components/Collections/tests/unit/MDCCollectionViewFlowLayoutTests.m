@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #import <XCTest/XCTest.h>
+#import "MaterialCollectionLayoutAttributes.h"
 #import "MaterialCollections.h"
 
 @interface FakeUICollectionViewUpdateItem : UICollectionViewUpdateItem {
@@ -50,6 +51,40 @@
 
 @end
 
+static NSString *const kTestCellReuseIdentifier = @"MDCCollectionViewFlowLayoutTestsCell";
+static const NSInteger kBenchmarkItemCount = 10000;
+
+/** A collection view controller showing a single section of plain cells. */
+@interface MDCCollectionViewFlowLayoutTestsController : MDCCollectionViewController
+@property(nonatomic, assign) NSInteger itemCount;
+@end
+
+@implementation MDCCollectionViewFlowLayoutTestsController
+
+- (void)viewDidLoad {
+  [super viewDidLoad];
+
+  [self.collectionView registerClass:[UICollectionViewCell class]
+          forCellWithReuseIdentifier:kTestCellReuseIdentifier];
+}
+
+- (NSInteger)numberOfSectionsInCollectionView:(__unused UICollectionView *)collectionView {
+  return 1;
+}
+
+- (NSInteger)collectionView:(__unused UICollectionView *)collectionView
+     numberOfItemsInSection:(__unused NSInteger)section {
+  return self.itemCount;
+}
+
+- (UICollectionViewCell *)collectionView:(UICollectionView *)collectionView
+                  cellForItemAtIndexPath:(NSIndexPath *)indexPath {
+  return [collectionView dequeueReusableCellWithReuseIdentifier:kTestCellReuseIdentifier
+                                                   forIndexPath:indexPath];
+}
+
+@end
+
 @interface MDCCollectionViewFlowLayoutTests : XCTestCase <UICollectionViewDataSource>
 
 @end
@@ -256,6 +291,218 @@
   XCTAssertNil(section0Attributes);
 }
 
+#pragma mark - Decoration views
+
+// Returns the union of the item frames of a section, as the grid decoration view should cover.
+static CGRect UnionOfItemFrames(UICollectionViewLayout *layout, NSInteger section) {
+  CGRect frame = CGRectNull;
+  for (NSInteger item = 0; item < 2; ++item) {
+    NSIndexPath *indexPath = [NSIndexPath indexPathForItem:item inSection:section];
+    frame = CGRectUnion(frame, [layout layoutAttributesForItemAtIndexPath:indexPath].frame);
+  }
+  return frame;
+}
+
+- (void)testDecorationViewFrameIsUnionOfSectionItemFrames {
+  // Given
+  MDCCollectionViewFlowLayout *layout = [[MDCCollectionViewFlowLayout alloc] init];
+  layout.itemSize = CGSizeMake(40, 40);
+  UICollectionView *collectionView =
+      [[UICollectionView alloc] initWithFrame:CGRectMake(0, 0, 100, 400)
+                         collectionViewLayout:layout];
+  collectionView.dataSource = self;
+  [collectionView layoutIfNeeded];
+
+  for (NSInteger section = 0; section < 2; ++section) {
+    // When
+    NSIndexPath *indexPath = [NSIndexPath indexPathForItem:0 inSection:section];
+    UICollectionViewLayoutAttributes *decorationAttributes =
+        [layout layoutAttributesForDecorationViewOfKind:@"MDCCollectionGridDecorationView"
+                                            atIndexPath:indexPath];
+
+    // Then
+    XCTAssertTrue(CGRectEqualToRect(decorationAttributes.frame, UnionOfItemFrames(layout, section)),
+                  @"Section %ld: %@", (long)section,
+                  NSStringFromCGRect(decorationAttributes.frame));
+  }
+}
+
+- (void)testDecorationViewFrameIsUpdatedAfterInvalidation {
+  // Given
+  MDCCollectionViewFlowLayout *layout = [[MDCCollectionViewFlowLayout alloc] init];
+  layout.itemSize = CGSizeMake(40, 40);
+  UICollectionView *collectionView =
+      [[UICollectionView alloc] initWithFrame:CGRectMake(0, 0, 100, 400)
+                         collectionViewLayout:layout];
+  collectionView.dataSource = self;
+  [collectionView layoutIfNeeded];
+  NSIndexPath *indexPath = [NSIndexPath indexPathForItem:0 inSection:1];
+  [layout layoutAttributesForDecorationViewOfKind:@"MDCCollectionGridDecorationView"
+                                      atIndexPath:indexPath];
+
+  // When
+  layout.itemSize = CGSizeMake(30, 60);
+  [collectionView layoutIfNeeded];
+  UICollectionViewLayoutAttributes *decorationAttributes =
+      [layout layoutAttributesForDecorationViewOfKind:@"MDCCollectionGridDecorationView"
+                                          atIndexPath:indexPath];
+
+  // Then
+  XCTAssertTrue(CGRectEqualToRect(decorationAttributes.frame, UnionOfItemFrames(layout, 1)),
+                @"%@", NSStringFromCGRect(decorationAttributes.frame));
+}
+
+#pragma mark - Styled attributes
+
+- (MDCCollectionViewFlowLayoutTestsController *)loadedControllerWithItemCount:(NSInteger)itemCount {
+  MDCCollectionViewFlowLayoutTestsController *controller =
+      [[MDCCollectionViewFlowLayoutTestsController alloc] init];
+  controller.itemCount = itemCount;
+  controller.view.frame = CGRectMake(0, 0, 320, 480);
+  [controller.collectionView layoutIfNeeded];
+  return controller;
+}
+
+- (void)testRepeatedQueriesReuseStyledAttributes {
+  // Given
+  MDCCollectionViewFlowLayoutTestsController *controller = [self loadedControllerWithItemCount:50];
+  UICollectionViewLayout *layout = controller.collectionViewLayout;
+  CGRect rect = CGRectMake(0, 0, 320, 480);
+  NSArray<UICollectionViewLayoutAttributes *> *firstAttributes =
+      [layout layoutAttributesForElementsInRect:rect];
+
+  // When
+  NSArray<UICollectionViewLayoutAttributes *> *secondAttributes =
+      [layout layoutAttributesForElementsInRect:rect];
+
+  // Then
+  XCTAssertGreaterThan(firstAttributes.count, 0U);
+  XCTAssertEqual(firstAttributes.count, secondAttributes.count);
+  for (NSUInteger i = 0; i < firstAttributes.count; ++i) {
+    XCTAssertEqual(firstAttributes[i], secondAttributes[i]);
+  }
+}
+
+- (void)testStylerChangeRestylesAttributes {
+  // Given
+  MDCCollectionViewFlowLayoutTestsController *controller = [self loadedControllerWithItemCount:50];
+  UICollectionViewLayout *layout = controller.collectionViewLayout;
+  NSIndexPath *indexPath = [NSIndexPath indexPathForItem:0 inSection:0];
+  [layout layoutAttributesForItemAtIndexPath:indexPath];
+
+  // When
+  controller.styler.separatorColor = UIColor.redColor;
+  MDCCollectionViewLayoutAttributes *attributes =
+      (MDCCollectionViewLayoutAttributes *)[layout layoutAttributesForItemAtIndexPath:indexPath];
+
+  // Then
+  XCTAssertEqualObjects(attributes.separatorColor, UIColor.redColor);
+}
+
+- (void)testCardBorderRadiusChangeRestylesAttributes {
+  // Given
+  MDCCollectionViewFlowLayoutTestsController *controller = [self loadedControllerWithItemCount:50];
+  UICollectionViewLayout *layout = controller.collectionViewLayout;
+  controller.styler.cellStyle = MDCCollectionViewCellStyleCard;
+  NSIndexPath *indexPath = [NSIndexPath indexPathForItem:0 inSection:0];
+  UICollectionViewLayoutAttributes *attributes =
+      [layout layoutAttributesForItemAtIndexPath:indexPath];
+
+  // When
+  controller.styler.cardBorderRadius = 12;
+
+  // Then
+  XCTAssertNotEqual([layout layoutAttributesForItemAtIndexPath:indexPath], attributes);
+}
+
+- (void)testStylerDelegateChangeRestylesAttributes {
+  // Given
+  MDCCollectionViewFlowLayoutTestsController *controller = [self loadedControllerWithItemCount:50];
+  UICollectionViewLayout *layout = controller.collectionViewLayout;
+  NSIndexPath *indexPath = [NSIndexPath indexPathForItem:0 inSection:0];
+  UICollectionViewLayoutAttributes *attributes =
+      [layout layoutAttributesForItemAtIndexPath:indexPath];
+
+  // When
+  controller.styler.delegate = nil;
+
+  // Then
+  XCTAssertNotEqual([layout layoutAttributesForItemAtIndexPath:indexPath], attributes);
+}
+
+- (void)testGridBackgroundDoesNotChangeStyledAttributes {
+  // Given
+  MDCCollectionViewFlowLayoutTestsController *controller = [self loadedControllerWithItemCount:50];
+  UICollectionViewLayout *layout = controller.collectionViewLayout;
+  controller.styler.cellLayoutType = MDCCollectionViewCellLayoutTypeGrid;
+  controller.styler.cellStyle = MDCCollectionViewCellStyleGrouped;
+  NSIndexPath *indexPath = [NSIndexPath indexPathForItem:0 inSection:0];
+  MDCCollectionViewLayoutAttributes *attributes =
+      (MDCCollectionViewLayoutAttributes *)[layout layoutAttributesForItemAtIndexPath:indexPath];
+  UIImage *backgroundImage = attributes.backgroundImage;
+
+  // When
+  [layout layoutAttributesForElementsInRect:CGRectMake(0, 0, 320, 480)];
+
+  // Then
+  XCTAssertEqual([layout layoutAttributesForItemAtIndexPath:indexPath], attributes);
+  XCTAssertEqual(attributes.backgroundImage, backgroundImage);
+}
+
+- (void)testEditingRestylesAttributes {
+  // Given
+  MDCCollectionViewFlowLayoutTestsController *controller = [self loadedControllerWithItemCount:50];
+  UICollectionViewLayout *layout = controller.collectionViewLayout;
+  NSIndexPath *indexPath = [NSIndexPath indexPathForItem:0 inSection:0];
+  MDCCollectionViewLayoutAttributes *attributes =
+      (MDCCollectionViewLayoutAttributes *)[layout layoutAttributesForItemAtIndexPath:indexPath];
+  XCTAssertFalse(attributes.editing);
+
+  // When
+  controller.editor.editing = YES;
+  attributes =
+      (MDCCollectionViewLayoutAttributes *)[layout layoutAttributesForItemAtIndexPath:indexPath];
+
+  // Then
+  XCTAssertTrue(attributes.editing);
+}
+
+- (void)testScrollingWhileEditingKeepsStyledAttributes {
+  // Given
+  MDCCollectionViewFlowLayoutTestsController *controller = [self loadedControllerWithItemCount:50];
+  UICollectionViewLayout *layout = controller.collectionViewLayout;
+  controller.editor.editing = YES;
+  NSIndexPath *indexPath = [NSIndexPath indexPathForItem:0 inSection:0];
+  UICollectionViewLayoutAttributes *attributes =
+      [layout layoutAttributesForItemAtIndexPath:indexPath];
+  CGRect scrolledBounds = CGRectOffset(controller.collectionView.bounds, 0, 20);
+
+  // When
+  XCTAssertTrue([layout shouldInvalidateLayoutForBoundsChange:scrolledBounds]);
+  [layout invalidateLayoutWithContext:[layout invalidationContextForBoundsChange:scrolledBounds]];
+
+  // Then
+  XCTAssertEqual([layout layoutAttributesForItemAtIndexPath:indexPath], attributes);
+}
+
+#pragma mark - Performance
+
+// Queries the attributes of a 10,000 item list one half screen at a time, from top to bottom, as
+// scrolling it end to end does.
+- (void)testPerformanceScrollLargeListEndToEnd {
+  MDCCollectionViewFlowLayoutTestsController *controller =
+      [self loadedControllerWithItemCount:kBenchmarkItemCount];
+  UICollectionViewLayout *layout = controller.collectionViewLayout;
+  CGSize viewportSize = controller.collectionView.bounds.size;
+  CGFloat contentHeight = layout.collectionViewContentSize.height;
+  [self measureBlock:^{
+    for (CGFloat offset = 0; offset < contentHeight; offset += viewportSize.height / 2) {
+      CGRect rect = (CGRect){CGPointMake(0, offset), viewportSize};
+      [layout layoutAttributesForElementsInRect:rect];
+    }
+  }];
+}
+
 #pragma mark - <UICollectionViewDataSource>
 
 // Never called in these tests
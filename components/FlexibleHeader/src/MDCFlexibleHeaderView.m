@@ -18,6 +18,7 @@
 #import "MaterialApplication.h"
 #import "MaterialUIMetrics.h"
 #import "private/MDCFlexibleHeaderMinMaxHeight.h"
+#import "private/MDCFlexibleHeaderPhysics.h"
 #import "private/MDCFlexibleHeaderTopSafeArea.h"
 #import "private/MDCFlexibleHeaderView+Private.h"
 #import "private/MDCStatusBarShifter.h"
@@ -33,29 +34,15 @@ static const float kDefaultVisibleShadowOpacity = (float)0.4;
 // hidden.
 static const float kContentHidingThreshold = (float)0.5;
 
-// This length defines the moment at which the shadow will be fully visible as the header shifts
-// on-screen.
-static const CGFloat kShadowScaleLength = 8;
-
 // Duration of the UIKit animation that occurs when changing the tracking scroll view.
 static const NSTimeInterval kTrackingScrollViewDidChangeAnimationDuration = 0.2;
 
-// The epsilon used to determine when we've arrived at the destination while shifting the header
-// on/off-screen with the display link.
-static const float kShiftEpsilon = (float)0.1;
-
 // The epsilon used when comparing height values.
 static const CGFloat kHeightEpsilon = (CGFloat)0.001;
 
 // The epsilon used when comparing content offset values.
 static const CGFloat kContentOffsetEpsilon = (CGFloat)0.001;
 
-// The minimum delta y before we change the scroll direction.
-static const CGFloat kDeltaYSlop = 5;
-
-// Affects how fast the header shifts on/off-screen while animating. Bigger value = faster.
-static const CGFloat kAttachmentCoefficient = 12;
-
 // The amount the user needs to scroll back before the header starts shifting back on-screen.
 static const CGFloat kMaxAnchorLengthFullSwipe = 175;
 static const CGFloat kMaxAnchorLengthQuickSwipe = 25;
@@ -141,22 +128,15 @@ static inline MDCFlexibleHeaderShiftBehavior ShiftBehaviorForCurrentAppContext(
   NSMapTable *_trackedScrollViews;  // {UIScrollView:MDCFlexibleHeaderScrollViewInfo}
   MDCFlexibleHeaderScrollViewInfo *_trackingInfo;
 
-  // The ideal visibility state of the header. This may not match the present visibility if the user
-  // is interacting with the header or if we're presently animating it.
-  BOOL _wantsToBeHidden;
-
   // Shift behavior state
 
+  // The accumulator, scroll direction and ideal visibility of the header. See
+  // MDCFlexibleHeaderPhysicsState.
+  MDCFlexibleHeaderPhysicsState _physics;
+
   // Prevents delta calculations on first update pass.
   BOOL _shiftAccumulatorLastContentOffsetIsValid;
-  // When the header can slide off-screen, a positive value indicates how off-screen the header is.
-  // Essentially: view's top edge = -_shiftAccumulator
-  // When canAlwaysExpandToMaximumHeight is enabled, a negative value indicates how expanded the
-  // header is.
-  // Essentially: view's height += -_shiftAccumulator
-  CGFloat _shiftAccumulator;
   CGPoint _shiftAccumulatorLastContentOffset;  // Stores our last delta'd content offset.
-  CGFloat _shiftAccumulatorDeltaY;
   CADisplayLink *_shiftAccumulatorDisplayLink;
 
   BOOL _interfaceOrientationIsChanging;
@@ -485,7 +465,7 @@ static inline MDCFlexibleHeaderShiftBehavior ShiftBehaviorForCurrentAppContext(
     bounds.size.height = self.minMaxHeight.minimumHeightWithTopSafeArea;
     self.bounds = bounds;
     CGPoint position = self.center;
-    position.y = -MIN([self fhv_accumulatorMax], _shiftAccumulator);
+    position.y = -(CGFloat)MIN([self fhv_accumulatorMax], _physics.accumulator);
     position.y += self.bounds.size.height / 2;
     self.center = position;
     [self.delegate flexibleHeaderViewFrameDidChange:self];
@@ -721,13 +701,13 @@ static inline MDCFlexibleHeaderShiftBehavior ShiftBehaviorForCurrentAppContext(
 }
 
 - (BOOL)fhv_isPartiallyShifted {
-  return ([self fhv_isDetachedFromTopOfContent] && _shiftAccumulator > 0 &&
-          _shiftAccumulator < [self fhv_accumulatorMax]);
+  return ([self fhv_isDetachedFromTopOfContent] && _physics.accumulator > 0 &&
+          _physics.accumulator < [self fhv_accumulatorMax]);
 }
 
 - (BOOL)fhv_isPartiallyExpanded {
-  return ([self fhv_isDetachedFromTopOfContent] && _shiftAccumulator < 0 &&
-          _shiftAccumulator > -(self.maximumHeight - self.minimumHeight));
+  return ([self fhv_isDetachedFromTopOfContent] && _physics.accumulator < 0 &&
+          _physics.accumulator > -(self.maximumHeight - self.minimumHeight));
 }
 
 // The flexible header is "in front of" the content.
@@ -750,53 +730,26 @@ static inline MDCFlexibleHeaderShiftBehavior ShiftBehaviorForCurrentAppContext(
 
 // Given the current frame, calculates the scroll phase, value, and percentage.
 - (void)fhv_recalculatePhase {
-  CGRect frame = self.frame;
-
+  MDCFlexibleHeaderPhysicsConfiguration configuration = [self fhv_physicsConfiguration];
   CGFloat topEdge = self.center.y - self.bounds.size.height / 2;
-
-  if (topEdge < 0) {
-    _scrollPhase = MDCFlexibleHeaderScrollPhaseShifting;
-    _scrollPhaseValue = topEdge + self.minMaxHeight.minimumHeightWithTopSafeArea;
-    CGFloat adjustedHeight = self.minMaxHeight.minimumHeightWithTopSafeArea;
-    if ([self fhv_shouldCollapseToStatusBar]) {
-      CGFloat statusBarHeight =
-          [UIApplication mdc_safeSharedApplication].statusBarFrame.size.height;
-      adjustedHeight -= statusBarHeight;
-    }
-    if (adjustedHeight > 0) {
-      _scrollPhasePercentage = -topEdge / adjustedHeight;
-    } else {
-      _scrollPhasePercentage = 0;
-    }
-
-    return;
-  }
-
-  _scrollPhaseValue = frame.size.height;
-
-  if (frame.size.height < self.minMaxHeight.maximumHeightWithTopSafeArea) {
-    _scrollPhase = MDCFlexibleHeaderScrollPhaseCollapsing;
-
-    CGFloat heightLength = self.minMaxHeight.maximumHeightWithTopSafeArea -
-                           self.minMaxHeight.minimumHeightWithTopSafeArea;
-    if (heightLength > 0) {
-      _scrollPhasePercentage =
-          (frame.size.height - self.minMaxHeight.minimumHeightWithTopSafeArea) / heightLength;
-    } else {
-      _scrollPhasePercentage = 0;
-    }
-
-    return;
-  }
-
-  _scrollPhase = MDCFlexibleHeaderScrollPhaseOverExtending;
-  if (self.minMaxHeight.maximumHeightWithTopSafeArea > 0) {
-    _scrollPhasePercentage =
-        1 + (frame.size.height - self.minMaxHeight.maximumHeightWithTopSafeArea) /
-                self.minMaxHeight.maximumHeightWithTopSafeArea;
-  } else {
-    _scrollPhasePercentage = 0;
-  }
+  double phaseValue;
+  double phasePercentage;
+  MDCFlexibleHeaderPhysicsPhase phase = MDCFlexibleHeaderPhysicsPhaseForFrame(
+      &configuration, topEdge, self.frame.size.height, &phaseValue, &phasePercentage);
+
+  switch (phase) {
+    case MDCFlexibleHeaderPhysicsPhaseShifting:
+      _scrollPhase = MDCFlexibleHeaderScrollPhaseShifting;
+      break;
+    case MDCFlexibleHeaderPhysicsPhaseCollapsing:
+      _scrollPhase = MDCFlexibleHeaderScrollPhaseCollapsing;
+      break;
+    case MDCFlexibleHeaderPhysicsPhaseOverExtending:
+      _scrollPhase = MDCFlexibleHeaderScrollPhaseOverExtending;
+      break;
+  }
+  _scrollPhaseValue = (CGFloat)phaseValue;
+  _scrollPhasePercentage = (CGFloat)phasePercentage;
 }
 
 #pragma mark Display Link
@@ -833,49 +786,24 @@ static inline MDCFlexibleHeaderShiftBehavior ShiftBehaviorForCurrentAppContext(
 }
 
 - (void)fhv_shiftAccumulatorDisplayLinkDidFire:(CADisplayLink *)displayLink {
-  // Erase any scrollback that was injected into the accumulator by capping it back down.
-  _shiftAccumulator = MIN([self fhv_accumulatorMax], _shiftAccumulator);
-
-  CGFloat destination;
-  if (self.canAlwaysExpandToMaximumHeight) {
-    if (_shiftAccumulator > 0) {  // Shifted
-      destination = _wantsToBeHidden ? [self fhv_accumulatorMax] : 0;
-
-    } else if (_shiftAccumulator < 0) {  // Expanded
-      destination = _wantsToBeHidden ? 0 : [self fhv_accumulatorMin];
-
-    } else {
-      destination = 0;
-    }
-
-  } else {
-    destination = _wantsToBeHidden ? [self fhv_accumulatorMax] : 0;
-  }
-
-  CGFloat distanceToDestination = destination - _shiftAccumulator;
-
   NSTimeInterval duration = displayLink.duration;
 
 #if TARGET_IPHONE_SIMULATOR
   duration /= [self fhv_dragCoefficient];
 #endif
 
-  // This is a simple "force" that's stronger the further we are from the destination.
-  _shiftAccumulator += (CGFloat)(kAttachmentCoefficient * distanceToDestination * duration);
+  MDCFlexibleHeaderPhysicsConfiguration configuration = [self fhv_physicsConfiguration];
+  CGFloat headerHeight = -[self fhv_contentOffsetWithoutInjectedTopInset];
+  BOOL didSettle =
+      MDCFlexibleHeaderPhysicsSettle(&_physics, &configuration, headerHeight, duration);
 
   if (self.canAlwaysExpandToMaximumHeight) {
-    _shiftAccumulator =
-        MAX([self fhv_accumulatorMin], MIN([self fhv_accumulatorMax], _shiftAccumulator));
-    [_statusBarShifter setOffset:MAX(0, _shiftAccumulator)];
+    [_statusBarShifter setOffset:(CGFloat)MAX(0, _physics.accumulator)];
   } else {
-    _shiftAccumulator = MAX(0, MIN([self fhv_accumulatorMax], _shiftAccumulator));
-    [_statusBarShifter setOffset:_shiftAccumulator];
+    [_statusBarShifter setOffset:(CGFloat)_physics.accumulator];
   }
 
-  // Have we reached our destination?
-  if (fabs(destination - _shiftAccumulator) <= kShiftEpsilon) {
-    _shiftAccumulator = destination;
-
+  if (didSettle) {
     [self fhv_stopDisplayLink];
   }
 
@@ -896,38 +824,11 @@ static inline MDCFlexibleHeaderShiftBehavior ShiftBehaviorForCurrentAppContext(
 
   CGRect frame = self.frame;
 
-  CGFloat frameBottomEdge = [self fhv_projectedHeaderBottomEdge];
-  frameBottomEdge = MAX(0, MIN(kShadowScaleLength, frameBottomEdge));
-  CGFloat boundedAccumulator;
-  if (self.canAlwaysExpandToMaximumHeight) {
-    boundedAccumulator = MAX(0, MIN([self fhv_accumulatorMax], _shiftAccumulator));
-  } else {
-    boundedAccumulator = MIN([self fhv_accumulatorMax], _shiftAccumulator);
-  }
-
-  CGFloat shadowIntensity;
-  if (self.hidesStatusBarWhenCollapsed) {
-    // Calculate the desired shadow strength for the offset & accumulator and then take the
-    // weakest strength.
-    CGFloat accumulator =
-        MAX(0, MIN(kShadowScaleLength,
-                   self.minMaxHeight.minimumHeightWithTopSafeArea - boundedAccumulator));
-    if (self.isInFrontOfInfiniteContent) {
-      // When in front of infinite content we only care to hide the shadow when our header is
-      // off-screen.
-      shadowIntensity = MAX(0, MIN(1, accumulator / kShadowScaleLength));
-
-    } else {
-      // When over non-infinite content we also want to hide the shadow when we're anchored to the
-      // top of our content.
-      shadowIntensity = MAX(0, MIN(1, MIN(accumulator, frameBottomEdge) / kShadowScaleLength));
-    }
-  } else if (self.isInFrontOfInfiniteContent) {
-    shadowIntensity = 1;
-  } else {
-    // Adjust the opacity as the bottom edge of the header increasingly overlaps the contents
-    shadowIntensity = frameBottomEdge / kShadowScaleLength;
-  }
+  MDCFlexibleHeaderPhysicsConfiguration configuration = [self fhv_physicsConfiguration];
+  CGFloat boundedAccumulator =
+      (CGFloat)MDCFlexibleHeaderPhysicsBoundedAccumulator(&_physics, &configuration);
+  CGFloat shadowIntensity = (CGFloat)MDCFlexibleHeaderPhysicsShadowIntensity(
+      &_physics, &configuration, [self fhv_projectedHeaderBottomEdge]);
 
   if (_defaultShadowLayer.hidden && _customShadowLayer.hidden) {
     self.layer.shadowOpacity = (float)(_visibleShadowOpacity * shadowIntensity);
@@ -967,25 +868,24 @@ static inline MDCFlexibleHeaderShiftBehavior ShiftBehaviorForCurrentAppContext(
 
 - (CGFloat)fhv_accumulatorMin {
   CGFloat headerHeight = -[self fhv_contentOffsetWithoutInjectedTopInset];
-
-  CGFloat lowerBound;
-
-  if (self.canAlwaysExpandToMaximumHeight) {
-    CGFloat maxExpansion;
-    if (headerHeight < self.minMaxHeight.minimumHeightWithTopSafeArea) {
-      // The header is detached from the content and able to fully expand.
-      maxExpansion = self.maximumHeight - self.minimumHeight;
-    } else {
-      // We're now attached to the content and need to constrain our possible expansion.
-      maxExpansion = self.minMaxHeight.maximumHeightWithTopSafeArea - headerHeight;
-    }
-    // Expansion is tracked via negative accumulation.
-    lowerBound = MIN(0, -maxExpansion);
-  } else {
-    lowerBound = 0;
-  }
-
-  return lowerBound;
+  MDCFlexibleHeaderPhysicsConfiguration configuration = [self fhv_physicsConfiguration];
+  return (CGFloat)MDCFlexibleHeaderPhysicsAccumulatorMin(&configuration, headerHeight);
+}
+
+// Captures the properties of the header that the scroll physics depend on.
+- (MDCFlexibleHeaderPhysicsConfiguration)fhv_physicsConfiguration {
+  MDCFlexibleHeaderPhysicsConfiguration configuration;
+  configuration.minimumHeight = self.minMaxHeight.minimumHeightWithTopSafeArea;
+  configuration.maximumHeight = self.minMaxHeight.maximumHeightWithTopSafeArea;
+  configuration.maximumExpansion = self.maximumHeight - self.minimumHeight;
+  configuration.accumulatorMax = [self fhv_accumulatorMax];
+  configuration.anchorLength = [self fhv_anchorLength];
+  configuration.canAlwaysExpandToMaximumHeight = self.canAlwaysExpandToMaximumHeight;
+  configuration.canShiftOffscreen = [self fhv_canShiftOffscreen];
+  configuration.canOverExtend = _canOverExtend && !UIAccessibilityIsVoiceOverRunning();
+  configuration.hidesStatusBarWhenCollapsed = self.hidesStatusBarWhenCollapsed;
+  configuration.isInFrontOfInfiniteContent = self.isInFrontOfInfiniteContent;
+  return configuration;
 }
 
 - (void)fhv_updateLayout {
@@ -1013,105 +913,22 @@ static inline MDCFlexibleHeaderShiftBehavior ShiftBehaviorForCurrentAppContext(
     [self fhv_stopDisplayLink];
   }
 
-  if (_shiftAccumulatorLastContentOffsetIsValid) {
-    // We track the last direction for our target offset behavior.
-    CGFloat deltaY = [self fhv_boundedContentOffset].y - _shiftAccumulatorLastContentOffset.y;
-
-    if (_shiftAccumulatorDeltaY * deltaY < 0) {
-      // Direction has changed.
-      _shiftAccumulatorDeltaY = 0;
-    }
-    _shiftAccumulatorDeltaY += deltaY;
-
-    // Keeps track of the last direction the user moved their finger in.
-    if (_trackingScrollView.isTracking) {
-      if (_shiftAccumulatorDeltaY > kDeltaYSlop) {
-        _wantsToBeHidden = YES;
-      } else if (_shiftAccumulatorDeltaY < -kDeltaYSlop) {
-        _wantsToBeHidden = NO;
-      }
-    }
-
-    if (![self fhv_isOverExtendingBottom] && !_shiftAccumulatorDisplayLink) {
-      if (!self.canAlwaysExpandToMaximumHeight) {
-        // When we're not allowed to shift offscreen, only allow the header to shift further
-        // on-screen in case it was previously off-screen due to a behavior change.
-        if (![self fhv_canShiftOffscreen]) {
-          deltaY = MIN(0, deltaY);
-        }
-      }
-
-      // When scrubbing we only allow the header to shrink and shift off-screen.
-      if (self.trackingScrollViewIsBeingScrubbed) {
-        deltaY = MAX(0, deltaY);
-      }
-
-      if (self.canAlwaysExpandToMaximumHeight) {
-        // When still attached to the top content, don't accumulate negatively.
-        if (headerHeight >= self.minMaxHeight.minimumHeightWithTopSafeArea) {
-          deltaY = MAX(0, deltaY);
-        }
-      }
-
-      // Check if our delta y will cause us to cross the boundary from shrinking to shifting and,
-      // if so, cap the deltaY to only the overshoot, otherwise the header will overshift.
-
-      // headerHeight and deltaY are in inverted coordinate spaces, so when we do
-      // headerHeight + deltaY we're calculating where the headerHeight was _before_ this update.
-
-      CGFloat previousHeaderHeight = headerHeight + deltaY;
+  MDCFlexibleHeaderPhysicsConfiguration configuration = [self fhv_physicsConfiguration];
 
-      // Overshoot coming in
-      if (headerHeight < self.minMaxHeight.minimumHeightWithTopSafeArea &&
-          previousHeaderHeight > self.minMaxHeight.minimumHeightWithTopSafeArea) {
-        deltaY = self.minMaxHeight.minimumHeightWithTopSafeArea - headerHeight;
-
-        // Overshoot going out
-      } else if (headerHeight > self.minMaxHeight.minimumHeightWithTopSafeArea &&
-                 previousHeaderHeight < self.minMaxHeight.minimumHeightWithTopSafeArea) {
-        deltaY = (headerHeight + deltaY) - self.minMaxHeight.minimumHeightWithTopSafeArea;
-      }
-
-      // Calculate the upper bound of the accumulator based on what phase we're in.
-
-      CGFloat upperBound;
-
-      if (self.canAlwaysExpandToMaximumHeight && ![self fhv_canShiftOffscreen]) {
-        // Don't allow any shifting.
-        upperBound = 0;
-      } else if (headerHeight < 0) {
-        // Header is shifting while detached from content.
-        upperBound = [self fhv_accumulatorMax] + [self fhv_anchorLength];
-      } else if (headerHeight < self.minMaxHeight.minimumHeightWithTopSafeArea) {
-        // Header is shifting while attached to content.
-        upperBound = [self fhv_accumulatorMax];
-      } else {
-        // Header is not shifting.
-        upperBound = 0;
-      }
-
-      // Ensure that we don't lose any deltaY by first capping the accumulator within its valid
-      // range.
-      _shiftAccumulator = MIN(upperBound, _shiftAccumulator);
-
-      // Accumulate the deltaY.
-      if (self.canAlwaysExpandToMaximumHeight) {
-        CGFloat lowerBound = [self fhv_accumulatorMin];
-        _shiftAccumulator = MAX(lowerBound, MIN(upperBound, _shiftAccumulator + deltaY));
-      } else {
-        _shiftAccumulator = MAX(0, MIN(upperBound, _shiftAccumulator + deltaY));
-      }
-    }
+  if (_shiftAccumulatorLastContentOffsetIsValid) {
+    MDCFlexibleHeaderPhysicsScrollSample sample;
+    sample.deltaY = [self fhv_boundedContentOffset].y - _shiftAccumulatorLastContentOffset.y;
+    sample.headerHeight = headerHeight;
+    sample.isTracking = _trackingScrollView.isTracking;
+    sample.isScrubbing = self.trackingScrollViewIsBeingScrubbed;
+    sample.canAccumulate = ![self fhv_isOverExtendingBottom] && !_shiftAccumulatorDisplayLink;
+    MDCFlexibleHeaderPhysicsAccumulateScroll(&_physics, &configuration, sample);
   }
 
   if (!self.canAlwaysExpandToMaximumHeight) {
     CGRect bounds = self.bounds;
-    if (_canOverExtend && !UIAccessibilityIsVoiceOverRunning()) {
-      bounds.size.height = MAX(self.minMaxHeight.minimumHeightWithTopSafeArea, headerHeight);
-    } else {
-      bounds.size.height = MAX(self.minMaxHeight.minimumHeightWithTopSafeArea,
-                               MIN(self.minMaxHeight.maximumHeightWithTopSafeArea, headerHeight));
-    }
+    bounds.size.height =
+        (CGFloat)MDCFlexibleHeaderPhysicsHeight(&_physics, &configuration, headerHeight);
     self.bounds = bounds;
   }
 
@@ -1133,21 +950,15 @@ static inline MDCFlexibleHeaderShiftBehavior ShiftBehaviorForCurrentAppContext(
 
 // Commit the current shiftOffscreenAccumulator value to the view's position.
 - (void)fhv_commitAccumulatorToFrame {
+  MDCFlexibleHeaderPhysicsConfiguration configuration = [self fhv_physicsConfiguration];
+
   if (self.canAlwaysExpandToMaximumHeight) {
     CGFloat offsetWithoutInset = [self fhv_contentOffsetWithoutInjectedTopInset];
     CGFloat headerHeight = -offsetWithoutInset;
     CGRect bounds = self.bounds;
-
-    CGFloat additionalHeightInjection = MAX(0, -_shiftAccumulator);
-
-    if (_canOverExtend && !UIAccessibilityIsVoiceOverRunning()) {
-      bounds.size.height = MAX(self.minMaxHeight.minimumHeightWithTopSafeArea, headerHeight) +
-                           additionalHeightInjection;
-    } else {
-      bounds.size.height = (MAX(self.minMaxHeight.minimumHeightWithTopSafeArea,
-                                MIN(self.minMaxHeight.maximumHeightWithTopSafeArea, headerHeight)) +
-                            additionalHeightInjection);
-    }
+    // The physics add any expansion held in the accumulator to the height.
+    bounds.size.height =
+        (CGFloat)MDCFlexibleHeaderPhysicsHeight(&_physics, &configuration, headerHeight);
 
     // Avoid excessive writes - the default behavior of the flexible header has minimal height
     // adjustment behavior (basically only when over-extending).
@@ -1157,12 +968,8 @@ static inline MDCFlexibleHeaderShiftBehavior ShiftBehaviorForCurrentAppContext(
   }
 
   CGPoint position = self.center;
-  CGFloat shiftOffset;
-  if (self.canAlwaysExpandToMaximumHeight) {
-    shiftOffset = MAX(0, MIN([self fhv_accumulatorMax], _shiftAccumulator));
-  } else {
-    shiftOffset = MIN([self fhv_accumulatorMax], _shiftAccumulator);
-  }
+  CGFloat shiftOffset =
+      (CGFloat)MDCFlexibleHeaderPhysicsBoundedAccumulator(&_physics, &configuration);
   // Offset the frame.
   position.y = -shiftOffset;
   position.y += self.bounds.size.height / 2;
@@ -1181,7 +988,7 @@ static inline MDCFlexibleHeaderShiftBehavior ShiftBehaviorForCurrentAppContext(
     view.alpha = 1 - percentShiftedAlongThreshold;
   }
 
-  [_statusBarShifter setOffset:_shiftAccumulator];
+  [_statusBarShifter setOffset:(CGFloat)_physics.accumulator];
 
   [self.delegate flexibleHeaderViewFrameDidChange:self];
 }
@@ -1360,7 +1167,7 @@ static BOOL isRunningiOS10_3OrAbove() {
 
   MDCFlexibleHeaderScrollViewInfo *info = [_trackedScrollViews objectForKey:scrollView];
 
-  if (_shiftAccumulator >= [self fhv_accumulatorMax]) {
+  if (_physics.accumulator >= [self fhv_accumulatorMax]) {
     // We're shifted off-screen, make sure that this scroll view isn't expecting to show the header.
 
     CGPoint offset = scrollView.contentOffset;
@@ -1452,7 +1259,7 @@ static BOOL isRunningiOS10_3OrAbove() {
 
   _shiftAccumulatorLastContentOffsetIsValid = NO;
   _shiftAccumulatorLastContentOffset = _trackingScrollView.contentOffset;
-  _shiftAccumulatorDeltaY = 0;
+  _physics.accumulatedDeltaY = 0;
 
   _trackingInfo = [_trackedScrollViews objectForKey:_trackingScrollView];
   _trackingInfo.stashedHeightIsValid = NO;
@@ -1490,9 +1297,10 @@ static BOOL isRunningiOS10_3OrAbove() {
       }
       // Adjust the accumulator so that our height won't change and cap it to the possible range.
       CGFloat desiredShiftAccumulatorValue =
-          MAX(accumulatorMin, MIN([self fhv_accumulatorMax], _shiftAccumulator - heightDelta));
-      if (_shiftAccumulator != desiredShiftAccumulatorValue) {
-        _shiftAccumulator = desiredShiftAccumulatorValue;
+          (CGFloat)MAX(accumulatorMin,
+                       MIN([self fhv_accumulatorMax], _physics.accumulator - heightDelta));
+      if (_physics.accumulator != desiredShiftAccumulatorValue) {
+        _physics.accumulator = desiredShiftAccumulatorValue;
       }
     }
 
@@ -1561,14 +1369,14 @@ static BOOL isRunningiOS10_3OrAbove() {
 
   if (self.canAlwaysExpandToMaximumHeight) {
     if (![self fhv_canShiftOffscreen] && [self fhv_isPartiallyShifted]) {
-      _wantsToBeHidden = NO;
+      _physics.wantsToBeHidden = NO;
     }
     if (!willDecelerate && ([self fhv_isPartiallyShifted] || [self fhv_isPartiallyExpanded])) {
       [self fhv_startDisplayLink];
     }
   } else {
     if (![self fhv_canShiftOffscreen]) {
-      _wantsToBeHidden = NO;
+      _physics.wantsToBeHidden = NO;
     }
     if (!willDecelerate && [self fhv_isPartiallyShifted]) {
       [self fhv_startDisplayLink];
@@ -1593,12 +1401,12 @@ static BOOL isRunningiOS10_3OrAbove() {
     return;
   }
   if ([self fhv_isPartiallyShifted]) {
-    _wantsToBeHidden =
-        (_shiftAccumulator >= (1 - kMinimumVisibleProportion) * [self fhv_accumulatorMax]);
+    _physics.wantsToBeHidden =
+        (_physics.accumulator >= (1 - kMinimumVisibleProportion) * [self fhv_accumulatorMax]);
     [self fhv_startDisplayLink];
   } else if ([self fhv_isPartiallyExpanded]) {
-    _wantsToBeHidden =
-        (_shiftAccumulator >= (1 - kMinimumVisibleProportion) * [self fhv_accumulatorMin]);
+    _physics.wantsToBeHidden =
+        (_physics.accumulator >= (1 - kMinimumVisibleProportion) * [self fhv_accumulatorMin]);
     [self fhv_startDisplayLink];
   }
 }
@@ -1641,7 +1449,7 @@ static BOOL isRunningiOS10_3OrAbove() {
   _statusBarShifter.enabled = [self fhv_shouldAllowShifting];
 
   if (needsShiftOnScreen) {
-    _wantsToBeHidden = NO;
+    _physics.wantsToBeHidden = NO;
     [self fhv_startDisplayLink];
   }
 }
@@ -1787,7 +1595,7 @@ static BOOL isRunningiOS10_3OrAbove() {
     if ([self fhv_canShiftOffscreen] &&
         (0 < flexHeight && flexHeight < self.minMaxHeight.minimumHeightWithTopSafeArea)) {
       // Don't allow the header to be partially visible.
-      if (_wantsToBeHidden) {
+      if (_physics.wantsToBeHidden) {
         target.y = -[self fhv_rawTopContentInset];
       } else {
         target.y = -self.minMaxHeight.minimumHeightWithTopSafeArea - [self fhv_rawTopContentInset];
@@ -1800,10 +1608,10 @@ static BOOL isRunningiOS10_3OrAbove() {
     CGPoint target = *targetContentOffset;
 
     // Don't allow the header to be partially expanded.
-    if (_wantsToBeHidden) {
-      target.y -= _shiftAccumulator;
+    if (_physics.wantsToBeHidden) {
+      target.y -= (CGFloat)_physics.accumulator;
     } else {
-      target.y += ([self fhv_accumulatorMin] - _shiftAccumulator);
+      target.y += (CGFloat)([self fhv_accumulatorMin] - _physics.accumulator);
     }
     *targetContentOffset = target;
     return YES;
@@ -1827,25 +1635,25 @@ static BOOL isRunningiOS10_3OrAbove() {
 }
 
 - (void)shiftHeaderOnScreenAnimated:(BOOL)animated {
-  _wantsToBeHidden = NO;
+  _physics.wantsToBeHidden = NO;
 
   if (animated) {
     [self fhv_startDisplayLink];
   } else {
     // Remove any offscreen accumulation.
-    _shiftAccumulator = 0;
+    _physics.accumulator = 0;
     [self fhv_commitAccumulatorToFrame];
   }
 }
 
 - (void)shiftHeaderOffScreenAnimated:(BOOL)animated {
-  _wantsToBeHidden = YES;
+  _physics.wantsToBeHidden = YES;
 
   if (animated) {
     [self fhv_startDisplayLink];
   } else {
     // Add offscreen accumulation equal to this header view's size.
-    _shiftAccumulator = self.fhv_accumulatorMax;
+    _physics.accumulator = self.fhv_accumulatorMax;
     [self fhv_commitAccumulatorToFrame];
   }
 }
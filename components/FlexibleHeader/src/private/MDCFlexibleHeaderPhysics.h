@@ -0,0 +1,168 @@
+// Copyright 2015-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// The scroll physics of MDCFlexibleHeaderView, written in plain C with no dependency on UIKit,
+// Foundation or CoreGraphics so that it can be unit tested and benchmarked on any platform.
+//
+// The view samples its tracking scroll view, feeds the samples into these functions and applies
+// the results to its frame, shadow and status bar.
+
+#ifndef MDC_FLEXIBLE_HEADER_PHYSICS_H
+#define MDC_FLEXIBLE_HEADER_PHYSICS_H
+
+#include <stdbool.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/** Mirrors MDCFlexibleHeaderScrollPhase. */
+typedef enum {
+  MDCFlexibleHeaderPhysicsPhaseShifting = 0,
+  MDCFlexibleHeaderPhysicsPhaseCollapsing,
+  MDCFlexibleHeaderPhysicsPhaseOverExtending,
+} MDCFlexibleHeaderPhysicsPhase;
+
+/** The header configuration that the physics depend on. All lengths are in points. */
+typedef struct {
+  /** The minimum height of the header, including the top safe area. */
+  double minimumHeight;
+  /** The maximum height of the header, including the top safe area. */
+  double maximumHeight;
+  /** How far the header can expand when canAlwaysExpandToMaximumHeight is enabled. */
+  double maximumExpansion;
+  /** The largest accumulator value, at which the header is fully shifted off-screen. */
+  double accumulatorMax;
+  /** How far past accumulatorMax the accumulator may grow while detached from the content. */
+  double anchorLength;
+  bool canAlwaysExpandToMaximumHeight;
+  bool canShiftOffscreen;
+  /** Whether the header may grow past maximumHeight. */
+  bool canOverExtend;
+  bool hidesStatusBarWhenCollapsed;
+  bool isInFrontOfInfiniteContent;
+} MDCFlexibleHeaderPhysicsConfiguration;
+
+/** The mutable state of the header's shift behavior. */
+typedef struct {
+  /**
+   When the header can slide off-screen, a positive value indicates how off-screen the header is.
+   Essentially: the header's top edge = -accumulator.
+
+   When canAlwaysExpandToMaximumHeight is enabled, a negative value indicates how expanded the
+   header is. Essentially: the header's height += -accumulator.
+   */
+  double accumulator;
+  /** The content offset change accumulated since the scroll direction last changed. */
+  double accumulatedDeltaY;
+  /**
+   The ideal visibility state of the header. This may not match the present visibility if the user
+   is interacting with the header or if the header is settling.
+   */
+  bool wantsToBeHidden;
+} MDCFlexibleHeaderPhysicsState;
+
+/** A content offset sample of the tracking scroll view. */
+typedef struct {
+  /** The change in content offset since the previous sample. */
+  double deltaY;
+  /** The height the content offset asks for: the negated offset without the injected inset. */
+  double headerHeight;
+  /** Whether the user is dragging the scroll view. */
+  bool isTracking;
+  /** Whether the user is scrubbing the scroll indicator. */
+  bool isScrubbing;
+  /**
+   Whether the sample may move the accumulator. False while the scroll view rubber bands past the
+   bottom of its content and while the header is settling.
+   */
+  bool canAccumulate;
+} MDCFlexibleHeaderPhysicsScrollSample;
+
+/** The header geometry resulting from MDCFlexibleHeaderPhysicsStep. */
+typedef struct {
+  double height;
+  double shiftOffset;
+  double shadowIntensity;
+  MDCFlexibleHeaderPhysicsPhase phase;
+  double phaseValue;
+  double phasePercentage;
+} MDCFlexibleHeaderPhysicsOutput;
+
+/** Returns the smallest accumulator value allowed when the content asks for @c headerHeight. */
+double MDCFlexibleHeaderPhysicsAccumulatorMin(
+    const MDCFlexibleHeaderPhysicsConfiguration *configuration, double headerHeight);
+
+/** Tracks the scroll direction and accumulates the content offset change of @c sample. */
+void MDCFlexibleHeaderPhysicsAccumulateScroll(
+    MDCFlexibleHeaderPhysicsState *state,
+    const MDCFlexibleHeaderPhysicsConfiguration *configuration,
+    MDCFlexibleHeaderPhysicsScrollSample sample);
+
+/**
+ Moves the accumulator one frame of @c duration seconds towards fully shown or fully hidden,
+ depending on @c state->wantsToBeHidden.
+
+ @return true once the accumulator has reached its destination.
+ */
+bool MDCFlexibleHeaderPhysicsSettle(MDCFlexibleHeaderPhysicsState *state,
+                                    const MDCFlexibleHeaderPhysicsConfiguration *configuration,
+                                    double headerHeight,
+                                    double duration);
+
+/** Returns the accumulator clamped to the range that is applied to the header's position. */
+double MDCFlexibleHeaderPhysicsBoundedAccumulator(
+    const MDCFlexibleHeaderPhysicsState *state,
+    const MDCFlexibleHeaderPhysicsConfiguration *configuration);
+
+/** Returns the header height for the content offset and, if expanded, the accumulator. */
+double MDCFlexibleHeaderPhysicsHeight(const MDCFlexibleHeaderPhysicsState *state,
+                                      const MDCFlexibleHeaderPhysicsConfiguration *configuration,
+                                      double headerHeight);
+
+/**
+ Returns the shadow intensity, from 0 to 1.
+
+ @param projectedBottomEdge How far the header's bottom edge overlaps the content. Positive when
+                            overlapping, zero when attached to the top of the content.
+ */
+double MDCFlexibleHeaderPhysicsShadowIntensity(
+    const MDCFlexibleHeaderPhysicsState *state,
+    const MDCFlexibleHeaderPhysicsConfiguration *configuration,
+    double projectedBottomEdge);
+
+/**
+ Returns the scroll phase of a header whose top edge is at @c topEdge with @c height, and stores
+ the phase value and percentage.
+ */
+MDCFlexibleHeaderPhysicsPhase MDCFlexibleHeaderPhysicsPhaseForFrame(
+    const MDCFlexibleHeaderPhysicsConfiguration *configuration,
+    double topEdge,
+    double height,
+    double *phaseValue,
+    double *phasePercentage);
+
+/**
+ Accumulates @c sample and returns the resulting header geometry, assuming that the header's top
+ edge is at the top of the tracking scroll view when not shifted.
+ */
+MDCFlexibleHeaderPhysicsOutput MDCFlexibleHeaderPhysicsStep(
+    MDCFlexibleHeaderPhysicsState *state,
+    const MDCFlexibleHeaderPhysicsConfiguration *configuration,
+    MDCFlexibleHeaderPhysicsScrollSample sample);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif  // MDC_FLEXIBLE_HEADER_PHYSICS_H
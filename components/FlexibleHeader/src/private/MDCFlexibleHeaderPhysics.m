@@ -0,0 +1,275 @@
+// Copyright 2015-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "MDCFlexibleHeaderPhysics.h"
+
+#include <math.h>
+
+/** The distance the finger must travel in one direction before the header wants to follow. */
+static const double kDeltaYSlop = 5;
+
+/** The strength of the force pulling a settling header towards its destination. */
+static const double kAttachmentCoefficient = 12;
+
+/** How close a settling header must get to its destination before it snaps to it. */
+static const double kShiftEpsilon = 0.1;
+
+/** The length over which the shadow fades in as the header overlaps the content. */
+static const double kShadowScaleLength = 8;
+
+double MDCFlexibleHeaderPhysicsAccumulatorMin(
+    const MDCFlexibleHeaderPhysicsConfiguration *configuration, double headerHeight) {
+  if (!configuration->canAlwaysExpandToMaximumHeight) {
+    return 0;
+  }
+
+  double maxExpansion;
+  if (headerHeight < configuration->minimumHeight) {
+    // The header is detached from the content and able to fully expand.
+    maxExpansion = configuration->maximumExpansion;
+  } else {
+    // We're now attached to the content and need to constrain our possible expansion.
+    maxExpansion = configuration->maximumHeight - headerHeight;
+  }
+  // Expansion is tracked via negative accumulation.
+  return fmin(0, -maxExpansion);
+}
+
+void MDCFlexibleHeaderPhysicsAccumulateScroll(
+    MDCFlexibleHeaderPhysicsState *state,
+    const MDCFlexibleHeaderPhysicsConfiguration *configuration,
+    MDCFlexibleHeaderPhysicsScrollSample sample) {
+  double deltaY = sample.deltaY;
+  const double headerHeight = sample.headerHeight;
+  const double minimumHeight = configuration->minimumHeight;
+
+  // We track the last direction for our target offset behavior.
+  if (state->accumulatedDeltaY * deltaY < 0) {
+    // Direction has changed.
+    state->accumulatedDeltaY = 0;
+  }
+  state->accumulatedDeltaY += deltaY;
+
+  // Keeps track of the last direction the user moved their finger in.
+  if (sample.isTracking) {
+    if (state->accumulatedDeltaY > kDeltaYSlop) {
+      state->wantsToBeHidden = true;
+    } else if (state->accumulatedDeltaY < -kDeltaYSlop) {
+      state->wantsToBeHidden = false;
+    }
+  }
+
+  if (!sample.canAccumulate) {
+    return;
+  }
+
+  if (!configuration->canAlwaysExpandToMaximumHeight) {
+    // When we're not allowed to shift offscreen, only allow the header to shift further on-screen
+    // in case it was previously off-screen due to a behavior change.
+    if (!configuration->canShiftOffscreen) {
+      deltaY = fmin(0, deltaY);
+    }
+  }
+
+  // When scrubbing we only allow the header to shrink and shift off-screen.
+  if (sample.isScrubbing) {
+    deltaY = fmax(0, deltaY);
+  }
+
+  if (configuration->canAlwaysExpandToMaximumHeight) {
+    // When still attached to the top content, don't accumulate negatively.
+    if (headerHeight >= minimumHeight) {
+      deltaY = fmax(0, deltaY);
+    }
+  }
+
+  // Check if our delta y will cause us to cross the boundary from shrinking to shifting and, if
+  // so, cap the deltaY to only the overshoot, otherwise the header will overshift.
+
+  // headerHeight and deltaY are in inverted coordinate spaces, so when we do
+  // headerHeight + deltaY we're calculating where the headerHeight was _before_ this update.
+  const double previousHeaderHeight = headerHeight + deltaY;
+
+  if (headerHeight < minimumHeight && previousHeaderHeight > minimumHeight) {
+    // Overshoot coming in
+    deltaY = minimumHeight - headerHeight;
+  } else if (headerHeight > minimumHeight && previousHeaderHeight < minimumHeight) {
+    // Overshoot going out
+    deltaY = previousHeaderHeight - minimumHeight;
+  }
+
+  // Calculate the upper bound of the accumulator based on what phase we're in.
+  double upperBound;
+  if (configuration->canAlwaysExpandToMaximumHeight && !configuration->canShiftOffscreen) {
+    // Don't allow any shifting.
+    upperBound = 0;
+  } else if (headerHeight < 0) {
+    // Header is shifting while detached from content.
+    upperBound = configuration->accumulatorMax + configuration->anchorLength;
+  } else if (headerHeight < minimumHeight) {
+    // Header is shifting while attached to content.
+    upperBound = configuration->accumulatorMax;
+  } else {
+    // Header is not shifting.
+    upperBound = 0;
+  }
+
+  // Ensure that we don't lose any deltaY by first capping the accumulator within its valid range.
+  state->accumulator = fmin(upperBound, state->accumulator);
+
+  // Accumulate the deltaY.
+  double lowerBound = MDCFlexibleHeaderPhysicsAccumulatorMin(configuration, headerHeight);
+  state->accumulator = fmax(lowerBound, fmin(upperBound, state->accumulator + deltaY));
+}
+
+bool MDCFlexibleHeaderPhysicsSettle(MDCFlexibleHeaderPhysicsState *state,
+                                    const MDCFlexibleHeaderPhysicsConfiguration *configuration,
+                                    double headerHeight,
+                                    double duration) {
+  const double accumulatorMax = configuration->accumulatorMax;
+  const double accumulatorMin = MDCFlexibleHeaderPhysicsAccumulatorMin(configuration, headerHeight);
+
+  // Erase any scrollback that was injected into the accumulator by capping it back down.
+  state->accumulator = fmin(accumulatorMax, state->accumulator);
+
+  double destination;
+  if (configuration->canAlwaysExpandToMaximumHeight) {
+    if (state->accumulator > 0) {  // Shifted
+      destination = state->wantsToBeHidden ? accumulatorMax : 0;
+    } else if (state->accumulator < 0) {  // Expanded
+      destination = state->wantsToBeHidden ? 0 : accumulatorMin;
+    } else {
+      destination = 0;
+    }
+  } else {
+    destination = state->wantsToBeHidden ? accumulatorMax : 0;
+  }
+
+  // This is a simple "force" that's stronger the further we are from the destination.
+  double distanceToDestination = destination - state->accumulator;
+  state->accumulator += kAttachmentCoefficient * distanceToDestination * duration;
+
+  // accumulatorMin is 0 unless canAlwaysExpandToMaximumHeight is enabled.
+  state->accumulator = fmax(accumulatorMin, fmin(accumulatorMax, state->accumulator));
+
+  // Have we reached our destination?
+  if (fabs(destination - state->accumulator) <= kShiftEpsilon) {
+    state->accumulator = destination;
+    return true;
+  }
+  return false;
+}
+
+double MDCFlexibleHeaderPhysicsBoundedAccumulator(
+    const MDCFlexibleHeaderPhysicsState *state,
+    const MDCFlexibleHeaderPhysicsConfiguration *configuration) {
+  double boundedAccumulator = fmin(configuration->accumulatorMax, state->accumulator);
+  if (configuration->canAlwaysExpandToMaximumHeight) {
+    // Expansion is applied to the height rather than the position.
+    boundedAccumulator = fmax(0, boundedAccumulator);
+  }
+  return boundedAccumulator;
+}
+
+double MDCFlexibleHeaderPhysicsHeight(const MDCFlexibleHeaderPhysicsState *state,
+                                      const MDCFlexibleHeaderPhysicsConfiguration *configuration,
+                                      double headerHeight) {
+  double height;
+  if (configuration->canOverExtend) {
+    height = fmax(configuration->minimumHeight, headerHeight);
+  } else {
+    height = fmax(configuration->minimumHeight, fmin(configuration->maximumHeight, headerHeight));
+  }
+  if (configuration->canAlwaysExpandToMaximumHeight) {
+    height += fmax(0, -state->accumulator);
+  }
+  return height;
+}
+
+double MDCFlexibleHeaderPhysicsShadowIntensity(
+    const MDCFlexibleHeaderPhysicsState *state,
+    const MDCFlexibleHeaderPhysicsConfiguration *configuration,
+    double projectedBottomEdge) {
+  double frameBottomEdge = fmax(0, fmin(kShadowScaleLength, projectedBottomEdge));
+
+  if (configuration->hidesStatusBarWhenCollapsed) {
+    // Calculate the desired shadow strength for the offset & accumulator and then take the
+    // weakest strength.
+    double boundedAccumulator = MDCFlexibleHeaderPhysicsBoundedAccumulator(state, configuration);
+    double accumulator =
+        fmax(0, fmin(kShadowScaleLength, configuration->minimumHeight - boundedAccumulator));
+    if (configuration->isInFrontOfInfiniteContent) {
+      // When in front of infinite content we only care to hide the shadow when our header is
+      // off-screen.
+      return fmax(0, fmin(1, accumulator / kShadowScaleLength));
+    }
+    // When over non-infinite content we also want to hide the shadow when we're anchored to the
+    // top of our content.
+    return fmax(0, fmin(1, fmin(accumulator, frameBottomEdge) / kShadowScaleLength));
+  }
+
+  if (configuration->isInFrontOfInfiniteContent) {
+    return 1;
+  }
+
+  // Adjust the opacity as the bottom edge of the header increasingly overlaps the contents
+  return frameBottomEdge / kShadowScaleLength;
+}
+
+MDCFlexibleHeaderPhysicsPhase MDCFlexibleHeaderPhysicsPhaseForFrame(
+    const MDCFlexibleHeaderPhysicsConfiguration *configuration,
+    double topEdge,
+    double height,
+    double *phaseValue,
+    double *phasePercentage) {
+  const double minimumHeight = configuration->minimumHeight;
+  const double maximumHeight = configuration->maximumHeight;
+
+  if (topEdge < 0) {
+    *phaseValue = topEdge + minimumHeight;
+    // accumulatorMax already excludes the status bar when collapsing to it.
+    double shiftLength = configuration->accumulatorMax;
+    *phasePercentage = shiftLength > 0 ? -topEdge / shiftLength : 0;
+    return MDCFlexibleHeaderPhysicsPhaseShifting;
+  }
+
+  *phaseValue = height;
+
+  if (height < maximumHeight) {
+    double heightLength = maximumHeight - minimumHeight;
+    *phasePercentage = heightLength > 0 ? (height - minimumHeight) / heightLength : 0;
+    return MDCFlexibleHeaderPhysicsPhaseCollapsing;
+  }
+
+  *phasePercentage = maximumHeight > 0 ? 1 + (height - maximumHeight) / maximumHeight : 0;
+  return MDCFlexibleHeaderPhysicsPhaseOverExtending;
+}
+
+MDCFlexibleHeaderPhysicsOutput MDCFlexibleHeaderPhysicsStep(
+    MDCFlexibleHeaderPhysicsState *state,
+    const MDCFlexibleHeaderPhysicsConfiguration *configuration,
+    MDCFlexibleHeaderPhysicsScrollSample sample) {
+  MDCFlexibleHeaderPhysicsAccumulateScroll(state, configuration, sample);
+
+  MDCFlexibleHeaderPhysicsOutput output;
+  output.height = MDCFlexibleHeaderPhysicsHeight(state, configuration, sample.headerHeight);
+  output.shiftOffset = MDCFlexibleHeaderPhysicsBoundedAccumulator(state, configuration);
+  double projectedBottomEdge = output.height - output.shiftOffset - sample.headerHeight;
+  output.shadowIntensity =
+      MDCFlexibleHeaderPhysicsShadowIntensity(state, configuration, projectedBottomEdge);
+  output.phase = MDCFlexibleHeaderPhysicsPhaseForFrame(
+      configuration, -output.shiftOffset, output.height, &output.phaseValue,
+      &output.phasePercentage);
+  return output;
+}
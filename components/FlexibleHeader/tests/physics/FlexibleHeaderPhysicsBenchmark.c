@@ -0,0 +1,78 @@
+// Copyright 2015-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Replays a synthesized scroll trace through the flexible header physics and reports the time per
+// step. Compiled as plain C so that the physics can be profiled on any platform.
+//
+// The trace is synthesized rather than recorded from a device, so that it is deterministic and the
+// same on every machine: long flings down the content followed by shorter scroll-backs, repeatedly
+// passing through the collapsing and shifting phases, and settling every four seconds.
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "FlexibleHeaderPhysicsTestSupport.h"
+
+static const int kReplayTraceLength = 100000;
+static const int kReplayCount = 20;
+
+static double *CreateReplayTrace(int length) {
+  double *offsets = malloc((size_t)length * sizeof(double));
+  double offset = -152;
+  for (int i = 0; i < length; ++i) {
+    double velocity = (i % 240) < 160 ? 9 : -7;
+    offset = fmax(-200, fmin(4000, offset + velocity + (double)(i % 7) - 3));
+    offsets[i] = offset;
+  }
+  return offsets;
+}
+
+static double ReplayTrace(const double *offsets, int length) {
+  MDCFlexibleHeaderPhysicsConfiguration configuration = ShiftingConfiguration();
+  MDCFlexibleHeaderPhysicsState state = {0};
+  double totalShiftOffset = 0;
+  for (int i = 1; i < length; ++i) {
+    MDCFlexibleHeaderPhysicsScrollSample sample = Sample(offsets[i] - offsets[i - 1], -offsets[i]);
+    totalShiftOffset += MDCFlexibleHeaderPhysicsStep(&state, &configuration, sample).shiftOffset;
+    if (i % 240 == 0) {
+      // Let go and settle, as the display link would.
+      while (!MDCFlexibleHeaderPhysicsSettle(&state, &configuration, -offsets[i],
+                                             kFrameDuration)) {
+      }
+    }
+  }
+  return totalShiftOffset;
+}
+
+int main(void) {
+  double *offsets = CreateReplayTrace(kReplayTraceLength);
+  if (!offsets) {
+    return 1;
+  }
+
+  double checksum = 0;
+  clock_t start = clock();
+  for (int replay = 0; replay < kReplayCount; ++replay) {
+    checksum += ReplayTrace(offsets, kReplayTraceLength);
+  }
+  double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+  free(offsets);
+
+  printf("%d steps in %.3f s, %.1f ns per step (checksum %.0f)\n",
+         kReplayCount * kReplayTraceLength, seconds,
+         seconds * 1e9 / ((double)kReplayCount * kReplayTraceLength), checksum);
+  return checksum > 0 ? 0 : 1;
+}
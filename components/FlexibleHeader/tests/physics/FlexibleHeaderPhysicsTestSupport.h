@@ -0,0 +1,51 @@
+// Copyright 2015-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Configurations and samples shared by the plain C tests and benchmark of the flexible header
+// physics.
+
+#ifndef MDC_FLEXIBLE_HEADER_PHYSICS_TEST_SUPPORT_H
+#define MDC_FLEXIBLE_HEADER_PHYSICS_TEST_SUPPORT_H
+
+#include "MDCFlexibleHeaderPhysics.h"
+
+/** A 60Hz display link frame. */
+static const double kFrameDuration = 1.0 / 60.0;
+
+static inline MDCFlexibleHeaderPhysicsConfiguration ShiftingConfiguration(void) {
+  MDCFlexibleHeaderPhysicsConfiguration configuration;
+  configuration.minimumHeight = 76;
+  configuration.maximumHeight = 152;
+  configuration.maximumExpansion = 76;
+  configuration.accumulatorMax = 76;
+  configuration.anchorLength = 175;
+  configuration.canAlwaysExpandToMaximumHeight = false;
+  configuration.canShiftOffscreen = true;
+  configuration.canOverExtend = true;
+  configuration.hidesStatusBarWhenCollapsed = false;
+  configuration.isInFrontOfInfiniteContent = false;
+  return configuration;
+}
+
+static inline MDCFlexibleHeaderPhysicsScrollSample Sample(double deltaY, double headerHeight) {
+  MDCFlexibleHeaderPhysicsScrollSample sample;
+  sample.deltaY = deltaY;
+  sample.headerHeight = headerHeight;
+  sample.isTracking = true;
+  sample.isScrubbing = false;
+  sample.canAccumulate = true;
+  return sample;
+}
+
+#endif  // MDC_FLEXIBLE_HEADER_PHYSICS_TEST_SUPPORT_H
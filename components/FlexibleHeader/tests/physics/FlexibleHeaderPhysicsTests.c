@@ -0,0 +1,139 @@
+// Copyright 2015-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Unit tests of the flexible header physics, compiled as plain C so that they run on any platform.
+
+#include <math.h>
+#include <stdio.h>
+
+#include "FlexibleHeaderPhysicsTestSupport.h"
+
+static int gFailureCount = 0;
+
+#define EXPECT_TRUE(condition)                                                 \
+  do {                                                                         \
+    if (!(condition)) {                                                        \
+      fprintf(stderr, "%s:%d: expected %s\n", __FILE__, __LINE__, #condition); \
+      ++gFailureCount;                                                         \
+    }                                                                          \
+  } while (0)
+
+#define EXPECT_NEAR(actual, expected) EXPECT_TRUE(fabs((actual) - (expected)) < 0.001)
+
+static void TestScrollingDownTheContentCollapsesThenShiftsTheHeader(void) {
+  // Given
+  MDCFlexibleHeaderPhysicsConfiguration configuration = ShiftingConfiguration();
+  MDCFlexibleHeaderPhysicsState state = {0};
+
+  // When
+  MDCFlexibleHeaderPhysicsOutput collapsing =
+      MDCFlexibleHeaderPhysicsStep(&state, &configuration, Sample(38, 114));
+  MDCFlexibleHeaderPhysicsOutput shifting =
+      MDCFlexibleHeaderPhysicsStep(&state, &configuration, Sample(76, 38));
+
+  // Then
+  EXPECT_TRUE(collapsing.phase == MDCFlexibleHeaderPhysicsPhaseCollapsing);
+  EXPECT_NEAR(collapsing.height, 114);
+  EXPECT_NEAR(collapsing.phasePercentage, 0.5);
+  EXPECT_TRUE(shifting.phase == MDCFlexibleHeaderPhysicsPhaseShifting);
+  EXPECT_NEAR(shifting.height, 76);
+  // Only the part of the scroll past the minimum height shifts the header.
+  EXPECT_NEAR(shifting.shiftOffset, 38);
+  EXPECT_TRUE(state.wantsToBeHidden);
+}
+
+static void TestScrollingBackWithinTheAnchorLengthKeepsTheHeaderOffscreen(void) {
+  // Given
+  MDCFlexibleHeaderPhysicsConfiguration configuration = ShiftingConfiguration();
+  MDCFlexibleHeaderPhysicsState state = {0};
+  MDCFlexibleHeaderPhysicsStep(&state, &configuration, Sample(200, -100));
+
+  // When
+  MDCFlexibleHeaderPhysicsOutput output =
+      MDCFlexibleHeaderPhysicsStep(&state, &configuration, Sample(-10, -90));
+
+  // Then
+  EXPECT_TRUE(!state.wantsToBeHidden);
+  EXPECT_NEAR(state.accumulator, 166);
+  EXPECT_NEAR(output.shiftOffset, 76);
+}
+
+static void TestSettleIsDeterministicAndReachesItsDestination(void) {
+  // Given
+  MDCFlexibleHeaderPhysicsConfiguration configuration = ShiftingConfiguration();
+  MDCFlexibleHeaderPhysicsState first = {.accumulator = 40, .wantsToBeHidden = true};
+  MDCFlexibleHeaderPhysicsState second = first;
+  int firstFrames = 0;
+  int secondFrames = 0;
+
+  // When
+  while (!MDCFlexibleHeaderPhysicsSettle(&first, &configuration, -500, kFrameDuration)) {
+    ++firstFrames;
+  }
+  while (!MDCFlexibleHeaderPhysicsSettle(&second, &configuration, -500, kFrameDuration)) {
+    ++secondFrames;
+  }
+
+  // Then
+  EXPECT_TRUE(first.accumulator == configuration.accumulatorMax);
+  EXPECT_TRUE(firstFrames == secondFrames);
+  EXPECT_TRUE(firstFrames < 60);
+}
+
+static void TestCanAlwaysExpandTracksExpansionAsNegativeAccumulation(void) {
+  // Given
+  MDCFlexibleHeaderPhysicsConfiguration configuration = ShiftingConfiguration();
+  configuration.canAlwaysExpandToMaximumHeight = true;
+  MDCFlexibleHeaderPhysicsState state = {0};
+
+  // When
+  MDCFlexibleHeaderPhysicsOutput output =
+      MDCFlexibleHeaderPhysicsStep(&state, &configuration, Sample(-30, -500));
+
+  // Then
+  EXPECT_NEAR(state.accumulator, -30);
+  EXPECT_NEAR(output.height, 106);
+  EXPECT_NEAR(output.shiftOffset, 0);
+  EXPECT_NEAR(MDCFlexibleHeaderPhysicsAccumulatorMin(&configuration, -500), -76);
+}
+
+static void TestShadowIsHiddenWhileAttachedToTheContent(void) {
+  // Given
+  MDCFlexibleHeaderPhysicsConfiguration configuration = ShiftingConfiguration();
+  MDCFlexibleHeaderPhysicsState state = {0};
+
+  // When
+  MDCFlexibleHeaderPhysicsOutput attached =
+      MDCFlexibleHeaderPhysicsStep(&state, &configuration, Sample(0, 152));
+  MDCFlexibleHeaderPhysicsOutput overlapping =
+      MDCFlexibleHeaderPhysicsStep(&state, &configuration, Sample(0, 72));
+
+  // Then
+  EXPECT_NEAR(attached.shadowIntensity, 0);
+  EXPECT_NEAR(overlapping.shadowIntensity, 0.5);
+}
+
+int main(void) {
+  TestScrollingDownTheContentCollapsesThenShiftsTheHeader();
+  TestScrollingBackWithinTheAnchorLengthKeepsTheHeaderOffscreen();
+  TestSettleIsDeterministicAndReachesItsDestination();
+  TestCanAlwaysExpandTracksExpansionAsNegativeAccumulation();
+  TestShadowIsHiddenWhileAttachedToTheContent();
+
+  if (gFailureCount > 0) {
+    fprintf(stderr, "%d expectation(s) failed\n", gFailureCount);
+    return 1;
+  }
+  return 0;
+}
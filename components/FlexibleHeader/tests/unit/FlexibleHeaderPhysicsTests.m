@@ -0,0 +1,184 @@
+// Copyright 2015-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#import <XCTest/XCTest.h>
+
+#import "../../src/private/MDCFlexibleHeaderPhysics.h"
+
+static const NSInteger kReplayTraceLength = 100000;
+
+// A 60Hz display link frame.
+static const double kFrameDuration = 1.0 / 60.0;
+
+static MDCFlexibleHeaderPhysicsConfiguration ShiftingConfiguration(void) {
+  MDCFlexibleHeaderPhysicsConfiguration configuration;
+  configuration.minimumHeight = 76;
+  configuration.maximumHeight = 152;
+  configuration.maximumExpansion = 76;
+  configuration.accumulatorMax = 76;
+  configuration.anchorLength = 175;
+  configuration.canAlwaysExpandToMaximumHeight = false;
+  configuration.canShiftOffscreen = true;
+  configuration.canOverExtend = true;
+  configuration.hidesStatusBarWhenCollapsed = false;
+  configuration.isInFrontOfInfiniteContent = false;
+  return configuration;
+}
+
+static MDCFlexibleHeaderPhysicsScrollSample Sample(double deltaY, double headerHeight) {
+  MDCFlexibleHeaderPhysicsScrollSample sample;
+  sample.deltaY = deltaY;
+  sample.headerHeight = headerHeight;
+  sample.isTracking = true;
+  sample.isScrubbing = false;
+  sample.canAccumulate = true;
+  return sample;
+}
+
+// Synthesizes a deterministic trace of content offsets: long flings down the content followed by
+// shorter scroll-backs, repeatedly passing through the collapsing and shifting phases.
+static double *CreateReplayTrace(NSInteger length) {
+  double *offsets = malloc((size_t)length * sizeof(double));
+  double offset = -152;
+  for (NSInteger i = 0; i < length; ++i) {
+    double velocity = (i % 240) < 160 ? 9 : -7;
+    offset = fmax(-200, fmin(4000, offset + velocity + (double)(i % 7) - 3));
+    offsets[i] = offset;
+  }
+  return offsets;
+}
+
+@interface FlexibleHeaderPhysicsTests : XCTestCase
+@end
+
+@implementation FlexibleHeaderPhysicsTests
+
+- (void)testScrollingDownTheContentCollapsesThenShiftsTheHeader {
+  // Given
+  MDCFlexibleHeaderPhysicsConfiguration configuration = ShiftingConfiguration();
+  MDCFlexibleHeaderPhysicsState state = {0};
+
+  // When
+  MDCFlexibleHeaderPhysicsOutput collapsing =
+      MDCFlexibleHeaderPhysicsStep(&state, &configuration, Sample(38, 114));
+  MDCFlexibleHeaderPhysicsOutput shifting =
+      MDCFlexibleHeaderPhysicsStep(&state, &configuration, Sample(76, 38));
+
+  // Then
+  XCTAssertEqual(collapsing.phase, MDCFlexibleHeaderPhysicsPhaseCollapsing);
+  XCTAssertEqualWithAccuracy(collapsing.height, 114, 0.001);
+  XCTAssertEqualWithAccuracy(collapsing.phasePercentage, 0.5, 0.001);
+  XCTAssertEqual(shifting.phase, MDCFlexibleHeaderPhysicsPhaseShifting);
+  XCTAssertEqualWithAccuracy(shifting.height, 76, 0.001);
+  // Only the part of the scroll past the minimum height shifts the header.
+  XCTAssertEqualWithAccuracy(shifting.shiftOffset, 38, 0.001);
+  XCTAssertTrue(state.wantsToBeHidden);
+}
+
+- (void)testScrollingBackWithinTheAnchorLengthKeepsTheHeaderOffscreen {
+  // Given
+  MDCFlexibleHeaderPhysicsConfiguration configuration = ShiftingConfiguration();
+  MDCFlexibleHeaderPhysicsState state = {0};
+  MDCFlexibleHeaderPhysicsStep(&state, &configuration, Sample(200, -100));
+
+  // When
+  MDCFlexibleHeaderPhysicsOutput output =
+      MDCFlexibleHeaderPhysicsStep(&state, &configuration, Sample(-10, -90));
+
+  // Then
+  XCTAssertFalse(state.wantsToBeHidden);
+  XCTAssertEqualWithAccuracy(state.accumulator, 166, 0.001);
+  XCTAssertEqualWithAccuracy(output.shiftOffset, 76, 0.001);
+}
+
+- (void)testSettleIsDeterministicAndReachesItsDestination {
+  // Given
+  MDCFlexibleHeaderPhysicsConfiguration configuration = ShiftingConfiguration();
+  MDCFlexibleHeaderPhysicsState first = {.accumulator = 40, .wantsToBeHidden = true};
+  MDCFlexibleHeaderPhysicsState second = first;
+  NSInteger firstFrames = 0;
+  NSInteger secondFrames = 0;
+
+  // When
+  while (!MDCFlexibleHeaderPhysicsSettle(&first, &configuration, -500, kFrameDuration)) {
+    ++firstFrames;
+  }
+  while (!MDCFlexibleHeaderPhysicsSettle(&second, &configuration, -500, kFrameDuration)) {
+    ++secondFrames;
+  }
+
+  // Then
+  XCTAssertEqual(first.accumulator, configuration.accumulatorMax);
+  XCTAssertEqual(firstFrames, secondFrames);
+  XCTAssertLessThan(firstFrames, 60);
+}
+
+- (void)testCanAlwaysExpandTracksExpansionAsNegativeAccumulation {
+  // Given
+  MDCFlexibleHeaderPhysicsConfiguration configuration = ShiftingConfiguration();
+  configuration.canAlwaysExpandToMaximumHeight = true;
+  MDCFlexibleHeaderPhysicsState state = {0};
+
+  // When
+  MDCFlexibleHeaderPhysicsOutput output =
+      MDCFlexibleHeaderPhysicsStep(&state, &configuration, Sample(-30, -500));
+
+  // Then
+  XCTAssertEqualWithAccuracy(state.accumulator, -30, 0.001);
+  XCTAssertEqualWithAccuracy(output.height, 106, 0.001);
+  XCTAssertEqualWithAccuracy(output.shiftOffset, 0, 0.001);
+  XCTAssertEqualWithAccuracy(MDCFlexibleHeaderPhysicsAccumulatorMin(&configuration, -500), -76,
+                             0.001);
+}
+
+- (void)testShadowIsHiddenWhileAttachedToTheContent {
+  // Given
+  MDCFlexibleHeaderPhysicsConfiguration configuration = ShiftingConfiguration();
+  MDCFlexibleHeaderPhysicsState state = {0};
+
+  // When
+  MDCFlexibleHeaderPhysicsOutput attached =
+      MDCFlexibleHeaderPhysicsStep(&state, &configuration, Sample(0, 152));
+  MDCFlexibleHeaderPhysicsOutput overlapping =
+      MDCFlexibleHeaderPhysicsStep(&state, &configuration, Sample(0, 72));
+
+  // Then
+  XCTAssertEqualWithAccuracy(attached.shadowIntensity, 0, 0.001);
+  XCTAssertEqualWithAccuracy(overlapping.shadowIntensity, 0.5, 0.001);
+}
+
+#pragma mark - Performance
+
+- (void)testPerformanceReplayScrollTrace {
+  MDCFlexibleHeaderPhysicsConfiguration configuration = ShiftingConfiguration();
+  double *offsets = CreateReplayTrace(kReplayTraceLength);
+  [self measureBlock:^{
+    MDCFlexibleHeaderPhysicsState state = {0};
+    double totalShiftOffset = 0;
+    for (NSInteger i = 1; i < kReplayTraceLength; ++i) {
+      MDCFlexibleHeaderPhysicsScrollSample sample =
+          Sample(offsets[i] - offsets[i - 1], -offsets[i]);
+      totalShiftOffset += MDCFlexibleHeaderPhysicsStep(&state, &configuration, sample).shiftOffset;
+      if (i % 240 == 0) {
+        // Let go and settle, as the display link would.
+        while (!MDCFlexibleHeaderPhysicsSettle(&state, &configuration, -offsets[i],
+                                               kFrameDuration)) {
+        }
+      }
+    }
+    XCTAssertGreaterThan(totalShiftOffset, 0);
+  }];
+  free(offsets);
+}
+
+@end
@@ -14,6 +14,7 @@
 
 #import "MDCInkLayer.h"
 #import "MaterialMath.h"
+#import "MaterialOvalPathCache.h"
 
 static const CGFloat MDCInkLayerCommonDuration = (CGFloat)0.083;
 static const CGFloat MDCInkLayerEndFadeOutDuration = (CGFloat)0.15;
@@ -90,10 +91,10 @@ static NSString *const MDCInkLayerScaleString = @"transform.scale";
   if (self.maxRippleRadius > 0) {
     radius = self.maxRippleRadius;
   }
-  CGRect ovalRect = CGRectMake(CGRectGetWidth(self.bounds) / 2 - radius,
-                               CGRectGetHeight(self.bounds) / 2 - radius, radius * 2, radius * 2);
-  UIBezierPath *circlePath = [UIBezierPath bezierPathWithOvalInRect:ovalRect];
-  self.path = circlePath.CGPath;
+  CGPoint center = CGPointMake(CGRectGetWidth(self.bounds) / 2, CGRectGetHeight(self.bounds) / 2);
+  self.path = [[MDCOvalPathCache sharedCache] circlePathWithCenter:center
+                                                           radius:radius
+                                                            scale:[UIScreen mainScreen].scale];
   self.fillColor = self.inkColor.CGColor;
   if (!animated) {
     self.opacity = 1;
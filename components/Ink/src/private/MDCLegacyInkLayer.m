@@ -17,6 +17,8 @@
 
 #import <UIKit/UIKit.h>
 
+#import "MaterialOvalPathCache.h"
+
 static inline CGPoint MDCLegacyInkLayerInterpolatePoint(CGPoint start,
                                                         CGPoint end,
                                                         CGFloat offsetPercent) {
@@ -108,8 +110,9 @@ typedef NS_ENUM(NSInteger, MDCInkRippleState) {
   self.fillColor = self.color.CGColor;
   CGFloat dim = self.radius * 2;
   self.frame = CGRectMake(0, 0, dim, dim);
-  UIBezierPath *ripplePath = [UIBezierPath bezierPathWithOvalInRect:CGRectMake(0, 0, dim, dim)];
-  self.path = ripplePath.CGPath;
+  self.path = [[MDCOvalPathCache sharedCache] circlePathWithCenter:CGPointMake(dim / 2, dim / 2)
+                                                           radius:self.radius
+                                                            scale:[UIScreen mainScreen].scale];
 }
 
 - (void)enter {
@@ -512,10 +515,11 @@ static NSString *const kInkLayerBackgroundOpacityAnim = @"backgroundOpacityAnim"
       CGRectMake(-(radius * 2 - self.bounds.size.width) / 2,
                  -(radius * 2 - self.bounds.size.height) / 2, radius * 2, radius * 2);
   _compositeRipple.frame = rippleFrame;
-  CGRect rippleBounds = CGRectMake(0, 0, radius * 2, radius * 2);
   CAShapeLayer *rippleMaskLayer = [CAShapeLayer layer];
-  UIBezierPath *ripplePath = [UIBezierPath bezierPathWithOvalInRect:rippleBounds];
-  rippleMaskLayer.path = ripplePath.CGPath;
+  rippleMaskLayer.path =
+      [[MDCOvalPathCache sharedCache] circlePathWithCenter:CGPointMake(radius, radius)
+                                                    radius:radius
+                                                     scale:[UIScreen mainScreen].scale];
   _compositeRipple.mask = rippleMaskLayer;
 }
 
@@ -76,6 +76,18 @@
  */
 @property(nonatomic) BOOL hidesForSinglePage;
 
+/**
+ The maximum number of page indicators shown at once.
+
+ When numberOfPages exceeds this value only the indicators in a window around the current page are
+ shown, and the indicators at the edges of the window fade out to hint at the pages beyond them.
+ The window follows the current page as it changes, so the cost of scrolling and layout depends on
+ this value rather than on numberOfPages. Positive values smaller than 3 are treated as 3.
+
+ The default value is 0, which shows an indicator for every page.
+ */
+@property(nonatomic) NSInteger maximumNumberOfVisibleIndicators;
+
 #pragma mark Configuring the page colors
 
 /** The color of the non-current page indicators. */
@@ -16,6 +16,7 @@
 
 #import <MDFInternationalization/MDFInternationalization.h>
 
+#import "MaterialLocalizedStrings.h"
 #import "private/MDCPageControlIndicator.h"
 #import "private/MDCPageControlTrackLayer.h"
 #import "private/MaterialPageControlStrings.h"
@@ -44,6 +45,12 @@ static const NSTimeInterval kPageControlIndicatorShowDelay = 0.04;
 // Default indicator opacity.
 static const CGFloat kPageControlIndicatorDefaultOpacity = (CGFloat)0.5;
 
+// Opacity multiplier for the indicators at an edge of the window that has more pages beyond it.
+static const float kPageControlIndicatorEdgeFadeOpacity = 0.4f;
+
+// The smallest window that can show the current page between its neighbors.
+static const NSInteger kPageControlMinimumVisibleIndicators = 3;
+
 // Default white level for current page indicator color.
 static const CGFloat kPageControlCurrentPageIndicatorWhiteColor = (CGFloat)0.38;
 
@@ -58,11 +65,12 @@ static inline CGFloat normalizeValue(CGFloat value, CGFloat minRange, CGFloat ma
 
 @implementation MDCPageControl {
   UIView *_containerView;
+  // The visible indicators, ordered left to right. In windowed mode these are recycled as the
+  // window moves, so they only ever cover the slots [_windowStart, _windowStart + count).
   NSMutableArray<MDCPageControlIndicator *> *_indicators;
-  NSMutableArray<NSValue *> *_indicatorPositions;
+  NSInteger _windowStart;
   MDCPageControlIndicator *_animatedIndicator;
   MDCPageControlTrackLayer *_trackLayer;
-  CGFloat _trackLength;
   BOOL _isDeferredScrolling;
 }
 
@@ -108,18 +116,15 @@ static inline CGFloat normalizeValue(CGFloat value, CGFloat minRange, CGFloat ma
 
 - (void)layoutSubviews {
   [super layoutSubviews];
-  if (_numberOfPages == 0 || (_hidesForSinglePage && [_indicators count] == 1)) {
+  if (_numberOfPages == 0 || (_hidesForSinglePage && _numberOfPages == 1)) {
     self.hidden = YES;
     return;
   }
   self.hidden = NO;
 
-  for (NSUInteger pageNumber = 0; pageNumber < _indicators.count; pageNumber++) {
-    MDCPageControlIndicator *indicator = _indicators[pageNumber];
-    if (pageNumber == (NSUInteger)_currentPage) {
-      indicator.hidden = YES;
-    }
-    indicator.color = _pageIndicatorTintColor;
+  [[self indicatorForPage:_currentPage] setHidden:YES];
+  for (NSUInteger index = 0; index < _indicators.count; index++) {
+    [self applyColorToIndicatorAtIndex:index];
   }
   _animatedIndicator.color = _currentPageIndicatorTintColor;
   _trackLayer.trackColor = _pageIndicatorTintColor;
@@ -131,6 +136,11 @@ static inline CGFloat normalizeValue(CGFloat value, CGFloat minRange, CGFloat ma
   [self resetControl];
 }
 
+- (void)setMaximumNumberOfVisibleIndicators:(NSInteger)maximumNumberOfVisibleIndicators {
+  _maximumNumberOfVisibleIndicators = MAX(0, maximumNumberOfVisibleIndicators);
+  [self resetControl];
+}
+
 - (void)setCurrentPage:(NSInteger)currentPage {
   [self setCurrentPage:currentPage animated:NO];
 }
@@ -150,13 +160,16 @@ static inline CGFloat normalizeValue(CGFloat value, CGFloat minRange, CGFloat ma
     return;
   }
 
+  [self moveWindowToPage:currentPage];
+
   if (animated) {
-    // Draw and extend track.
-    CGPoint startPoint = [_indicatorPositions[previousPage] CGPointValue];
-    CGPoint endPoint = [_indicatorPositions[currentPage] CGPointValue];
+    // Draw and extend track. The previous page may have left the window, in which case the track
+    // starts from the window's edge.
+    CGPoint startPoint = [self indicatorPositionForPage:previousPage];
+    CGPoint endPoint = [self indicatorPositionForPage:currentPage];
     if (shouldReverse) {
-      startPoint = [_indicatorPositions[currentPage] CGPointValue];
-      endPoint = [_indicatorPositions[previousPage] CGPointValue];
+      startPoint = [self indicatorPositionForPage:currentPage];
+      endPoint = [self indicatorPositionForPage:previousPage];
     }
 
     // Remove track and reveal hidden indicators staggered towards current page indicator. Reveal
@@ -184,13 +197,13 @@ static inline CGFloat normalizeValue(CGFloat value, CGFloat minRange, CGFloat ma
                                        completion:completionBlock];
   } else {
     // If not animated, simply move indicator to new position and reset track.
-    CGPoint point = [_indicatorPositions[currentPage] CGPointValue];
+    CGPoint point = [self indicatorPositionForPage:currentPage];
     [_animatedIndicator updateIndicatorTransformX:point.x - kPageControlIndicatorRadius];
     [_trackLayer resetAtPoint:point];
 
     [CATransaction begin];
     [CATransaction setDisableActions:YES];
-    [_indicators[previousPage] setHidden:NO];
+    [[self indicatorForPage:previousPage] setHidden:NO];
     [CATransaction commit];
   }
 }
@@ -208,11 +221,11 @@ static inline CGFloat normalizeValue(CGFloat value, CGFloat minRange, CGFloat ma
 #pragma mark - UIView(UIViewGeometry)
 
 - (CGSize)intrinsicContentSize {
-  return [MDCPageControl sizeForNumberOfPages:_numberOfPages];
+  return [MDCPageControl sizeForNumberOfPages:[self numberOfVisibleIndicators]];
 }
 
 - (CGSize)sizeThatFits:(__unused CGSize)size {
-  return [MDCPageControl sizeForNumberOfPages:_numberOfPages];
+  return [MDCPageControl sizeForNumberOfPages:[self numberOfVisibleIndicators]];
 }
 
 + (CGSize)sizeForNumberOfPages:(NSInteger)pageCount {
@@ -272,7 +285,8 @@ static inline CGFloat normalizeValue(CGFloat value, CGFloat minRange, CGFloat ma
                      NSInteger currentPage = [self scrolledPageNumber:scrollView];
                      [self setCurrentPage:currentPage animated:YES duration:animation.duration];
 
-                     CGFloat transformX = scrolledPercentage * self->_trackLength;
+                     CGFloat transformX =
+                         [self indicatorTransformXForScrolledPercentage:scrolledPercentage];
                      [self->_animatedIndicator updateIndicatorTransformX:transformX
                                                                 animated:YES
                                                                 duration:animation.duration
@@ -280,31 +294,40 @@ static inline CGFloat normalizeValue(CGFloat value, CGFloat minRange, CGFloat ma
                    });
 
   } else if (scrolledPercentage >= 0 && scrolledPercentage <= 1 && _numberOfPages > 0) {
+    // Keep the window of visible indicators around the scrolled page. This only does work when the
+    // window actually moves, and then only for the visible indicators.
+    NSInteger scrolledPageNumber = [self scrolledPageNumber:scrollView];
+    BOOL windowMoved = !_isDeferredScrolling && [self moveWindowToPage:scrolledPageNumber];
+
     // Update active indicator position.
-    CGFloat transformX = scrolledPercentage * _trackLength;
+    CGFloat transformX = [self indicatorTransformXForScrolledPercentage:scrolledPercentage];
     if (!_isDeferredScrolling) {
       [_animatedIndicator updateIndicatorTransformX:transformX];
     }
 
     // Determine endpoints for drawing track depending on direction scrolled.
-    NSInteger scrolledPageNumber = [self scrolledPageNumber:scrollView];
-    CGPoint startPoint = [_indicatorPositions[scrolledPageNumber] CGPointValue];
+    CGPoint startPoint = [self indicatorPositionForPage:scrolledPageNumber];
     CGPoint endPoint = startPoint;
     CGFloat radius = kPageControlIndicatorRadius;
     if (transformX > startPoint.x - radius) {
       if ([self isRTL]) {
-        endPoint = [_indicatorPositions[scrolledPageNumber - 1] CGPointValue];
+        endPoint = [self indicatorPositionForPage:scrolledPageNumber - 1];
       } else {
-        endPoint = [_indicatorPositions[scrolledPageNumber + 1] CGPointValue];
+        endPoint = [self indicatorPositionForPage:scrolledPageNumber + 1];
       }
     } else if (transformX < startPoint.x - radius) {
       if ([self isRTL]) {
-        startPoint = [_indicatorPositions[scrolledPageNumber + 1] CGPointValue];
+        startPoint = [self indicatorPositionForPage:scrolledPageNumber + 1];
       } else {
-        startPoint = [_indicatorPositions[scrolledPageNumber - 1] CGPointValue];
+        startPoint = [self indicatorPositionForPage:scrolledPageNumber - 1];
       }
     }
 
+    // The track was drawn in the coordinates of the old window, so start it over.
+    if (windowMoved) {
+      [_trackLayer resetAtPoint:startPoint];
+    }
+
     if (scrollView.isDragging) {
       // Draw or extend track.
       if (_trackLayer.isTrackHidden) {
@@ -316,7 +339,7 @@ static inline CGFloat normalizeValue(CGFloat value, CGFloat minRange, CGFloat ma
 
     // Hide indicators to be shown with animated reveal once track is removed.
     if (!_isDeferredScrolling) {
-      [_indicators[scrolledPageNumber] setHidden:YES];
+      [[self indicatorForPage:scrolledPageNumber] setHidden:YES];
     }
   }
 }
@@ -324,7 +347,8 @@ static inline CGFloat normalizeValue(CGFloat value, CGFloat minRange, CGFloat ma
 - (void)scrollViewDidEndDecelerating:(UIScrollView *)scrollView {
   // Remove track towards current active indicator position.
   NSInteger scrolledPageNumber = [self scrolledPageNumber:scrollView];
-  CGPoint point = [_indicatorPositions[scrolledPageNumber] CGPointValue];
+  [self moveWindowToPage:scrolledPageNumber];
+  CGPoint point = [self indicatorPositionForPage:scrolledPageNumber];
   BOOL shouldReverse = (_currentPage > scrolledPageNumber);
   BOOL sendAction = (_currentPage != scrolledPageNumber);
   _currentPage = scrolledPageNumber;
@@ -358,13 +382,15 @@ static inline CGFloat normalizeValue(CGFloat value, CGFloat minRange, CGFloat ma
 #pragma mark - Indicators
 
 - (void)revealIndicatorsReversed:(BOOL)reversed {
-  // Animate hidden indicators staggered with delay.
-  NSEnumerationOptions options = (reversed) ? NSEnumerationReverse : 0;
+  // Animate hidden indicators staggered with delay. Indicators are stored left to right, so in RTL
+  // page order is the reverse of storage order.
+  NSEnumerationOptions options = (reversed != [self isRTL]) ? NSEnumerationReverse : 0;
 
   __block NSInteger count = 0;
   void (^block)(MDCPageControlIndicator *, NSUInteger, BOOL *) =
       ^(MDCPageControlIndicator *indicator, NSUInteger index, BOOL *stop) {
-        BOOL isCurrentPageIndicator = (NSInteger)index == self.currentPage;
+        NSInteger page = [self pageForSlot:self->_windowStart + (NSInteger)index];
+        BOOL isCurrentPageIndicator = page == self.currentPage;
 
         // Reveal indicators if hidden and not current page indicator.
         if (indicator.isHidden && !isCurrentPageIndicator) {
@@ -410,15 +436,7 @@ static inline CGFloat normalizeValue(CGFloat value, CGFloat minRange, CGFloat ma
   // If _defersCurrentPageDisplay = YES, then update control only when this method is called.
   if (_defersCurrentPageDisplay && [self isPageIndexValid:_currentPage]) {
     [self setCurrentPage:_currentPage];
-
-    // Reset hidden state of indicators.
-    [CATransaction begin];
-    [CATransaction setDisableActions:YES];
-    for (int i = 0; i < _numberOfPages; i++) {
-      MDCPageControlIndicator *indicator = _indicators[i];
-      indicator.hidden = (i == _currentPage) ? YES : NO;
-    }
-    [CATransaction commit];
+    [self resetVisibleIndicators];
   }
 }
 
@@ -472,6 +490,103 @@ static inline CGFloat normalizeValue(CGFloat value, CGFloat minRange, CGFloat ma
   [self resetControl];
 }
 
+#pragma mark - Window
+
+- (NSInteger)numberOfVisibleIndicators {
+  if (_maximumNumberOfVisibleIndicators == 0) {
+    return _numberOfPages;
+  }
+  return MIN(_numberOfPages,
+             MAX(kPageControlMinimumVisibleIndicators, _maximumNumberOfVisibleIndicators));
+}
+
+// Slots number the indicator positions from left to right, whatever the layout direction.
+- (NSInteger)slotForPage:(NSInteger)page {
+  return [self isRTL] ? _numberOfPages - 1 - page : page;
+}
+
+- (NSInteger)pageForSlot:(NSInteger)slot {
+  return [self isRTL] ? _numberOfPages - 1 - slot : slot;
+}
+
+// Returns nil if the page is outside of the window.
+- (MDCPageControlIndicator *)indicatorForPage:(NSInteger)page {
+  NSInteger index = [self slotForPage:page] - _windowStart;
+  if (index < 0 || index >= (NSInteger)_indicators.count) {
+    return nil;
+  }
+  return _indicators[index];
+}
+
+// Pages outside of the window are pinned to the nearest edge of the window.
+- (CGPoint)indicatorPositionForPage:(NSInteger)page {
+  NSInteger index = [self slotForPage:page] - _windowStart;
+  index = MAX(0, MIN((NSInteger)_indicators.count - 1, index));
+  CGFloat radius = kPageControlIndicatorRadius;
+  return CGPointMake(index * (kPageControlIndicatorMargin + (radius * 2)) + radius, radius);
+}
+
+- (CGFloat)indicatorTransformXForScrolledPercentage:(CGFloat)scrolledPercentage {
+  CGFloat slot = scrolledPercentage * (_numberOfPages - 1);
+  return (slot - _windowStart) * (kPageControlIndicatorMargin + (kPageControlIndicatorRadius * 2));
+}
+
+// Slides the window so that the page's indicator has a neighbor on either side, unless it is at
+// the first or last page. Returns YES if the window moved.
+- (BOOL)moveWindowToPage:(NSInteger)page {
+  NSInteger visibleCount = (NSInteger)_indicators.count;
+  if (visibleCount == _numberOfPages) {
+    return NO;
+  }
+  NSInteger slot = [self slotForPage:page];
+  NSInteger windowStart = _windowStart;
+  if (slot - 1 < windowStart) {
+    windowStart = slot - 1;
+  } else if (slot + 1 > windowStart + visibleCount - 1) {
+    windowStart = slot + 2 - visibleCount;
+  }
+  windowStart = MAX(0, MIN(_numberOfPages - visibleCount, windowStart));
+  if (windowStart == _windowStart) {
+    return NO;
+  }
+  _windowStart = windowStart;
+  [self resetVisibleIndicators];
+  return YES;
+}
+
+// Reassigns the visible indicators to the pages in the window: hides the current page's indicator,
+// shows the rest and fades out the edges.
+- (void)resetVisibleIndicators {
+  [CATransaction begin];
+  [CATransaction setDisableActions:YES];
+  for (NSUInteger index = 0; index < _indicators.count; index++) {
+    MDCPageControlIndicator *indicator = _indicators[index];
+    [indicator removeAllAnimations];
+    indicator.hidden = [self pageForSlot:_windowStart + (NSInteger)index] == _currentPage;
+    [self applyColorToIndicatorAtIndex:index];
+  }
+  [CATransaction commit];
+}
+
+- (void)applyColorToIndicatorAtIndex:(NSUInteger)index {
+  MDCPageControlIndicator *indicator = _indicators[index];
+  indicator.color = _pageIndicatorTintColor;
+
+  // Always derive the opacity from the tint color so that it is restored once an indicator is no
+  // longer at a faded edge.
+  float opacity = _pageIndicatorTintColor
+                      ? (float)CGColorGetAlpha(_pageIndicatorTintColor.CGColor)
+                      : (float)kPageControlIndicatorDefaultOpacity;
+  NSInteger lastIndex = (NSInteger)_indicators.count - 1;
+  BOOL hasPagesBefore = index == 0 && _windowStart > 0;
+  BOOL hasPagesAfter =
+      (NSInteger)index == lastIndex && _windowStart + lastIndex < _numberOfPages - 1;
+  if (hasPagesBefore || hasPagesAfter) {
+    opacity *= kPageControlIndicatorEdgeFadeOpacity;
+  }
+  indicator.opacity = opacity;
+}
+
 #pragma mark - Private
 
 - (void)resetControl {
@@ -483,18 +598,19 @@ static inline CGFloat normalizeValue(CGFloat value, CGFloat minRange, CGFloat ma
       [layer removeFromSuperlayer];
     }
   }
-  _indicators = [NSMutableArray arrayWithCapacity:_numberOfPages];
-  _indicatorPositions = [NSMutableArray arrayWithCapacity:_numberOfPages];
+  NSInteger visibleCount = [self numberOfVisibleIndicators];
+  _indicators = [NSMutableArray arrayWithCapacity:visibleCount];
+  _windowStart = 0;
 
   if (_numberOfPages == 0) {
     [self setNeedsLayout];
     return;
   }
 
-  // Create indicators.
+  // Create indicators for the window only; they are reused as the window moves.
   CGFloat radius = kPageControlIndicatorRadius;
   CGFloat margin = kPageControlIndicatorMargin;
-  for (int i = 0; i < _numberOfPages; i++) {
+  for (NSInteger i = 0; i < visibleCount; i++) {
     CGFloat offsetX = i * (margin + (radius * 2));
     CGFloat offsetY = radius;
     CGPoint center = CGPointMake(offsetX + radius, offsetY);
@@ -502,27 +618,19 @@ static inline CGFloat normalizeValue(CGFloat value, CGFloat minRange, CGFloat ma
                                                                                   radius:radius];
     indicator.opacity = kPageControlIndicatorDefaultOpacity;
     [_containerView.layer addSublayer:indicator];
-    NSInteger pageNumber = i;
-    if ([self isRTL]) {
-      pageNumber = _numberOfPages - 1 - i;
-      [_indicators insertObject:indicator atIndex:0];
-      [_indicatorPositions insertObject:[NSValue valueWithCGPoint:indicator.position] atIndex:0];
-    } else {
-      [_indicators addObject:indicator];
-      [_indicatorPositions addObject:[NSValue valueWithCGPoint:indicator.position]];
-    }
+    [_indicators addObject:indicator];
   }
+  [self moveWindowToPage:_currentPage];
 
   // Resize container view to keep indicators centered.
   CGFloat frameWidth = _containerView.frame.size.width;
-  CGSize controlSize = [MDCPageControl sizeForNumberOfPages:_numberOfPages];
+  CGSize controlSize = [MDCPageControl sizeForNumberOfPages:visibleCount];
   _containerView.frame = CGRectInset(_containerView.frame, (frameWidth - controlSize.width) / 2, 0);
-  _trackLength = CGRectGetWidth(_containerView.frame) - (radius * 2);
 
   // Add animated indicator that will travel freely across the container. Its transform will be
   // updated by calling its -updateIndicatorTransformX method.
   CGPoint center = CGPointMake(radius, radius);
-  CGPoint point = [_indicatorPositions[_currentPage] CGPointValue];
+  CGPoint point = [self indicatorPositionForPage:_currentPage];
   _animatedIndicator = [[MDCPageControlIndicator alloc] initWithCenter:center radius:radius];
   [_animatedIndicator updateIndicatorTransformX:point.x - kPageControlIndicatorRadius];
   [_containerView.layer addSublayer:_animatedIndicator];
@@ -534,12 +642,24 @@ static inline CGFloat normalizeValue(CGFloat value, CGFloat minRange, CGFloat ma
 
 + (NSString *)pageControlAccessibilityLabelWithPage:(NSInteger)currentPage
                                             ofPages:(NSInteger)ofPages {
-  NSString *key = kMaterialPageControlStringTable[kStr_MaterialPageControlAccessibilityLabel];
-  NSString *localizedString = NSLocalizedStringFromTableInBundle(
-      key, kMaterialPageControlStringsTableName, [self bundle], @"page {number} of {total number}");
+  // page {number} of {total number}
+  NSString *localizedString =
+      [[self stringTable] stringForID:kStr_MaterialPageControlAccessibilityLabel];
   return [NSString localizedStringWithFormat:localizedString, currentPage, ofPages];
 }
 
++ (MDCLocalizedStringTable *)stringTable {
+  static MDCLocalizedStringTable *stringTable;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    stringTable = [MDCLocalizedStringTable tableNamed:kMaterialPageControlStringsTableName
+                                             inBundle:[self bundle]
+                                                 keys:kMaterialPageControlStringTable
+                                                count:kNumMaterialPageControlStrings];
+  });
+  return stringTable;
+}
+
 #pragma mark - Resource bundle
 
 + (NSBundle *)bundle {
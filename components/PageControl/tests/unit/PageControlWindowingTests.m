@@ -0,0 +1,215 @@
+// Copyright 2015-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "MaterialPageControl.h"
+
+static const NSInteger kVisibleIndicators = 7;
+static const NSInteger kScrollCallbacks = 1000;
+static const CGFloat kPageWidth = 320;
+
+@interface PageControlWindowingTests : XCTestCase
+@end
+
+@implementation PageControlWindowingTests
+
+// The container view holds the track layer and the animated indicator next to the page indicators.
+static NSUInteger IndicatorLayerCount(MDCPageControl *pageControl) {
+  UIView *containerView = pageControl.subviews.firstObject;
+  return containerView.layer.sublayers.count - 2;
+}
+
+// The page indicators, left to right. The track layer comes first and the animated indicator last.
+static NSArray<CALayer *> *IndicatorLayers(MDCPageControl *pageControl) {
+  NSArray<CALayer *> *sublayers = pageControl.subviews.firstObject.layer.sublayers;
+  return [sublayers subarrayWithRange:NSMakeRange(1, sublayers.count - 2)];
+}
+
+- (void)testAllIndicatorsAreCreatedByDefault {
+  // Given
+  MDCPageControl *pageControl = [[MDCPageControl alloc] initWithFrame:CGRectZero];
+
+  // When
+  pageControl.numberOfPages = 10;
+
+  // Then
+  XCTAssertEqual(IndicatorLayerCount(pageControl), 10U);
+}
+
+- (void)testWindowedModeOnlyCreatesVisibleIndicators {
+  // Given
+  MDCPageControl *pageControl = [[MDCPageControl alloc] initWithFrame:CGRectZero];
+  pageControl.maximumNumberOfVisibleIndicators = kVisibleIndicators;
+
+  // When
+  pageControl.numberOfPages = 100000;
+
+  // Then
+  XCTAssertEqual(IndicatorLayerCount(pageControl), (NSUInteger)kVisibleIndicators);
+}
+
+- (void)testWindowedModeWithFewerPagesCreatesIndicatorPerPage {
+  // Given
+  MDCPageControl *pageControl = [[MDCPageControl alloc] initWithFrame:CGRectZero];
+  pageControl.maximumNumberOfVisibleIndicators = kVisibleIndicators;
+
+  // When
+  pageControl.numberOfPages = 4;
+
+  // Then
+  XCTAssertEqual(IndicatorLayerCount(pageControl), 4U);
+}
+
+- (void)testSmallMaximumIsTreatedAsThree {
+  // Given
+  MDCPageControl *pageControl = [[MDCPageControl alloc] initWithFrame:CGRectZero];
+  pageControl.numberOfPages = 10;
+
+  // When
+  pageControl.maximumNumberOfVisibleIndicators = 1;
+
+  // Then
+  XCTAssertEqual(IndicatorLayerCount(pageControl), 3U);
+}
+
+- (void)testSizeThatFitsUsesVisibleIndicators {
+  // Given
+  MDCPageControl *pageControl = [[MDCPageControl alloc] initWithFrame:CGRectZero];
+  pageControl.numberOfPages = 1000;
+
+  // When
+  pageControl.maximumNumberOfVisibleIndicators = kVisibleIndicators;
+
+  // Then
+  CGSize expectedSize = [MDCPageControl sizeForNumberOfPages:kVisibleIndicators];
+  XCTAssertTrue(CGSizeEqualToSize([pageControl sizeThatFits:CGSizeZero], expectedSize));
+  XCTAssertTrue(CGSizeEqualToSize(pageControl.intrinsicContentSize, expectedSize));
+}
+
+- (void)testSettingCurrentPageInWindowedMode {
+  // Given
+  MDCPageControl *pageControl = [[MDCPageControl alloc] initWithFrame:CGRectZero];
+  pageControl.maximumNumberOfVisibleIndicators = kVisibleIndicators;
+  pageControl.numberOfPages = 1000;
+
+  // When
+  [pageControl setCurrentPage:999 animated:NO];
+  [pageControl setCurrentPage:500 animated:YES];
+
+  // Then
+  XCTAssertEqual(pageControl.currentPage, 500);
+  XCTAssertEqual(IndicatorLayerCount(pageControl), (NSUInteger)kVisibleIndicators);
+}
+
+- (void)testScrollingToTheLastPageInWindowedMode {
+  // Given
+  UIScrollView *scrollView = [self scrollViewWithNumberOfPages:1000];
+  MDCPageControl *pageControl = [[MDCPageControl alloc] initWithFrame:CGRectZero];
+  pageControl.maximumNumberOfVisibleIndicators = kVisibleIndicators;
+  pageControl.numberOfPages = 1000;
+
+  // When
+  scrollView.contentOffset = CGPointMake(999 * kPageWidth, 0);
+  [pageControl scrollViewDidScroll:scrollView];
+  [pageControl scrollViewDidEndDecelerating:scrollView];
+
+  // Then
+  XCTAssertEqual(pageControl.currentPage, 999);
+  XCTAssertEqual(IndicatorLayerCount(pageControl), (NSUInteger)kVisibleIndicators);
+}
+
+- (void)testEdgeOpacityIsStableAcrossLayoutPasses {
+  // Given
+  MDCPageControl *pageControl = [[MDCPageControl alloc] initWithFrame:CGRectZero];
+  pageControl.maximumNumberOfVisibleIndicators = kVisibleIndicators;
+  pageControl.numberOfPages = 100;
+  [pageControl setCurrentPage:50 animated:NO];
+
+  // When
+  for (NSInteger i = 0; i < 5; ++i) {
+    [pageControl setNeedsLayout];
+    [pageControl layoutIfNeeded];
+  }
+
+  // Then
+  NSArray<CALayer *> *indicators = IndicatorLayers(pageControl);
+  float tintAlpha = (float)CGColorGetAlpha(pageControl.pageIndicatorTintColor.CGColor);
+  XCTAssertEqualWithAccuracy(indicators.firstObject.opacity, tintAlpha * 0.4f, 0.001);
+  XCTAssertEqualWithAccuracy(indicators[1].opacity, tintAlpha, 0.001);
+  XCTAssertEqualWithAccuracy(indicators.lastObject.opacity, tintAlpha * 0.4f, 0.001);
+}
+
+- (void)testEdgeOpacityIsRestoredWhenWindowReturnsToFirstPage {
+  // Given
+  MDCPageControl *pageControl = [[MDCPageControl alloc] initWithFrame:CGRectZero];
+  pageControl.maximumNumberOfVisibleIndicators = kVisibleIndicators;
+  pageControl.numberOfPages = 100;
+  [pageControl setCurrentPage:50 animated:NO];
+  [pageControl layoutIfNeeded];
+
+  // When
+  [pageControl setCurrentPage:0 animated:NO];
+  [pageControl setNeedsLayout];
+  [pageControl layoutIfNeeded];
+
+  // Then
+  NSArray<CALayer *> *indicators = IndicatorLayers(pageControl);
+  float tintAlpha = (float)CGColorGetAlpha(pageControl.pageIndicatorTintColor.CGColor);
+  XCTAssertEqualWithAccuracy(indicators.firstObject.opacity, tintAlpha, 0.001);
+  XCTAssertEqualWithAccuracy(indicators.lastObject.opacity, tintAlpha * 0.4f, 0.001);
+}
+
+#pragma mark - Performance
+
+- (void)testPerformanceScrollCallbacksWith10Pages {
+  [self measureScrollCallbacksWithNumberOfPages:10];
+}
+
+- (void)testPerformanceScrollCallbacksWith1000Pages {
+  [self measureScrollCallbacksWithNumberOfPages:1000];
+}
+
+- (void)testPerformanceScrollCallbacksWith100000Pages {
+  [self measureScrollCallbacksWithNumberOfPages:100000];
+}
+
+#pragma mark - Helpers
+
+- (UIScrollView *)scrollViewWithNumberOfPages:(NSInteger)numberOfPages {
+  UIScrollView *scrollView =
+      [[UIScrollView alloc] initWithFrame:CGRectMake(0, 0, kPageWidth, kPageWidth)];
+  scrollView.contentSize = CGSizeMake(numberOfPages * kPageWidth, kPageWidth);
+  return scrollView;
+}
+
+// Sweeps the whole content in evenly spaced scroll callbacks. With many pages the window moves on
+// every callback, which is the worst case for the windowed page control.
+- (void)measureScrollCallbacksWithNumberOfPages:(NSInteger)numberOfPages {
+  UIScrollView *scrollView = [self scrollViewWithNumberOfPages:numberOfPages];
+  MDCPageControl *pageControl = [[MDCPageControl alloc] initWithFrame:CGRectZero];
+  pageControl.maximumNumberOfVisibleIndicators = kVisibleIndicators;
+  pageControl.numberOfPages = numberOfPages;
+  CGFloat maximumOffset = scrollView.contentSize.width - kPageWidth;
+
+  [self measureBlock:^{
+    for (NSInteger i = 0; i <= kScrollCallbacks; ++i) {
+      scrollView.contentOffset = CGPointMake(maximumOffset * i / kScrollCallbacks, 0);
+      [pageControl scrollViewDidScroll:scrollView];
+    }
+    [pageControl scrollViewDidEndDecelerating:scrollView];
+  }];
+}
+
+@end
@@ -62,6 +62,27 @@ CG_EXTERN const MDCPaletteAccent _Nonnull MDCPaletteAccent400Name;
 /** The name of the accent 700 color when creating a custom palette. */
 CG_EXTERN const MDCPaletteAccent _Nonnull MDCPaletteAccent700Name;
 
+/**
+ The position of a tint or accent color within a palette, ordered from the lightest tint to the
+ darkest accent.
+ */
+typedef NS_ENUM(NSInteger, MDCPaletteColorIndex) {
+  MDCPaletteColorIndexTint50 = 0,
+  MDCPaletteColorIndexTint100,
+  MDCPaletteColorIndexTint200,
+  MDCPaletteColorIndexTint300,
+  MDCPaletteColorIndexTint400,
+  MDCPaletteColorIndexTint500,
+  MDCPaletteColorIndexTint600,
+  MDCPaletteColorIndexTint700,
+  MDCPaletteColorIndexTint800,
+  MDCPaletteColorIndexTint900,
+  MDCPaletteColorIndexAccent100,
+  MDCPaletteColorIndexAccent200,
+  MDCPaletteColorIndexAccent400,
+  MDCPaletteColorIndexAccent700,
+};
+
 /**
  A palette of Material colors.
 
@@ -213,4 +234,14 @@ CG_EXTERN const MDCPaletteAccent _Nonnull MDCPaletteAccent700Name;
 /** The A700 accent color, the darkest accent color. */
 @property(nonatomic, nullable, readonly) UIColor *accent700;
 
+/**
+ Returns the tint or accent color at @c index.
+
+ This is equivalent to reading the corresponding tint or accent property, without naming the color.
+
+ @param index The position of the color in the palette.
+ @return The color at @c index, or nil if the palette has no such accent or @c index is invalid.
+ */
+- (nullable UIColor *)colorAtIndex:(MDCPaletteColorIndex)index;
+
 @end
@@ -13,6 +13,9 @@
 // limitations under the License.
 
 #import "MDCPalettes.h"
+
+#include <stdatomic.h>
+
 #import "private/MDCPaletteExpansions.h"
 #import "private/MDCPaletteNames.h"
 
@@ -40,11 +43,172 @@ static inline UIColor *ColorFromRGB(uint32_t rgbValue) {
                          alpha:1];
 }
 
+// The number of tint colors, and of tint and accent colors, in a palette.
+enum {
+  kTintCount = MDCPaletteColorIndexTint900 + 1,
+  kColorCount = MDCPaletteColorIndexAccent700 + 1,
+};
+
+// The colors of the pre-defined palettes, as 24-bit RGB values ordered by MDCPaletteColorIndex.
+static const uint32_t kRedPaletteRGB[kColorCount] = {
+    // 50-900 tints
+    0xFFEBEE, 0xFFCDD2, 0xEF9A9A, 0xE57373, 0xEF5350,
+    0xF44336, 0xE53935, 0xD32F2F, 0xC62828, 0xB71C1C,
+    // A100-A700 accents
+    0xFF8A80, 0xFF5252, 0xFF1744, 0xD50000,
+};
+
+static const uint32_t kPinkPaletteRGB[kColorCount] = {
+    // 50-900 tints
+    0xFCE4EC, 0xF8BBD0, 0xF48FB1, 0xF06292, 0xEC407A,
+    0xE91E63, 0xD81B60, 0xC2185B, 0xAD1457, 0x880E4F,
+    // A100-A700 accents
+    0xFF80AB, 0xFF4081, 0xF50057, 0xC51162,
+};
+
+static const uint32_t kPurplePaletteRGB[kColorCount] = {
+    // 50-900 tints
+    0xF3E5F5, 0xE1BEE7, 0xCE93D8, 0xBA68C8, 0xAB47BC,
+    0x9C27B0, 0x8E24AA, 0x7B1FA2, 0x6A1B9A, 0x4A148C,
+    // A100-A700 accents
+    0xEA80FC, 0xE040FB, 0xD500F9, 0xAA00FF,
+};
+
+static const uint32_t kDeepPurplePaletteRGB[kColorCount] = {
+    // 50-900 tints
+    0xEDE7F6, 0xD1C4E9, 0xB39DDB, 0x9575CD, 0x7E57C2,
+    0x673AB7, 0x5E35B1, 0x512DA8, 0x4527A0, 0x311B92,
+    // A100-A700 accents
+    0xB388FF, 0x7C4DFF, 0x651FFF, 0x6200EA,
+};
+
+static const uint32_t kIndigoPaletteRGB[kColorCount] = {
+    // 50-900 tints
+    0xE8EAF6, 0xC5CAE9, 0x9FA8DA, 0x7986CB, 0x5C6BC0,
+    0x3F51B5, 0x3949AB, 0x303F9F, 0x283593, 0x1A237E,
+    // A100-A700 accents
+    0x8C9EFF, 0x536DFE, 0x3D5AFE, 0x304FFE,
+};
+
+static const uint32_t kBluePaletteRGB[kColorCount] = {
+    // 50-900 tints
+    0xE3F2FD, 0xBBDEFB, 0x90CAF9, 0x64B5F6, 0x42A5F5,
+    0x2196F3, 0x1E88E5, 0x1976D2, 0x1565C0, 0x0D47A1,
+    // A100-A700 accents
+    0x82B1FF, 0x448AFF, 0x2979FF, 0x2962FF,
+};
+
+static const uint32_t kLightBluePaletteRGB[kColorCount] = {
+    // 50-900 tints
+    0xE1F5FE, 0xB3E5FC, 0x81D4FA, 0x4FC3F7, 0x29B6F6,
+    0x03A9F4, 0x039BE5, 0x0288D1, 0x0277BD, 0x01579B,
+    // A100-A700 accents
+    0x80D8FF, 0x40C4FF, 0x00B0FF, 0x0091EA,
+};
+
+static const uint32_t kCyanPaletteRGB[kColorCount] = {
+    // 50-900 tints
+    0xE0F7FA, 0xB2EBF2, 0x80DEEA, 0x4DD0E1, 0x26C6DA,
+    0x00BCD4, 0x00ACC1, 0x0097A7, 0x00838F, 0x006064,
+    // A100-A700 accents
+    0x84FFFF, 0x18FFFF, 0x00E5FF, 0x00B8D4,
+};
+
+static const uint32_t kTealPaletteRGB[kColorCount] = {
+    // 50-900 tints
+    0xE0F2F1, 0xB2DFDB, 0x80CBC4, 0x4DB6AC, 0x26A69A,
+    0x009688, 0x00897B, 0x00796B, 0x00695C, 0x004D40,
+    // A100-A700 accents
+    0xA7FFEB, 0x64FFDA, 0x1DE9B6, 0x00BFA5,
+};
+
+static const uint32_t kGreenPaletteRGB[kColorCount] = {
+    // 50-900 tints
+    0xE8F5E9, 0xC8E6C9, 0xA5D6A7, 0x81C784, 0x66BB6A,
+    0x4CAF50, 0x43A047, 0x388E3C, 0x2E7D32, 0x1B5E20,
+    // A100-A700 accents
+    0xB9F6CA, 0x69F0AE, 0x00E676, 0x00C853,
+};
+
+static const uint32_t kLightGreenPaletteRGB[kColorCount] = {
+    // 50-900 tints
+    0xF1F8E9, 0xDCEDC8, 0xC5E1A5, 0xAED581, 0x9CCC65,
+    0x8BC34A, 0x7CB342, 0x689F38, 0x558B2F, 0x33691E,
+    // A100-A700 accents
+    0xCCFF90, 0xB2FF59, 0x76FF03, 0x64DD17,
+};
+
+static const uint32_t kLimePaletteRGB[kColorCount] = {
+    // 50-900 tints
+    0xF9FBE7, 0xF0F4C3, 0xE6EE9C, 0xDCE775, 0xD4E157,
+    0xCDDC39, 0xC0CA33, 0xAFB42B, 0x9E9D24, 0x827717,
+    // A100-A700 accents
+    0xF4FF81, 0xEEFF41, 0xC6FF00, 0xAEEA00,
+};
+
+static const uint32_t kYellowPaletteRGB[kColorCount] = {
+    // 50-900 tints
+    0xFFFDE7, 0xFFF9C4, 0xFFF59D, 0xFFF176, 0xFFEE58,
+    0xFFEB3B, 0xFDD835, 0xFBC02D, 0xF9A825, 0xF57F17,
+    // A100-A700 accents
+    0xFFFF8D, 0xFFFF00, 0xFFEA00, 0xFFD600,
+};
+
+static const uint32_t kAmberPaletteRGB[kColorCount] = {
+    // 50-900 tints
+    0xFFF8E1, 0xFFECB3, 0xFFE082, 0xFFD54F, 0xFFCA28,
+    0xFFC107, 0xFFB300, 0xFFA000, 0xFF8F00, 0xFF6F00,
+    // A100-A700 accents
+    0xFFE57F, 0xFFD740, 0xFFC400, 0xFFAB00,
+};
+
+static const uint32_t kOrangePaletteRGB[kColorCount] = {
+    // 50-900 tints
+    0xFFF3E0, 0xFFE0B2, 0xFFCC80, 0xFFB74D, 0xFFA726,
+    0xFF9800, 0xFB8C00, 0xF57C00, 0xEF6C00, 0xE65100,
+    // A100-A700 accents
+    0xFFD180, 0xFFAB40, 0xFF9100, 0xFF6D00,
+};
+
+static const uint32_t kDeepOrangePaletteRGB[kColorCount] = {
+    // 50-900 tints
+    0xFBE9E7, 0xFFCCBC, 0xFFAB91, 0xFF8A65, 0xFF7043,
+    0xFF5722, 0xF4511E, 0xE64A19, 0xD84315, 0xBF360C,
+    // A100-A700 accents
+    0xFF9E80, 0xFF6E40, 0xFF3D00, 0xDD2C00,
+};
+
+static const uint32_t kBrownPaletteRGB[kTintCount] = {
+    // 50-900 tints
+    0xEFEBE9, 0xD7CCC8, 0xBCAAA4, 0xA1887F, 0x8D6E63,
+    0x795548, 0x6D4C41, 0x5D4037, 0x4E342E, 0x3E2723,
+};
+
+static const uint32_t kGreyPaletteRGB[kTintCount] = {
+    // 50-900 tints
+    0xFAFAFA, 0xF5F5F5, 0xEEEEEE, 0xE0E0E0, 0xBDBDBD,
+    0x9E9E9E, 0x757575, 0x616161, 0x424242, 0x212121,
+};
+
+static const uint32_t kBlueGreyPaletteRGB[kTintCount] = {
+    // 50-900 tints
+    0xECEFF1, 0xCFD8DC, 0xB0BEC5, 0x90A4AE, 0x78909C,
+    0x607D8B, 0x546E7A, 0x455A64, 0x37474F, 0x263238,
+};
+
 @interface MDCPalette () {
-  NSDictionary<MDCPaletteTint, UIColor *> *_tints;
-  NSDictionary<MDCPaletteAccent, UIColor *> *_accents;
+  // Each slot holds a retained UIColor, or NULL if the color has not been created yet or the
+  // palette has no such accent. Slots are only ever filled once, with a compare-and-swap, so
+  // palettes remain safe to read from any thread.
+  _Atomic(void *) _colors[kColorCount];
+
+  // The RGB values of a pre-defined palette, whose colors are created on first access.
+  const uint32_t *_rgbValues;
+  NSInteger _rgbCount;
 }
 
+- (instancetype)initWithRGBValues:(const uint32_t *)rgbValues count:(NSInteger)count;
+
 @end
 
 @implementation MDCPalette
@@ -53,24 +217,7 @@ static inline UIColor *ColorFromRGB(uint32_t rgbValue) {
   static MDCPalette *palette;
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    palette = [[self alloc] initWithTints:@{
-      MDCPaletteTint50Name : ColorFromRGB(0xFFEBEE),
-      MDCPaletteTint100Name : ColorFromRGB(0xFFCDD2),
-      MDCPaletteTint200Name : ColorFromRGB(0xEF9A9A),
-      MDCPaletteTint300Name : ColorFromRGB(0xE57373),
-      MDCPaletteTint400Name : ColorFromRGB(0xEF5350),
-      MDCPaletteTint500Name : ColorFromRGB(0xF44336),
-      MDCPaletteTint600Name : ColorFromRGB(0xE53935),
-      MDCPaletteTint700Name : ColorFromRGB(0xD32F2F),
-      MDCPaletteTint800Name : ColorFromRGB(0xC62828),
-      MDCPaletteTint900Name : ColorFromRGB(0xB71C1C)
-    }
-                                  accents:@{
-                                    MDCPaletteAccent100Name : ColorFromRGB(0xFF8A80),
-                                    MDCPaletteAccent200Name : ColorFromRGB(0xFF5252),
-                                    MDCPaletteAccent400Name : ColorFromRGB(0xFF1744),
-                                    MDCPaletteAccent700Name : ColorFromRGB(0xD50000)
-                                  }];
+    palette = [[self alloc] initWithRGBValues:kRedPaletteRGB count:kColorCount];
   });
   return palette;
 }
@@ -79,24 +226,7 @@ static inline UIColor *ColorFromRGB(uint32_t rgbValue) {
   static MDCPalette *palette;
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    palette = [[self alloc] initWithTints:@{
-      MDCPaletteTint50Name : ColorFromRGB(0xFCE4EC),
-      MDCPaletteTint100Name : ColorFromRGB(0xF8BBD0),
-      MDCPaletteTint200Name : ColorFromRGB(0xF48FB1),
-      MDCPaletteTint300Name : ColorFromRGB(0xF06292),
-      MDCPaletteTint400Name : ColorFromRGB(0xEC407A),
-      MDCPaletteTint500Name : ColorFromRGB(0xE91E63),
-      MDCPaletteTint600Name : ColorFromRGB(0xD81B60),
-      MDCPaletteTint700Name : ColorFromRGB(0xC2185B),
-      MDCPaletteTint800Name : ColorFromRGB(0xAD1457),
-      MDCPaletteTint900Name : ColorFromRGB(0x880E4F)
-    }
-                                  accents:@{
-                                    MDCPaletteAccent100Name : ColorFromRGB(0xFF80AB),
-                                    MDCPaletteAccent200Name : ColorFromRGB(0xFF4081),
-                                    MDCPaletteAccent400Name : ColorFromRGB(0xF50057),
-                                    MDCPaletteAccent700Name : ColorFromRGB(0xC51162)
-                                  }];
+    palette = [[self alloc] initWithRGBValues:kPinkPaletteRGB count:kColorCount];
   });
   return palette;
 }
@@ -105,24 +235,7 @@ static inline UIColor *ColorFromRGB(uint32_t rgbValue) {
   static MDCPalette *palette;
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    palette = [[self alloc] initWithTints:@{
-      MDCPaletteTint50Name : ColorFromRGB(0xF3E5F5),
-      MDCPaletteTint100Name : ColorFromRGB(0xE1BEE7),
-      MDCPaletteTint200Name : ColorFromRGB(0xCE93D8),
-      MDCPaletteTint300Name : ColorFromRGB(0xBA68C8),
-      MDCPaletteTint400Name : ColorFromRGB(0xAB47BC),
-      MDCPaletteTint500Name : ColorFromRGB(0x9C27B0),
-      MDCPaletteTint600Name : ColorFromRGB(0x8E24AA),
-      MDCPaletteTint700Name : ColorFromRGB(0x7B1FA2),
-      MDCPaletteTint800Name : ColorFromRGB(0x6A1B9A),
-      MDCPaletteTint900Name : ColorFromRGB(0x4A148C)
-    }
-                                  accents:@{
-                                    MDCPaletteAccent100Name : ColorFromRGB(0xEA80FC),
-                                    MDCPaletteAccent200Name : ColorFromRGB(0xE040FB),
-                                    MDCPaletteAccent400Name : ColorFromRGB(0xD500F9),
-                                    MDCPaletteAccent700Name : ColorFromRGB(0xAA00FF)
-                                  }];
+    palette = [[self alloc] initWithRGBValues:kPurplePaletteRGB count:kColorCount];
   });
   return palette;
 }
@@ -131,24 +244,7 @@ static inline UIColor *ColorFromRGB(uint32_t rgbValue) {
   static MDCPalette *palette;
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    palette = [[self alloc] initWithTints:@{
-      MDCPaletteTint50Name : ColorFromRGB(0xEDE7F6),
-      MDCPaletteTint100Name : ColorFromRGB(0xD1C4E9),
-      MDCPaletteTint200Name : ColorFromRGB(0xB39DDB),
-      MDCPaletteTint300Name : ColorFromRGB(0x9575CD),
-      MDCPaletteTint400Name : ColorFromRGB(0x7E57C2),
-      MDCPaletteTint500Name : ColorFromRGB(0x673AB7),
-      MDCPaletteTint600Name : ColorFromRGB(0x5E35B1),
-      MDCPaletteTint700Name : ColorFromRGB(0x512DA8),
-      MDCPaletteTint800Name : ColorFromRGB(0x4527A0),
-      MDCPaletteTint900Name : ColorFromRGB(0x311B92)
-    }
-                                  accents:@{
-                                    MDCPaletteAccent100Name : ColorFromRGB(0xB388FF),
-                                    MDCPaletteAccent200Name : ColorFromRGB(0x7C4DFF),
-                                    MDCPaletteAccent400Name : ColorFromRGB(0x651FFF),
-                                    MDCPaletteAccent700Name : ColorFromRGB(0x6200EA)
-                                  }];
+    palette = [[self alloc] initWithRGBValues:kDeepPurplePaletteRGB count:kColorCount];
   });
   return palette;
 }
@@ -157,24 +253,7 @@ static inline UIColor *ColorFromRGB(uint32_t rgbValue) {
   static MDCPalette *palette;
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    palette = [[self alloc] initWithTints:@{
-      MDCPaletteTint50Name : ColorFromRGB(0xE8EAF6),
-      MDCPaletteTint100Name : ColorFromRGB(0xC5CAE9),
-      MDCPaletteTint200Name : ColorFromRGB(0x9FA8DA),
-      MDCPaletteTint300Name : ColorFromRGB(0x7986CB),
-      MDCPaletteTint400Name : ColorFromRGB(0x5C6BC0),
-      MDCPaletteTint500Name : ColorFromRGB(0x3F51B5),
-      MDCPaletteTint600Name : ColorFromRGB(0x3949AB),
-      MDCPaletteTint700Name : ColorFromRGB(0x303F9F),
-      MDCPaletteTint800Name : ColorFromRGB(0x283593),
-      MDCPaletteTint900Name : ColorFromRGB(0x1A237E)
-    }
-                                  accents:@{
-                                    MDCPaletteAccent100Name : ColorFromRGB(0x8C9EFF),
-                                    MDCPaletteAccent200Name : ColorFromRGB(0x536DFE),
-                                    MDCPaletteAccent400Name : ColorFromRGB(0x3D5AFE),
-                                    MDCPaletteAccent700Name : ColorFromRGB(0x304FFE)
-                                  }];
+    palette = [[self alloc] initWithRGBValues:kIndigoPaletteRGB count:kColorCount];
   });
   return palette;
 }
@@ -183,24 +262,7 @@ static inline UIColor *ColorFromRGB(uint32_t rgbValue) {
   static MDCPalette *palette;
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    palette = [[self alloc] initWithTints:@{
-      MDCPaletteTint50Name : ColorFromRGB(0xE3F2FD),
-      MDCPaletteTint100Name : ColorFromRGB(0xBBDEFB),
-      MDCPaletteTint200Name : ColorFromRGB(0x90CAF9),
-      MDCPaletteTint300Name : ColorFromRGB(0x64B5F6),
-      MDCPaletteTint400Name : ColorFromRGB(0x42A5F5),
-      MDCPaletteTint500Name : ColorFromRGB(0x2196F3),
-      MDCPaletteTint600Name : ColorFromRGB(0x1E88E5),
-      MDCPaletteTint700Name : ColorFromRGB(0x1976D2),
-      MDCPaletteTint800Name : ColorFromRGB(0x1565C0),
-      MDCPaletteTint900Name : ColorFromRGB(0x0D47A1)
-    }
-                                  accents:@{
-                                    MDCPaletteAccent100Name : ColorFromRGB(0x82B1FF),
-                                    MDCPaletteAccent200Name : ColorFromRGB(0x448AFF),
-                                    MDCPaletteAccent400Name : ColorFromRGB(0x2979FF),
-                                    MDCPaletteAccent700Name : ColorFromRGB(0x2962FF)
-                                  }];
+    palette = [[self alloc] initWithRGBValues:kBluePaletteRGB count:kColorCount];
   });
   return palette;
 }
@@ -209,24 +271,7 @@ static inline UIColor *ColorFromRGB(uint32_t rgbValue) {
   static MDCPalette *palette;
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    palette = [[self alloc] initWithTints:@{
-      MDCPaletteTint50Name : ColorFromRGB(0xE1F5FE),
-      MDCPaletteTint100Name : ColorFromRGB(0xB3E5FC),
-      MDCPaletteTint200Name : ColorFromRGB(0x81D4FA),
-      MDCPaletteTint300Name : ColorFromRGB(0x4FC3F7),
-      MDCPaletteTint400Name : ColorFromRGB(0x29B6F6),
-      MDCPaletteTint500Name : ColorFromRGB(0x03A9F4),
-      MDCPaletteTint600Name : ColorFromRGB(0x039BE5),
-      MDCPaletteTint700Name : ColorFromRGB(0x0288D1),
-      MDCPaletteTint800Name : ColorFromRGB(0x0277BD),
-      MDCPaletteTint900Name : ColorFromRGB(0x01579B)
-    }
-                                  accents:@{
-                                    MDCPaletteAccent100Name : ColorFromRGB(0x80D8FF),
-                                    MDCPaletteAccent200Name : ColorFromRGB(0x40C4FF),
-                                    MDCPaletteAccent400Name : ColorFromRGB(0x00B0FF),
-                                    MDCPaletteAccent700Name : ColorFromRGB(0x0091EA)
-                                  }];
+    palette = [[self alloc] initWithRGBValues:kLightBluePaletteRGB count:kColorCount];
   });
   return palette;
 }
@@ -235,24 +280,7 @@ static inline UIColor *ColorFromRGB(uint32_t rgbValue) {
   static MDCPalette *palette;
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    palette = [[self alloc] initWithTints:@{
-      MDCPaletteTint50Name : ColorFromRGB(0xE0F7FA),
-      MDCPaletteTint100Name : ColorFromRGB(0xB2EBF2),
-      MDCPaletteTint200Name : ColorFromRGB(0x80DEEA),
-      MDCPaletteTint300Name : ColorFromRGB(0x4DD0E1),
-      MDCPaletteTint400Name : ColorFromRGB(0x26C6DA),
-      MDCPaletteTint500Name : ColorFromRGB(0x00BCD4),
-      MDCPaletteTint600Name : ColorFromRGB(0x00ACC1),
-      MDCPaletteTint700Name : ColorFromRGB(0x0097A7),
-      MDCPaletteTint800Name : ColorFromRGB(0x00838F),
-      MDCPaletteTint900Name : ColorFromRGB(0x006064)
-    }
-                                  accents:@{
-                                    MDCPaletteAccent100Name : ColorFromRGB(0x84FFFF),
-                                    MDCPaletteAccent200Name : ColorFromRGB(0x18FFFF),
-                                    MDCPaletteAccent400Name : ColorFromRGB(0x00E5FF),
-                                    MDCPaletteAccent700Name : ColorFromRGB(0x00B8D4)
-                                  }];
+    palette = [[self alloc] initWithRGBValues:kCyanPaletteRGB count:kColorCount];
   });
   return palette;
 }
@@ -261,24 +289,7 @@ static inline UIColor *ColorFromRGB(uint32_t rgbValue) {
   static MDCPalette *palette;
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    palette = [[self alloc] initWithTints:@{
-      MDCPaletteTint50Name : ColorFromRGB(0xE0F2F1),
-      MDCPaletteTint100Name : ColorFromRGB(0xB2DFDB),
-      MDCPaletteTint200Name : ColorFromRGB(0x80CBC4),
-      MDCPaletteTint300Name : ColorFromRGB(0x4DB6AC),
-      MDCPaletteTint400Name : ColorFromRGB(0x26A69A),
-      MDCPaletteTint500Name : ColorFromRGB(0x009688),
-      MDCPaletteTint600Name : ColorFromRGB(0x00897B),
-      MDCPaletteTint700Name : ColorFromRGB(0x00796B),
-      MDCPaletteTint800Name : ColorFromRGB(0x00695C),
-      MDCPaletteTint900Name : ColorFromRGB(0x004D40)
-    }
-                                  accents:@{
-                                    MDCPaletteAccent100Name : ColorFromRGB(0xA7FFEB),
-                                    MDCPaletteAccent200Name : ColorFromRGB(0x64FFDA),
-                                    MDCPaletteAccent400Name : ColorFromRGB(0x1DE9B6),
-                                    MDCPaletteAccent700Name : ColorFromRGB(0x00BFA5)
-                                  }];
+    palette = [[self alloc] initWithRGBValues:kTealPaletteRGB count:kColorCount];
   });
   return palette;
 }
@@ -287,24 +298,7 @@ static inline UIColor *ColorFromRGB(uint32_t rgbValue) {
   static MDCPalette *palette;
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    palette = [[self alloc] initWithTints:@{
-      MDCPaletteTint50Name : ColorFromRGB(0xE8F5E9),
-      MDCPaletteTint100Name : ColorFromRGB(0xC8E6C9),
-      MDCPaletteTint200Name : ColorFromRGB(0xA5D6A7),
-      MDCPaletteTint300Name : ColorFromRGB(0x81C784),
-      MDCPaletteTint400Name : ColorFromRGB(0x66BB6A),
-      MDCPaletteTint500Name : ColorFromRGB(0x4CAF50),
-      MDCPaletteTint600Name : ColorFromRGB(0x43A047),
-      MDCPaletteTint700Name : ColorFromRGB(0x388E3C),
-      MDCPaletteTint800Name : ColorFromRGB(0x2E7D32),
-      MDCPaletteTint900Name : ColorFromRGB(0x1B5E20)
-    }
-                                  accents:@{
-                                    MDCPaletteAccent100Name : ColorFromRGB(0xB9F6CA),
-                                    MDCPaletteAccent200Name : ColorFromRGB(0x69F0AE),
-                                    MDCPaletteAccent400Name : ColorFromRGB(0x00E676),
-                                    MDCPaletteAccent700Name : ColorFromRGB(0x00C853)
-                                  }];
+    palette = [[self alloc] initWithRGBValues:kGreenPaletteRGB count:kColorCount];
   });
   return palette;
 }
@@ -313,24 +307,7 @@ static inline UIColor *ColorFromRGB(uint32_t rgbValue) {
   static MDCPalette *palette;
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    palette = [[self alloc] initWithTints:@{
-      MDCPaletteTint50Name : ColorFromRGB(0xF1F8E9),
-      MDCPaletteTint100Name : ColorFromRGB(0xDCEDC8),
-      MDCPaletteTint200Name : ColorFromRGB(0xC5E1A5),
-      MDCPaletteTint300Name : ColorFromRGB(0xAED581),
-      MDCPaletteTint400Name : ColorFromRGB(0x9CCC65),
-      MDCPaletteTint500Name : ColorFromRGB(0x8BC34A),
-      MDCPaletteTint600Name : ColorFromRGB(0x7CB342),
-      MDCPaletteTint700Name : ColorFromRGB(0x689F38),
-      MDCPaletteTint800Name : ColorFromRGB(0x558B2F),
-      MDCPaletteTint900Name : ColorFromRGB(0x33691E)
-    }
-                                  accents:@{
-                                    MDCPaletteAccent100Name : ColorFromRGB(0xCCFF90),
-                                    MDCPaletteAccent200Name : ColorFromRGB(0xB2FF59),
-                                    MDCPaletteAccent400Name : ColorFromRGB(0x76FF03),
-                                    MDCPaletteAccent700Name : ColorFromRGB(0x64DD17)
-                                  }];
+    palette = [[self alloc] initWithRGBValues:kLightGreenPaletteRGB count:kColorCount];
   });
   return palette;
 }
@@ -339,24 +316,7 @@ static inline UIColor *ColorFromRGB(uint32_t rgbValue) {
   static MDCPalette *palette;
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    palette = [[self alloc] initWithTints:@{
-      MDCPaletteTint50Name : ColorFromRGB(0xF9FBE7),
-      MDCPaletteTint100Name : ColorFromRGB(0xF0F4C3),
-      MDCPaletteTint200Name : ColorFromRGB(0xE6EE9C),
-      MDCPaletteTint300Name : ColorFromRGB(0xDCE775),
-      MDCPaletteTint400Name : ColorFromRGB(0xD4E157),
-      MDCPaletteTint500Name : ColorFromRGB(0xCDDC39),
-      MDCPaletteTint600Name : ColorFromRGB(0xC0CA33),
-      MDCPaletteTint700Name : ColorFromRGB(0xAFB42B),
-      MDCPaletteTint800Name : ColorFromRGB(0x9E9D24),
-      MDCPaletteTint900Name : ColorFromRGB(0x827717)
-    }
-                                  accents:@{
-                                    MDCPaletteAccent100Name : ColorFromRGB(0xF4FF81),
-                                    MDCPaletteAccent200Name : ColorFromRGB(0xEEFF41),
-                                    MDCPaletteAccent400Name : ColorFromRGB(0xC6FF00),
-                                    MDCPaletteAccent700Name : ColorFromRGB(0xAEEA00)
-                                  }];
+    palette = [[self alloc] initWithRGBValues:kLimePaletteRGB count:kColorCount];
   });
   return palette;
 }
@@ -365,24 +325,7 @@ static inline UIColor *ColorFromRGB(uint32_t rgbValue) {
   static MDCPalette *palette;
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    palette = [[self alloc] initWithTints:@{
-      MDCPaletteTint50Name : ColorFromRGB(0xFFFDE7),
-      MDCPaletteTint100Name : ColorFromRGB(0xFFF9C4),
-      MDCPaletteTint200Name : ColorFromRGB(0xFFF59D),
-      MDCPaletteTint300Name : ColorFromRGB(0xFFF176),
-      MDCPaletteTint400Name : ColorFromRGB(0xFFEE58),
-      MDCPaletteTint500Name : ColorFromRGB(0xFFEB3B),
-      MDCPaletteTint600Name : ColorFromRGB(0xFDD835),
-      MDCPaletteTint700Name : ColorFromRGB(0xFBC02D),
-      MDCPaletteTint800Name : ColorFromRGB(0xF9A825),
-      MDCPaletteTint900Name : ColorFromRGB(0xF57F17)
-    }
-                                  accents:@{
-                                    MDCPaletteAccent100Name : ColorFromRGB(0xFFFF8D),
-                                    MDCPaletteAccent200Name : ColorFromRGB(0xFFFF00),
-                                    MDCPaletteAccent400Name : ColorFromRGB(0xFFEA00),
-                                    MDCPaletteAccent700Name : ColorFromRGB(0xFFD600)
-                                  }];
+    palette = [[self alloc] initWithRGBValues:kYellowPaletteRGB count:kColorCount];
   });
   return palette;
 }
@@ -391,24 +334,7 @@ static inline UIColor *ColorFromRGB(uint32_t rgbValue) {
   static MDCPalette *palette;
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    palette = [[self alloc] initWithTints:@{
-      MDCPaletteTint50Name : ColorFromRGB(0xFFF8E1),
-      MDCPaletteTint100Name : ColorFromRGB(0xFFECB3),
-      MDCPaletteTint200Name : ColorFromRGB(0xFFE082),
-      MDCPaletteTint300Name : ColorFromRGB(0xFFD54F),
-      MDCPaletteTint400Name : ColorFromRGB(0xFFCA28),
-      MDCPaletteTint500Name : ColorFromRGB(0xFFC107),
-      MDCPaletteTint600Name : ColorFromRGB(0xFFB300),
-      MDCPaletteTint700Name : ColorFromRGB(0xFFA000),
-      MDCPaletteTint800Name : ColorFromRGB(0xFF8F00),
-      MDCPaletteTint900Name : ColorFromRGB(0xFF6F00)
-    }
-                                  accents:@{
-                                    MDCPaletteAccent100Name : ColorFromRGB(0xFFE57F),
-                                    MDCPaletteAccent200Name : ColorFromRGB(0xFFD740),
-                                    MDCPaletteAccent400Name : ColorFromRGB(0xFFC400),
-                                    MDCPaletteAccent700Name : ColorFromRGB(0xFFAB00)
-                                  }];
+    palette = [[self alloc] initWithRGBValues:kAmberPaletteRGB count:kColorCount];
   });
   return palette;
 }
@@ -417,24 +343,7 @@ static inline UIColor *ColorFromRGB(uint32_t rgbValue) {
   static MDCPalette *palette;
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    palette = [[self alloc] initWithTints:@{
-      MDCPaletteTint50Name : ColorFromRGB(0xFFF3E0),
-      MDCPaletteTint100Name : ColorFromRGB(0xFFE0B2),
-      MDCPaletteTint200Name : ColorFromRGB(0xFFCC80),
-      MDCPaletteTint300Name : ColorFromRGB(0xFFB74D),
-      MDCPaletteTint400Name : ColorFromRGB(0xFFA726),
-      MDCPaletteTint500Name : ColorFromRGB(0xFF9800),
-      MDCPaletteTint600Name : ColorFromRGB(0xFB8C00),
-      MDCPaletteTint700Name : ColorFromRGB(0xF57C00),
-      MDCPaletteTint800Name : ColorFromRGB(0xEF6C00),
-      MDCPaletteTint900Name : ColorFromRGB(0xE65100)
-    }
-                                  accents:@{
-                                    MDCPaletteAccent100Name : ColorFromRGB(0xFFD180),
-                                    MDCPaletteAccent200Name : ColorFromRGB(0xFFAB40),
-                                    MDCPaletteAccent400Name : ColorFromRGB(0xFF9100),
-                                    MDCPaletteAccent700Name : ColorFromRGB(0xFF6D00)
-                                  }];
+    palette = [[self alloc] initWithRGBValues:kOrangePaletteRGB count:kColorCount];
   });
   return palette;
 }
@@ -443,24 +352,7 @@ static inline UIColor *ColorFromRGB(uint32_t rgbValue) {
   static MDCPalette *palette;
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    palette = [[self alloc] initWithTints:@{
-      MDCPaletteTint50Name : ColorFromRGB(0xFBE9E7),
-      MDCPaletteTint100Name : ColorFromRGB(0xFFCCBC),
-      MDCPaletteTint200Name : ColorFromRGB(0xFFAB91),
-      MDCPaletteTint300Name : ColorFromRGB(0xFF8A65),
-      MDCPaletteTint400Name : ColorFromRGB(0xFF7043),
-      MDCPaletteTint500Name : ColorFromRGB(0xFF5722),
-      MDCPaletteTint600Name : ColorFromRGB(0xF4511E),
-      MDCPaletteTint700Name : ColorFromRGB(0xE64A19),
-      MDCPaletteTint800Name : ColorFromRGB(0xD84315),
-      MDCPaletteTint900Name : ColorFromRGB(0xBF360C)
-    }
-                                  accents:@{
-                                    MDCPaletteAccent100Name : ColorFromRGB(0xFF9E80),
-                                    MDCPaletteAccent200Name : ColorFromRGB(0xFF6E40),
-                                    MDCPaletteAccent400Name : ColorFromRGB(0xFF3D00),
-                                    MDCPaletteAccent700Name : ColorFromRGB(0xDD2C00)
-                                  }];
+    palette = [[self alloc] initWithRGBValues:kDeepOrangePaletteRGB count:kColorCount];
   });
   return palette;
 }
@@ -469,19 +361,7 @@ static inline UIColor *ColorFromRGB(uint32_t rgbValue) {
   static MDCPalette *palette;
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    palette = [[self alloc] initWithTints:@{
-      MDCPaletteTint50Name : ColorFromRGB(0xEFEBE9),
-      MDCPaletteTint100Name : ColorFromRGB(0xD7CCC8),
-      MDCPaletteTint200Name : ColorFromRGB(0xBCAAA4),
-      MDCPaletteTint300Name : ColorFromRGB(0xA1887F),
-      MDCPaletteTint400Name : ColorFromRGB(0x8D6E63),
-      MDCPaletteTint500Name : ColorFromRGB(0x795548),
-      MDCPaletteTint600Name : ColorFromRGB(0x6D4C41),
-      MDCPaletteTint700Name : ColorFromRGB(0x5D4037),
-      MDCPaletteTint800Name : ColorFromRGB(0x4E342E),
-      MDCPaletteTint900Name : ColorFromRGB(0x3E2723)
-    }
-                                  accents:nil];
+    palette = [[self alloc] initWithRGBValues:kBrownPaletteRGB count:kTintCount];
   });
   return palette;
 }
@@ -490,19 +370,7 @@ static inline UIColor *ColorFromRGB(uint32_t rgbValue) {
   static MDCPalette *palette;
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    palette = [[self alloc] initWithTints:@{
-      MDCPaletteTint50Name : ColorFromRGB(0xFAFAFA),
-      MDCPaletteTint100Name : ColorFromRGB(0xF5F5F5),
-      MDCPaletteTint200Name : ColorFromRGB(0xEEEEEE),
-      MDCPaletteTint300Name : ColorFromRGB(0xE0E0E0),
-      MDCPaletteTint400Name : ColorFromRGB(0xBDBDBD),
-      MDCPaletteTint500Name : ColorFromRGB(0x9E9E9E),
-      MDCPaletteTint600Name : ColorFromRGB(0x757575),
-      MDCPaletteTint700Name : ColorFromRGB(0x616161),
-      MDCPaletteTint800Name : ColorFromRGB(0x424242),
-      MDCPaletteTint900Name : ColorFromRGB(0x212121)
-    }
-                                  accents:nil];
+    palette = [[self alloc] initWithRGBValues:kGreyPaletteRGB count:kTintCount];
   });
   return palette;
 }
@@ -511,23 +379,12 @@ static inline UIColor *ColorFromRGB(uint32_t rgbValue) {
   static MDCPalette *palette;
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    palette = [[self alloc] initWithTints:@{
-      MDCPaletteTint50Name : ColorFromRGB(0xECEFF1),
-      MDCPaletteTint100Name : ColorFromRGB(0xCFD8DC),
-      MDCPaletteTint200Name : ColorFromRGB(0xB0BEC5),
-      MDCPaletteTint300Name : ColorFromRGB(0x90A4AE),
-      MDCPaletteTint400Name : ColorFromRGB(0x78909C),
-      MDCPaletteTint500Name : ColorFromRGB(0x607D8B),
-      MDCPaletteTint600Name : ColorFromRGB(0x546E7A),
-      MDCPaletteTint700Name : ColorFromRGB(0x455A64),
-      MDCPaletteTint800Name : ColorFromRGB(0x37474F),
-      MDCPaletteTint900Name : ColorFromRGB(0x263238)
-    }
-                                  accents:nil];
+    palette = [[self alloc] initWithRGBValues:kBlueGreyPaletteRGB count:kTintCount];
   });
   return palette;
 }
 
+
 + (instancetype)paletteGeneratedFromColor:(nonnull UIColor *)target500Color {
   NSArray *tintNames = @[
     MDCPaletteTint50Name, MDCPaletteTint100Name, MDCPaletteTint200Name, MDCPaletteTint300Name,
@@ -562,82 +419,124 @@ static inline UIColor *ColorFromRGB(uint32_t rgbValue) {
                       accents:(NSDictionary<MDCPaletteAccent, UIColor *> *)accents {
   self = [super init];
   if (self) {
-    _accents = accents ? [accents copy] : @{};
-
-    // Check if all the accent colors are present.
-    NSDictionary<MDCPaletteTint, UIColor *> *allTints = tints;
-    NSMutableSet<MDCPaletteAccent> *requiredTintKeys =
+    // Check if all the tint colors are present.
+    NSMutableSet<MDCPaletteTint> *requiredTintKeys =
         [NSMutableSet setWithSet:[[self class] requiredTintKeys]];
     [requiredTintKeys minusSet:[NSSet setWithArray:[tints allKeys]]];
     if ([requiredTintKeys count] != 0) {
-      NSAssert(NO, @"Missing accent colors for the following keys: %@.", requiredTintKeys);
-      NSMutableDictionary<MDCPaletteTint, UIColor *> *replacementTints =
-          [NSMutableDictionary dictionaryWithDictionary:_accents];
-      for (MDCPaletteTint tintKey in requiredTintKeys) {
-        [replacementTints setObject:[UIColor clearColor] forKey:tintKey];
-      }
-      allTints = replacementTints;
+      NSAssert(NO, @"Missing tint colors for the following keys: %@.", requiredTintKeys);
     }
 
-    _tints = [allTints copy];
+    for (NSInteger index = MDCPaletteColorIndexTint50; index <= MDCPaletteColorIndexTint900;
+         ++index) {
+      UIColor *tint = tints[MDCPaletteNameForIndex(index)] ?: [UIColor clearColor];
+      atomic_init(&_colors[index], (void *)CFBridgingRetain(tint));
+    }
+    for (NSInteger index = MDCPaletteColorIndexAccent100; index <= MDCPaletteColorIndexAccent700;
+         ++index) {
+      UIColor *accent = accents[MDCPaletteNameForIndex(index)];
+      atomic_init(&_colors[index], accent ? (void *)CFBridgingRetain(accent) : NULL);
+    }
+  }
+  return self;
+}
+
+- (instancetype)initWithRGBValues:(const uint32_t *)rgbValues count:(NSInteger)count {
+  self = [super init];
+  if (self) {
+    NSAssert(count == kTintCount || count == kColorCount, @"Invalid number of colors %@.",
+             @(count));
+    _rgbValues = rgbValues;
+    _rgbCount = count;
+    for (NSInteger index = 0; index < kColorCount; ++index) {
+      atomic_init(&_colors[index], NULL);
+    }
   }
   return self;
 }
 
+- (void)dealloc {
+  for (NSInteger index = 0; index < kColorCount; ++index) {
+    void *color = atomic_load_explicit(&_colors[index], memory_order_relaxed);
+    if (color) {
+      CFRelease(color);
+    }
+  }
+}
+
+- (UIColor *)colorAtIndex:(MDCPaletteColorIndex)index {
+  if (index < 0 || index >= kColorCount) {
+    return nil;
+  }
+  void *color = atomic_load_explicit(&_colors[index], memory_order_acquire);
+  if (color || index >= _rgbCount) {
+    return (__bridge UIColor *)color;
+  }
+
+  // Materialize the color on first access. If another thread wins the race, use its color.
+  void *newColor = (void *)CFBridgingRetain(ColorFromRGB(_rgbValues[index]));
+  if (atomic_compare_exchange_strong_explicit(&_colors[index], &color, newColor,
+                                              memory_order_acq_rel, memory_order_acquire)) {
+    return (__bridge UIColor *)newColor;
+  }
+  CFRelease(newColor);
+  return (__bridge UIColor *)color;
+}
+
 - (UIColor *)tint50 {
-  return _tints[MDCPaletteTint50Name];
+  return [self colorAtIndex:MDCPaletteColorIndexTint50];
 }
 
 - (UIColor *)tint100 {
-  return _tints[MDCPaletteTint100Name];
+  return [self colorAtIndex:MDCPaletteColorIndexTint100];
 }
 
 - (UIColor *)tint200 {
-  return _tints[MDCPaletteTint200Name];
+  return [self colorAtIndex:MDCPaletteColorIndexTint200];
 }
 
 - (UIColor *)tint300 {
-  return _tints[MDCPaletteTint300Name];
+  return [self colorAtIndex:MDCPaletteColorIndexTint300];
 }
 
 - (UIColor *)tint400 {
-  return _tints[MDCPaletteTint400Name];
+  return [self colorAtIndex:MDCPaletteColorIndexTint400];
 }
 
 - (UIColor *)tint500 {
-  return _tints[MDCPaletteTint500Name];
+  return [self colorAtIndex:MDCPaletteColorIndexTint500];
 }
 
 - (UIColor *)tint600 {
-  return _tints[MDCPaletteTint600Name];
+  return [self colorAtIndex:MDCPaletteColorIndexTint600];
 }
 
 - (UIColor *)tint700 {
-  return _tints[MDCPaletteTint700Name];
+  return [self colorAtIndex:MDCPaletteColorIndexTint700];
 }
 
 - (UIColor *)tint800 {
-  return _tints[MDCPaletteTint800Name];
+  return [self colorAtIndex:MDCPaletteColorIndexTint800];
 }
 
 - (UIColor *)tint900 {
-  return _tints[MDCPaletteTint900Name];
+  return [self colorAtIndex:MDCPaletteColorIndexTint900];
 }
 
 - (UIColor *)accent100 {
-  return _accents[MDCPaletteAccent100Name];
+  return [self colorAtIndex:MDCPaletteColorIndexAccent100];
 }
 
 - (UIColor *)accent200 {
-  return _accents[MDCPaletteAccent200Name];
+  return [self colorAtIndex:MDCPaletteColorIndexAccent200];
 }
 
 - (UIColor *)accent400 {
-  return _accents[MDCPaletteAccent400Name];
+  return [self colorAtIndex:MDCPaletteColorIndexAccent400];
 }
 
 - (UIColor *)accent700 {
-  return _accents[MDCPaletteAccent700Name];
+  return [self colorAtIndex:MDCPaletteColorIndexAccent700];
 }
 
 #pragma mark - Private methods
@@ -107,30 +107,9 @@ static void ColorToHSB(UIColor *_Nonnull color, CGFloat hsb[4]) {
 
 /** Return the ordered index of a tint/accent by name. */
 static int NameToIndex(NSString *_Nonnull name) {
-  static NSDictionary *map = nil;
-  static dispatch_once_t onceToken;
-  dispatch_once(&onceToken, ^{
-    map = @{
-      MDC_PALETTE_TINT_50_INTERNAL_NAME : @(kQTMColorTint50Index),
-      MDC_PALETTE_TINT_100_INTERNAL_NAME : @(kQTMColorTint100Index),
-      MDC_PALETTE_TINT_200_INTERNAL_NAME : @(kQTMColorTint200Index),
-      MDC_PALETTE_TINT_300_INTERNAL_NAME : @(kQTMColorTint300Index),
-      MDC_PALETTE_TINT_400_INTERNAL_NAME : @(kQTMColorTint400Index),
-      MDC_PALETTE_TINT_500_INTERNAL_NAME : @(kQTMColorTint500Index),
-      MDC_PALETTE_TINT_600_INTERNAL_NAME : @(kQTMColorTint600Index),
-      MDC_PALETTE_TINT_700_INTERNAL_NAME : @(kQTMColorTint700Index),
-      MDC_PALETTE_TINT_800_INTERNAL_NAME : @(kQTMColorTint800Index),
-      MDC_PALETTE_TINT_900_INTERNAL_NAME : @(kQTMColorTint900Index),
-      MDC_PALETTE_ACCENT_100_INTERNAL_NAME : @(kQTMColorAccent100Index),
-      MDC_PALETTE_ACCENT_200_INTERNAL_NAME : @(kQTMColorAccent200Index),
-      MDC_PALETTE_ACCENT_400_INTERNAL_NAME : @(kQTMColorAccent400Index),
-      MDC_PALETTE_ACCENT_700_INTERNAL_NAME : @(kQTMColorAccent700Index)
-    };
-  });
-
-  NSNumber *index = map[name];
-  if (index != nil) {
-    return [index intValue];
+  NSInteger index = MDCPaletteIndexForName(name);
+  if (index != NSNotFound) {
+    return (int)index;
   } else {
     NSCAssert(NO, @"%@ is not a valid tint/accent name.", name);
     return kQTMColorTint500Index;
@@ -54,3 +54,15 @@
 
 /** Return YES if a string is one of the pre-defined tint/accent names. */
 BOOL MDCPaletteIsTintOrAccentName(NSString* _Nonnull name);
+
+/** The number of pre-defined tint and accent names. */
+#define MDC_PALETTE_COLOR_NAME_COUNT 14
+
+/**
+ Returns the ordered index of a pre-defined tint/accent name, from 0 for the 50 tint to 13 for the
+ A700 accent, or NSNotFound if @c name is not one of the pre-defined names.
+ */
+NSInteger MDCPaletteIndexForName(NSString* _Nonnull name);
+
+/** Returns the pre-defined tint/accent name at @c index, which must be a valid index. */
+NSString* _Nonnull MDCPaletteNameForIndex(NSInteger index);
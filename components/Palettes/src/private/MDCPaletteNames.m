@@ -14,19 +14,38 @@
 
 #import "MDCPaletteNames.h"
 
+static NSString* const kPaletteColorNames[MDC_PALETTE_COLOR_NAME_COUNT] = {
+    MDC_PALETTE_TINT_50_INTERNAL_NAME,    MDC_PALETTE_TINT_100_INTERNAL_NAME,
+    MDC_PALETTE_TINT_200_INTERNAL_NAME,   MDC_PALETTE_TINT_300_INTERNAL_NAME,
+    MDC_PALETTE_TINT_400_INTERNAL_NAME,   MDC_PALETTE_TINT_500_INTERNAL_NAME,
+    MDC_PALETTE_TINT_600_INTERNAL_NAME,   MDC_PALETTE_TINT_700_INTERNAL_NAME,
+    MDC_PALETTE_TINT_800_INTERNAL_NAME,   MDC_PALETTE_TINT_900_INTERNAL_NAME,
+    MDC_PALETTE_ACCENT_100_INTERNAL_NAME, MDC_PALETTE_ACCENT_200_INTERNAL_NAME,
+    MDC_PALETTE_ACCENT_400_INTERNAL_NAME, MDC_PALETTE_ACCENT_700_INTERNAL_NAME,
+};
+
+NSInteger MDCPaletteIndexForName(NSString* _Nonnull name) {
+  // Callers almost always pass the name constants themselves, which a pointer comparison finds
+  // without comparing any characters.
+  for (NSInteger index = 0; index < MDC_PALETTE_COLOR_NAME_COUNT; ++index) {
+    if (name == kPaletteColorNames[index]) {
+      return index;
+    }
+  }
+  for (NSInteger index = 0; index < MDC_PALETTE_COLOR_NAME_COUNT; ++index) {
+    if ([name isEqualToString:kPaletteColorNames[index]]) {
+      return index;
+    }
+  }
+  return NSNotFound;
+}
+
+NSString* _Nonnull MDCPaletteNameForIndex(NSInteger index) {
+  NSCAssert(index >= 0 && index < MDC_PALETTE_COLOR_NAME_COUNT, @"Invalid tint/accent index %@.",
+            @(index));
+  return kPaletteColorNames[index];
+}
+
 BOOL MDCPaletteIsTintOrAccentName(NSString* _Nonnull name) {
-  return [name isEqualToString:MDC_PALETTE_TINT_50_INTERNAL_NAME] ||
-         [name isEqualToString:MDC_PALETTE_TINT_100_INTERNAL_NAME] ||
-         [name isEqualToString:MDC_PALETTE_TINT_200_INTERNAL_NAME] ||
-         [name isEqualToString:MDC_PALETTE_TINT_300_INTERNAL_NAME] ||
-         [name isEqualToString:MDC_PALETTE_TINT_400_INTERNAL_NAME] ||
-         [name isEqualToString:MDC_PALETTE_TINT_500_INTERNAL_NAME] ||
-         [name isEqualToString:MDC_PALETTE_TINT_600_INTERNAL_NAME] ||
-         [name isEqualToString:MDC_PALETTE_TINT_700_INTERNAL_NAME] ||
-         [name isEqualToString:MDC_PALETTE_TINT_800_INTERNAL_NAME] ||
-         [name isEqualToString:MDC_PALETTE_TINT_900_INTERNAL_NAME] ||
-         [name isEqualToString:MDC_PALETTE_ACCENT_100_INTERNAL_NAME] ||
-         [name isEqualToString:MDC_PALETTE_ACCENT_200_INTERNAL_NAME] ||
-         [name isEqualToString:MDC_PALETTE_ACCENT_400_INTERNAL_NAME] ||
-         [name isEqualToString:MDC_PALETTE_ACCENT_700_INTERNAL_NAME];
+  return MDCPaletteIndexForName(name) != NSNotFound;
 }
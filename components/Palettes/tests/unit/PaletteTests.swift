@@ -94,4 +94,38 @@ class PaletteTests: XCTestCase {
     XCTAssertEqual(palette.accent400, accents[.accent400Name])
     XCTAssertEqual(palette.accent700, accents[.accent700Name])
   }
+
+  func testColorAtIndexMatchesProperties() {
+    let palette = MDCPalette.deepPurple
+    XCTAssertEqual(palette.color(at: .tint50), palette.tint50)
+    XCTAssertEqual(palette.color(at: .tint500), palette.tint500)
+    XCTAssertEqual(palette.color(at: .tint900), palette.tint900)
+    XCTAssertEqual(palette.color(at: .accent100), palette.accent100)
+    XCTAssertEqual(palette.color(at: .accent700), palette.accent700)
+    XCTAssertEqual(palette.color(at: .tint500), colorFromRGB(0x673AB7))
+    XCTAssertEqual(palette.color(at: .accent700), colorFromRGB(0x6200EA))
+  }
+
+  func testColorAtIndexForMissingAccentIsNil() {
+    XCTAssertNil(MDCPalette.blueGrey.color(at: .accent200))
+    XCTAssertNotNil(MDCPalette.blueGrey.color(at: .tint900))
+  }
+
+  func testColorsAreCreatedOnce() {
+    let first = MDCPalette.teal.tint300
+    let second = MDCPalette.teal.color(at: .tint300)
+    XCTAssertTrue(first === second)
+  }
+
+  func testPerformanceColorAtIndex() {
+    let palettes: [MDCPalette] = [.red, .pink, .purple, .indigo, .blue, .teal, .green, .grey]
+    measure {
+      for _ in 0..<1000 {
+        for palette in palettes {
+          _ = palette.color(at: .tint500)
+          _ = palette.color(at: .accent200)
+        }
+      }
+    }
+  }
 }
@@ -14,6 +14,7 @@
 
 #import "MDCRippleView.h"
 #import "private/MDCRippleLayer.h"
+#import "private/MDCRippleView+Private.h"
 
 #import "MaterialMath.h"
 
@@ -35,8 +36,12 @@
 
 static const CGFloat kRippleDefaultAlpha = (CGFloat)0.16;
 static const CGFloat kRippleFadeOutDelay = (CGFloat)0.15;
+// Rapid taps rarely overlap more than a couple of ripples, so a small pool covers them.
+static const NSUInteger kMaximumReusableRippleLayers = 3;
 
-@implementation MDCRippleView
+@implementation MDCRippleView {
+  NSMutableArray<MDCRippleLayer *> *_reusableRippleLayers;
+}
 
 - (instancetype)initWithFrame:(CGRect)frame {
   self = [super initWithFrame:frame];
@@ -67,6 +72,8 @@ static const CGFloat kRippleFadeOutDelay = (CGFloat)0.15;
   // Use mask layer when the superview has a shadowPath.
   _maskLayer = [CAShapeLayer layer];
   _maskLayer.delegate = self;
+
+  _reusableRippleLayers = [NSMutableArray array];
 }
 
 - (void)layoutSubviews {
@@ -136,6 +143,7 @@ static const CGFloat kRippleFadeOutDelay = (CGFloat)0.15;
       if ([layer isKindOfClass:[MDCRippleLayer class]]) {
         MDCRippleLayer *rippleLayer = (MDCRippleLayer *)layer;
         [rippleLayer removeFromSuperlayer];
+        [self enqueueReusableRippleLayer:rippleLayer];
       }
     }
   }
@@ -151,7 +159,7 @@ static const CGFloat kRippleFadeOutDelay = (CGFloat)0.15;
 - (void)beginRippleTouchDownAtPoint:(CGPoint)point
                            animated:(BOOL)animated
                          completion:(nullable MDCRippleCompletionBlock)completion {
-  MDCRippleLayer *rippleLayer = [MDCRippleLayer layer];
+  MDCRippleLayer *rippleLayer = [self dequeueReusableRippleLayer];
   rippleLayer.rippleLayerDelegate = self;
   rippleLayer.fillColor = self.rippleColor.CGColor;
   rippleLayer.frame = self.bounds;
@@ -163,6 +171,34 @@ static const CGFloat kRippleFadeOutDelay = (CGFloat)0.15;
   self.activeRippleLayer = rippleLayer;
 }
 
+- (MDCRippleLayer *)dequeueReusableRippleLayer {
+  MDCRippleLayer *rippleLayer = [_reusableRippleLayers lastObject];
+  if (rippleLayer) {
+    [_reusableRippleLayers removeLastObject];
+    _rippleLayerReuseCount += 1;
+    return rippleLayer;
+  }
+  _rippleLayerAllocationCount += 1;
+  return [MDCRippleLayer layer];
+}
+
+- (void)enqueueReusableRippleLayer:(MDCRippleLayer *)rippleLayer {
+  // A layer whose touch down animation is still running may still be the active ripple, unless it
+  // has already been removed.
+  if ((rippleLayer.superlayer && rippleLayer.isStartAnimationActive) ||
+      _reusableRippleLayers.count >= kMaximumReusableRippleLayers ||
+      [_reusableRippleLayers containsObject:rippleLayer]) {
+    return;
+  }
+  if (_activeRippleLayer == rippleLayer) {
+    _activeRippleLayer = nil;
+  }
+  // Pool the layer before preparing it, because -prepareForReuse ends the layer's pending
+  // animations and the resulting delegate calls enqueue the layer again.
+  [_reusableRippleLayers addObject:rippleLayer];
+  [rippleLayer prepareForReuse];
+}
+
 - (void)beginRippleTouchUpAnimated:(BOOL)animated
                         completion:(nullable MDCRippleCompletionBlock)completion {
   [self.activeRippleLayer endRippleAnimated:animated completion:completion];
@@ -207,6 +243,8 @@ static const CGFloat kRippleFadeOutDelay = (CGFloat)0.15;
   if ([self.rippleViewDelegate respondsToSelector:@selector(rippleTouchUpAnimationDidEnd:)]) {
     [self.rippleViewDelegate rippleTouchUpAnimationDidEnd:self];
   }
+  // The layer removes itself from its superlayer once this returns.
+  [self enqueueReusableRippleLayer:rippleLayer];
 }
 
 #pragma mark - CALayerDelegate
@@ -53,6 +53,20 @@ typedef void (^MDCRippleCompletionBlock)(void);
  */
 @property(nonatomic, assign) CGFloat maximumRadius;
 
+/**
+ The number of CAAnimation objects this layer has created. The layer builds its animations once and
+ reconfigures them for subsequent ripples, so this only grows during the layer's first ripple.
+ */
+@property(nonatomic, assign, readonly) NSUInteger animationAllocationCount;
+
+/**
+ Returns the layer to its initial state so that it can be used for another ripple.
+
+ The delegate is sent the end of any touch down or touch up animation that was still running, so
+ that every begin is matched by an end.
+ */
+- (void)prepareForReuse;
+
 /**
  Starts the ripple at the given point.
 
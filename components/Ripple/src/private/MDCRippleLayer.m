@@ -15,6 +15,7 @@
 #import "MDCRippleLayer.h"
 #import "MaterialAnimationTiming.h"
 #import "MaterialMath.h"
+#import "MaterialOvalPathCache.h"
 
 static const CGFloat kExpandRippleBeyondSurface = 10;
 static const CGFloat kRippleStartingScale = (CGFloat)0.6;
@@ -32,7 +33,76 @@ static CGFloat GetDefaultRippleRadius(CGRect rect) {
   return (CGFloat)(MDCHypot(CGRectGetMidX(rect), CGRectGetMidY(rect)) + kExpandRippleBeyondSurface);
 }
 
-@implementation MDCRippleLayer
+// The scale and fade-in parts of the touch down animation are the same for every ripple.
+static CAAnimation *SharedTouchDownScaleAnimation(void) {
+  static CABasicAnimation *scaleAnim;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    scaleAnim = [[CABasicAnimation alloc] init];
+    scaleAnim.keyPath = kRippleLayerScaleString;
+    scaleAnim.fromValue = @(kRippleStartingScale);
+    scaleAnim.toValue = @1;
+    scaleAnim.timingFunction =
+        [CAMediaTimingFunction mdc_functionWithType:MDCAnimationTimingFunctionStandard];
+  });
+  return scaleAnim;
+}
+
+static CAAnimation *SharedTouchDownFadeInAnimation(void) {
+  static CABasicAnimation *fadeInAnim;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    fadeInAnim = [[CABasicAnimation alloc] init];
+    fadeInAnim.keyPath = kRippleLayerOpacityString;
+    fadeInAnim.fromValue = @0;
+    fadeInAnim.toValue = @1;
+    fadeInAnim.duration = kRippleFadeInDuration;
+    fadeInAnim.timingFunction =
+        [CAMediaTimingFunction functionWithName:kCAMediaTimingFunctionLinear];
+  });
+  return fadeInAnim;
+}
+
+@implementation MDCRippleLayer {
+  // Animations are built once per layer and reconfigured for each ripple. This is safe because
+  // -addAnimation:forKey: copies the animation it is given.
+  CAAnimationGroup *_touchDownAnimation;
+  CAKeyframeAnimation *_touchDownPositionAnimation;
+  CABasicAnimation *_touchUpAnimation;
+  CABasicAnimation *_fadeInAnimation;
+  CABasicAnimation *_fadeOutAnimation;
+
+  // The inputs of the current path, so unchanged paths are not looked up again.
+  CGFloat _pathRadius;
+  CGPoint _pathCenter;
+
+  // Incremented on reuse so that completion blocks of a previous ripple do not affect the next one.
+  NSUInteger _reuseGeneration;
+
+  // Whether a touch up animation has begun whose end has not been sent to the delegate yet.
+  BOOL _touchUpAnimationActive;
+}
+
+- (void)prepareForReuse {
+  _reuseGeneration += 1;
+  [self removeAllAnimations];
+  BOOL touchDownAnimationWasActive = _startAnimationActive;
+  BOOL touchUpAnimationWasActive = _touchUpAnimationActive;
+  _startAnimationActive = NO;
+  _touchUpAnimationActive = NO;
+  _rippleTouchDownStartTime = 0;
+  self.maximumRadius = 0;
+  id<MDCRippleLayerDelegate> delegate = self.rippleLayerDelegate;
+  self.rippleLayerDelegate = nil;
+
+  // The completion blocks of the cancelled animations are ignored, so send their ends here.
+  if (touchDownAnimationWasActive) {
+    [delegate rippleLayerTouchDownAnimationDidEnd:self];
+  }
+  if (touchUpAnimationWasActive) {
+    [delegate rippleLayerTouchUpAnimationDidEnd:self];
+  }
+}
 
 - (void)setNeedsLayout {
   [super setNeedsLayout];
@@ -44,10 +114,15 @@ static CGFloat GetDefaultRippleRadius(CGRect rect) {
 - (void)setPathFromRadii {
   CGFloat radius =
       self.maximumRadius > 0 ? self.maximumRadius : GetDefaultRippleRadius(self.bounds);
-  CGRect ovalRect = CGRectMake(CGRectGetMidX(self.bounds) - radius,
-                               CGRectGetMidY(self.bounds) - radius, radius * 2, radius * 2);
-  UIBezierPath *circlePath = [UIBezierPath bezierPathWithOvalInRect:ovalRect];
-  self.path = circlePath.CGPath;
+  CGPoint center = CGPointMake(CGRectGetMidX(self.bounds), CGRectGetMidY(self.bounds));
+  if (self.path && radius == _pathRadius && CGPointEqualToPoint(center, _pathCenter)) {
+    return;
+  }
+  self.path = [[MDCOvalPathCache sharedCache] circlePathWithCenter:center
+                                                           radius:radius
+                                                            scale:[UIScreen mainScreen].scale];
+  _pathRadius = radius;
+  _pathCenter = center;
 }
 
 - (void)startRippleAtPoint:(CGPoint)point
@@ -62,48 +137,48 @@ static CGFloat GetDefaultRippleRadius(CGRect rect) {
   } else {
     _startAnimationActive = YES;
 
-    CABasicAnimation *scaleAnim = [[CABasicAnimation alloc] init];
-    scaleAnim.keyPath = kRippleLayerScaleString;
-    scaleAnim.fromValue = @(kRippleStartingScale);
-    scaleAnim.toValue = @1;
-    scaleAnim.timingFunction =
-        [CAMediaTimingFunction mdc_functionWithType:MDCAnimationTimingFunctionStandard];
-
-    UIBezierPath *centerPath = [UIBezierPath bezierPath];
+    CGMutablePathRef centerPath = CGPathCreateMutable();
     CGPoint startPoint = point;
     CGPoint endPoint = CGPointMake(CGRectGetMidX(self.bounds), CGRectGetMidY(self.bounds));
-    [centerPath moveToPoint:startPoint];
-    [centerPath addLineToPoint:endPoint];
-    [centerPath closePath];
-
-    CAKeyframeAnimation *positionAnim = [[CAKeyframeAnimation alloc] init];
-    positionAnim.keyPath = kRippleLayerPositionString;
-    positionAnim.path = centerPath.CGPath;
-    positionAnim.keyTimes = @[ @0, @1 ];
-    positionAnim.values = @[ @0, @1 ];
-    positionAnim.timingFunction =
-        [CAMediaTimingFunction mdc_functionWithType:MDCAnimationTimingFunctionStandard];
+    CGPathMoveToPoint(centerPath, NULL, startPoint.x, startPoint.y);
+    CGPathAddLineToPoint(centerPath, NULL, endPoint.x, endPoint.y);
+    CGPathCloseSubpath(centerPath);
 
-    CABasicAnimation *fadeInAnim = [[CABasicAnimation alloc] init];
-    fadeInAnim.keyPath = kRippleLayerOpacityString;
-    fadeInAnim.fromValue = @0;
-    fadeInAnim.toValue = @1;
-    fadeInAnim.duration = kRippleFadeInDuration;
-    fadeInAnim.timingFunction =
-        [CAMediaTimingFunction functionWithName:kCAMediaTimingFunctionLinear];
+    if (!_touchDownAnimation) {
+      _touchDownPositionAnimation = [[CAKeyframeAnimation alloc] init];
+      _touchDownPositionAnimation.keyPath = kRippleLayerPositionString;
+      _touchDownPositionAnimation.keyTimes = @[ @0, @1 ];
+      _touchDownPositionAnimation.values = @[ @0, @1 ];
+      _touchDownPositionAnimation.timingFunction =
+          [CAMediaTimingFunction mdc_functionWithType:MDCAnimationTimingFunctionStandard];
+
+      _touchDownAnimation = [[CAAnimationGroup alloc] init];
+      _touchDownAnimation.animations = @[
+        SharedTouchDownScaleAnimation(), _touchDownPositionAnimation,
+        SharedTouchDownFadeInAnimation()
+      ];
+      _touchDownAnimation.duration = kRippleTouchDownDuration;
+      _animationAllocationCount += 2;
+    }
+    _touchDownPositionAnimation.path = centerPath;
+    CGPathRelease(centerPath);
 
+    NSUInteger reuseGeneration = _reuseGeneration;
     [CATransaction begin];
-    CAAnimationGroup *animGroup = [[CAAnimationGroup alloc] init];
-    animGroup.animations = @[ scaleAnim, positionAnim, fadeInAnim ];
-    animGroup.duration = kRippleTouchDownDuration;
     [CATransaction setCompletionBlock:^{
+      if (self->_reuseGeneration != reuseGeneration) {
+        if (completion) {
+          completion();
+        }
+        return;
+      }
       self->_startAnimationActive = NO;
       if (completion) {
         completion();
       }
       [self.rippleLayerDelegate rippleLayerTouchDownAnimationDidEnd:self];
     }];
-    [self addAnimation:animGroup forKey:nil];
+    [self addAnimation:_touchDownAnimation forKey:nil];
     _rippleTouchDownStartTime = CACurrentMediaTime();
     [CATransaction commit];
   }
@@ -111,14 +186,11 @@ static CGFloat GetDefaultRippleRadius(CGRect rect) {
 
 - (void)fadeInRippleAnimated:(BOOL)animated completion:(MDCRippleCompletionBlock)completion {
   [CATransaction begin];
-  CABasicAnimation *fadeInAnim = [[CABasicAnimation alloc] init];
-  fadeInAnim.keyPath = kRippleLayerOpacityString;
-  fadeInAnim.fromValue = @0;
-  fadeInAnim.toValue = @1;
+  if (!_fadeInAnimation) {
+    _fadeInAnimation = [self opacityAnimationFromValue:@0 toValue:@1];
+  }
+  CABasicAnimation *fadeInAnim = _fadeInAnimation;
   fadeInAnim.duration = animated ? kRippleFadeInDuration : 0;
-  fadeInAnim.timingFunction = [CAMediaTimingFunction functionWithName:kCAMediaTimingFunctionLinear];
-  fadeInAnim.fillMode = kCAFillModeForwards;
-  fadeInAnim.removedOnCompletion = NO;
   [CATransaction setCompletionBlock:^{
     if (completion) {
       completion();
@@ -130,14 +202,11 @@ static CGFloat GetDefaultRippleRadius(CGRect rect) {
 
 - (void)fadeOutRippleAnimated:(BOOL)animated completion:(MDCRippleCompletionBlock)completion {
   [CATransaction begin];
-  CABasicAnimation *fadeInAnim = [[CABasicAnimation alloc] init];
-  fadeInAnim.keyPath = kRippleLayerOpacityString;
-  fadeInAnim.fromValue = @1;
-  fadeInAnim.toValue = @0;
+  if (!_fadeOutAnimation) {
+    _fadeOutAnimation = [self opacityAnimationFromValue:@1 toValue:@0];
+  }
+  CABasicAnimation *fadeInAnim = _fadeOutAnimation;
   fadeInAnim.duration = animated ? kRippleFadeOutDuration : 0;
-  fadeInAnim.timingFunction = [CAMediaTimingFunction functionWithName:kCAMediaTimingFunctionLinear];
-  fadeInAnim.fillMode = kCAFillModeForwards;
-  fadeInAnim.removedOnCompletion = NO;
   [CATransaction setCompletionBlock:^{
     if (completion) {
       completion();
@@ -153,21 +222,24 @@ static CGFloat GetDefaultRippleRadius(CGRect rect) {
     delay = kRippleFadeOutDelay;
   }
   [self.rippleLayerDelegate rippleLayerTouchUpAnimationDidBegin:self];
+  _touchUpAnimationActive = YES;
   [CATransaction begin];
-  CABasicAnimation *fadeOutAnim = [[CABasicAnimation alloc] init];
-  fadeOutAnim.keyPath = kRippleLayerOpacityString;
-  fadeOutAnim.fromValue = @1;
-  fadeOutAnim.toValue = @0;
+  if (!_touchUpAnimation) {
+    _touchUpAnimation = [self opacityAnimationFromValue:@1 toValue:@0];
+  }
+  CABasicAnimation *fadeOutAnim = _touchUpAnimation;
   fadeOutAnim.duration = animated ? kRippleTouchUpDuration : 0;
   fadeOutAnim.beginTime = [self convertTime:_rippleTouchDownStartTime + delay fromLayer:nil];
-  fadeOutAnim.timingFunction =
-      [CAMediaTimingFunction functionWithName:kCAMediaTimingFunctionLinear];
-  fadeOutAnim.fillMode = kCAFillModeForwards;
-  fadeOutAnim.removedOnCompletion = NO;
+  NSUInteger reuseGeneration = _reuseGeneration;
   [CATransaction setCompletionBlock:^{
     if (completion) {
       completion();
     }
+    if (self->_reuseGeneration != reuseGeneration) {
+      // The layer was already reused for another ripple, which sent the end to the delegate.
+      return;
+    }
+    self->_touchUpAnimationActive = NO;
     [self.rippleLayerDelegate rippleLayerTouchUpAnimationDidEnd:self];
     [self removeFromSuperlayer];
   }];
@@ -175,4 +247,18 @@ static CGFloat GetDefaultRippleRadius(CGRect rect) {
   [CATransaction commit];
 }
 
+#pragma mark - Private
+
+- (CABasicAnimation *)opacityAnimationFromValue:(NSNumber *)fromValue toValue:(NSNumber *)toValue {
+  CABasicAnimation *animation = [[CABasicAnimation alloc] init];
+  animation.keyPath = kRippleLayerOpacityString;
+  animation.fromValue = fromValue;
+  animation.toValue = toValue;
+  animation.timingFunction = [CAMediaTimingFunction functionWithName:kCAMediaTimingFunctionLinear];
+  animation.fillMode = kCAFillModeForwards;
+  animation.removedOnCompletion = NO;
+  _animationAllocationCount += 1;
+  return animation;
+}
+
 @end
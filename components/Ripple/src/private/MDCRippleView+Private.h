@@ -0,0 +1,30 @@
+// Copyright 2019-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "MDCRippleView.h"
+
+@interface MDCRippleView ()
+
+/**
+ The number of MDCRippleLayers this view has created. Finished ripple layers are kept in a small
+ pool and reused, so this stays constant under repeated taps once the pool is warm.
+ */
+@property(nonatomic, assign, readonly) NSUInteger rippleLayerAllocationCount;
+
+/**
+ The number of ripples that reused a pooled MDCRippleLayer instead of creating a new one.
+ */
+@property(nonatomic, assign, readonly) NSUInteger rippleLayerReuseCount;
+
+@end
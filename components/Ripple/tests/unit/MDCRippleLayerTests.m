@@ -14,6 +14,7 @@
 
 #import <XCTest/XCTest.h>
 
+#import "MaterialOvalPathCache.h"
 #import "MDCRippleLayer.h"
 
 #pragma mark - Fake classes
@@ -281,4 +282,27 @@
   XCTAssertEqual(rippleLayer.maximumRadius, fakeRadius);
 }
 
+- (void)testRippleLayersOfTheSameSizeShareOnePath {
+  // Given
+  MDCRippleLayer *firstRippleLayer = [[MDCRippleLayer alloc] init];
+  MDCRippleLayer *secondRippleLayer = [[MDCRippleLayer alloc] init];
+  firstRippleLayer.maximumRadius = 37;
+  secondRippleLayer.maximumRadius = 37;
+  firstRippleLayer.bounds = CGRectMake(0, 0, 60, 60);
+  secondRippleLayer.bounds = CGRectMake(0, 0, 60, 60);
+  [firstRippleLayer setNeedsLayout];
+  MDCOvalPathCache *cache = [MDCOvalPathCache sharedCache];
+  NSUInteger hitCount = cache.hitCount;
+
+  // When
+  [secondRippleLayer setNeedsLayout];
+
+  // Then
+  XCTAssertEqual(cache.hitCount, hitCount + 1);
+  XCTAssertEqual(secondRippleLayer.path, firstRippleLayer.path);
+  XCTAssertTrue(CGRectEqualToRect(CGPathGetBoundingBox(secondRippleLayer.path),
+                                  CGRectMake(-7, -7, 74, 74)));
+  XCTAssertTrue(CGRectEqualToRect(secondRippleLayer.bounds, CGRectMake(0, 0, 60, 60)));
+}
+
 @end
@@ -15,6 +15,7 @@
 #import <XCTest/XCTest.h>
 
 #import "MDCRippleLayer.h"
+#import "MDCRippleView+Private.h"
 #import "MaterialRipple.h"
 
 @interface FakeMDCRippleViewAnimationDelegate : NSObject <MDCRippleViewDelegate>
@@ -23,24 +24,32 @@
 @property(nonatomic, assign) BOOL rippleTouchDownDidEnd;
 @property(nonatomic, assign) BOOL rippleTouchUpDidBegin;
 @property(nonatomic, assign) BOOL rippleTouchUpDidEnd;
+@property(nonatomic, assign) NSUInteger rippleTouchDownDidBeginCount;
+@property(nonatomic, assign) NSUInteger rippleTouchDownDidEndCount;
+@property(nonatomic, assign) NSUInteger rippleTouchUpDidBeginCount;
+@property(nonatomic, assign) NSUInteger rippleTouchUpDidEndCount;
 
 @end
 
 @implementation FakeMDCRippleViewAnimationDelegate
 - (void)rippleTouchDownAnimationDidBegin:(nonnull MDCRippleView *)rippleView {
   _rippleTouchDownDidBegin = YES;
+  _rippleTouchDownDidBeginCount += 1;
 }
 
 - (void)rippleTouchDownAnimationDidEnd:(nonnull MDCRippleView *)rippleView {
   _rippleTouchDownDidEnd = YES;
+  _rippleTouchDownDidEndCount += 1;
 }
 
 - (void)rippleTouchUpAnimationDidBegin:(nonnull MDCRippleView *)rippleView {
   _rippleTouchUpDidBegin = YES;
+  _rippleTouchUpDidBeginCount += 1;
 }
 
 - (void)rippleTouchUpAnimationDidEnd:(nonnull MDCRippleView *)rippleView {
   _rippleTouchUpDidEnd = YES;
+  _rippleTouchUpDidEndCount += 1;
 }
 
 @end
@@ -249,4 +258,84 @@
   XCTAssertEqual(rippleView.activeRippleLayer.maximumRadius, fakeRippleRadius);
 }
 
+- (void)testCancelledRippleLayerIsReusedForNextRipple {
+  // Given
+  MDCRippleView *rippleView = [[MDCRippleView alloc] initWithFrame:CGRectMake(0, 0, 100, 100)];
+  [rippleView beginRippleTouchDownAtPoint:CGPointMake(10, 10) animated:NO completion:nil];
+  CALayer *firstRippleLayer = rippleView.layer.sublayers.firstObject;
+
+  // When
+  [rippleView cancelAllRipplesAnimated:NO completion:nil];
+  [rippleView beginRippleTouchDownAtPoint:CGPointMake(20, 20) animated:NO completion:nil];
+
+  // Then
+  XCTAssertEqual(rippleView.layer.sublayers.firstObject, firstRippleLayer);
+  XCTAssertEqual(rippleView.rippleLayerAllocationCount, 1U);
+  XCTAssertEqual(rippleView.rippleLayerReuseCount, 1U);
+}
+
+- (void)testRepeatedTapsDoNotAllocateNewRippleLayers {
+  // Given
+  MDCRippleView *rippleView = [[MDCRippleView alloc] initWithFrame:CGRectMake(0, 0, 100, 100)];
+
+  // When
+  for (NSInteger i = 0; i < 20; ++i) {
+    [rippleView beginRippleTouchDownAtPoint:CGPointMake(i, i) animated:YES completion:nil];
+    [rippleView cancelAllRipplesAnimated:NO completion:nil];
+  }
+
+  // Then
+  XCTAssertEqual(rippleView.rippleLayerAllocationCount, 1U);
+  XCTAssertEqual(rippleView.rippleLayerReuseCount, 19U);
+}
+
+- (void)testReusedRippleLayerDoesNotAllocateAnimations {
+  // Given
+  MDCRippleView *rippleView = [[MDCRippleView alloc] initWithFrame:CGRectMake(0, 0, 100, 100)];
+  [rippleView beginRippleTouchDownAtPoint:CGPointMake(10, 10) animated:YES completion:nil];
+  [rippleView beginRippleTouchUpAnimated:YES completion:nil];
+  MDCRippleLayer *rippleLayer = (MDCRippleLayer *)rippleView.layer.sublayers.firstObject;
+  NSUInteger animationAllocationCount = rippleLayer.animationAllocationCount;
+  [rippleView cancelAllRipplesAnimated:NO completion:nil];
+
+  // When
+  [rippleView beginRippleTouchDownAtPoint:CGPointMake(20, 20) animated:YES completion:nil];
+  [rippleView beginRippleTouchUpAnimated:YES completion:nil];
+
+  // Then
+  XCTAssertEqual(rippleView.layer.sublayers.firstObject, rippleLayer);
+  XCTAssertEqual(rippleLayer.animationAllocationCount, animationAllocationCount);
+}
+
+- (void)testReusedRippleLayerEndsEveryAnimationItBegan {
+  // Given
+  FakeMDCRippleViewAnimationDelegate *delegate = [[FakeMDCRippleViewAnimationDelegate alloc] init];
+  MDCRippleView *rippleView = [[MDCRippleView alloc] initWithFrame:CGRectMake(0, 0, 100, 100)];
+  rippleView.rippleViewDelegate = delegate;
+  [rippleView beginRippleTouchDownAtPoint:CGPointMake(10, 10) animated:YES completion:nil];
+  [rippleView beginRippleTouchUpAnimated:YES completion:nil];
+  [rippleView cancelAllRipplesAnimated:NO completion:nil];
+  XCTestExpectation *touchDownExpectation = [self expectationWithDescription:@"touch down"];
+  XCTestExpectation *touchUpExpectation = [self expectationWithDescription:@"touch up"];
+
+  // When
+  [rippleView beginRippleTouchDownAtPoint:CGPointMake(20, 20)
+                                 animated:YES
+                               completion:^{
+                                 [touchDownExpectation fulfill];
+                               }];
+  [rippleView beginRippleTouchUpAnimated:YES
+                              completion:^{
+                                [touchUpExpectation fulfill];
+                              }];
+  [self waitForExpectationsWithTimeout:3 handler:nil];
+
+  // Then
+  XCTAssertEqual(rippleView.rippleLayerReuseCount, 1U);
+  XCTAssertEqual(delegate.rippleTouchDownDidBeginCount, 2U);
+  XCTAssertEqual(delegate.rippleTouchDownDidEndCount, 2U);
+  XCTAssertEqual(delegate.rippleTouchUpDidBeginCount, 2U);
+  XCTAssertEqual(delegate.rippleTouchUpDidEndCount, 2U);
+}
+
 @end
@@ -15,6 +15,29 @@
 #import <UIKit/UIKit.h>
 #import "MaterialShadowElevations.h"
 
+/**
+ The values of MDCShadowMetrics as a plain struct.
+
+ Use MDCShadowMetricsValuesForElevation when the metrics are needed frequently, e.g. once per
+ frame while animating elevation, because it does not allocate.
+ */
+typedef struct {
+  CGFloat topShadowRadius;
+  CGSize topShadowOffset;
+  float topShadowOpacity;
+  CGFloat bottomShadowRadius;
+  CGSize bottomShadowOffset;
+  float bottomShadowOpacity;
+} MDCShadowMetricsValues;
+
+/**
+ Returns the shadow metrics for an elevation without allocating.
+
+ @param elevation The shadow's elevation in points. Elevations of zero or less have no shadow.
+ @return The same values as the properties of @c +[MDCShadowMetrics metricsWithElevation:].
+ */
+FOUNDATION_EXTERN MDCShadowMetricsValues MDCShadowMetricsValuesForElevation(CGFloat elevation);
+
 /**
  Metrics of the Material shadow effect.
 
@@ -32,6 +55,9 @@
 /**
  The shadow metrics for manually creating shadows given an elevation.
 
+ Metrics for the elevations defined in MDCShadowElevations are created once and shared, so calling
+ this method with one of those elevations does not allocate.
+
  @param elevation The shadow's elevation in points.
  @return The shadow metrics.
  */
@@ -76,6 +102,20 @@
  */
 @property(nonatomic, getter=isShadowMaskEnabled, assign) BOOL shadowMaskEnabled;
 
+/**
+ Whether to draw the key and ambient shadows from a single shared, resizable image.
+
+ When enabled and the layer has no custom shadowPath, the shadows of the layer's (rounded)
+ rectangle are composited from one nine-slice image per elevation, corner radius, shadow color,
+ shadow mask setting and screen scale, shared by all layers with those values. This avoids the two
+ offscreen shadow passes and the masks of the default rendering. Layers with a custom shadowPath,
+ e.g. shaped layers, or with a shadowColor that is nil or not expressible in RGB keep using the
+ default rendering.
+
+ Default is NO. Not animatable.
+ */
+@property(nonatomic, getter=isShadowImageEnabled, assign) BOOL shadowImageEnabled;
+
 /**
  Animates the layer's corner radius
 
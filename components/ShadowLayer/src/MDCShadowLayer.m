@@ -14,6 +14,8 @@
 
 #import "MDCShadowLayer.h"
 
+#import "private/MDCShadowImageCache.h"
+
 static const CGFloat kShadowElevationDialog = 24.0;
 static const float kKeyShadowOpacity = (float)0.26;
 static const float kAmbientShadowOpacity = (float)0.08;
@@ -25,25 +27,80 @@ static const float kAmbientShadowOpacity = (float)0.08;
 @property(nonatomic, strong) id toValue;
 @end
 
+static inline CGFloat MDCShadowMetricsAmbientShadowBlur(CGFloat points) {
+  return (CGFloat)0.889544 * points - (CGFloat)0.003701;
+}
+
+static inline CGFloat MDCShadowMetricsKeyShadowBlur(CGFloat points) {
+  return (CGFloat)0.666920 * points - (CGFloat)0.001648;
+}
+
+static inline CGFloat MDCShadowMetricsKeyShadowYOff(CGFloat points) {
+  return (CGFloat)1.23118 * points - (CGFloat)0.03933;
+}
+
+MDCShadowMetricsValues MDCShadowMetricsValuesForElevation(CGFloat elevation) {
+  MDCShadowMetricsValues values = {0};
+  if (0.0 < elevation) {
+    values.topShadowRadius = MDCShadowMetricsAmbientShadowBlur(elevation);
+    values.topShadowOffset = CGSizeMake(0.0, 0.0);
+    values.topShadowOpacity = kAmbientShadowOpacity;
+    values.bottomShadowRadius = MDCShadowMetricsKeyShadowBlur(elevation);
+    values.bottomShadowOffset = CGSizeMake(0.0, MDCShadowMetricsKeyShadowYOff(elevation));
+    values.bottomShadowOpacity = kKeyShadowOpacity;
+  }
+  return values;
+}
+
+// The distinct elevations defined in MDCShadowElevations, for which metrics are interned.
+static const CGFloat kInternedElevations[] = {1, 2, 3, 4, 6, 8, 9, 12, 16, 24};
+static const NSUInteger kInternedElevationCount =
+    sizeof(kInternedElevations) / sizeof(kInternedElevations[0]);
+
 @implementation MDCShadowMetrics
 
 + (MDCShadowMetrics *)metricsWithElevation:(CGFloat)elevation {
   if (0.0 < elevation) {
+    MDCShadowMetrics *internedMetrics = [self internedMetricsWithElevation:elevation];
+    if (internedMetrics) {
+      return internedMetrics;
+    }
     return [[MDCShadowMetrics alloc] initWithElevation:elevation];
   } else {
     return [MDCShadowMetrics emptyShadowMetrics];
   }
 }
 
++ (MDCShadowMetrics *)internedMetricsWithElevation:(CGFloat)elevation {
+  static NSArray<MDCShadowMetrics *> *internedMetrics;
+  static dispatch_once_t once;
+  dispatch_once(&once, ^{
+    NSMutableArray<MDCShadowMetrics *> *metrics =
+        [NSMutableArray arrayWithCapacity:kInternedElevationCount];
+    for (NSUInteger i = 0; i < kInternedElevationCount; ++i) {
+      [metrics addObject:[[MDCShadowMetrics alloc] initWithElevation:kInternedElevations[i]]];
+    }
+    internedMetrics = [metrics copy];
+  });
+
+  for (NSUInteger i = 0; i < kInternedElevationCount; ++i) {
+    if (kInternedElevations[i] == elevation) {
+      return internedMetrics[i];
+    }
+  }
+  return nil;
+}
+
 - (MDCShadowMetrics *)initWithElevation:(CGFloat)elevation {
   self = [super init];
   if (self) {
-    _topShadowRadius = [MDCShadowMetrics ambientShadowBlur:elevation];
-    _topShadowOffset = CGSizeMake(0.0, 0.0);
-    _topShadowOpacity = kAmbientShadowOpacity;
-    _bottomShadowRadius = [MDCShadowMetrics keyShadowBlur:elevation];
-    _bottomShadowOffset = CGSizeMake(0.0, [MDCShadowMetrics keyShadowYOff:elevation]);
-    _bottomShadowOpacity = kKeyShadowOpacity;
+    MDCShadowMetricsValues values = MDCShadowMetricsValuesForElevation(elevation);
+    _topShadowRadius = values.topShadowRadius;
+    _topShadowOffset = values.topShadowOffset;
+    _topShadowOpacity = values.topShadowOpacity;
+    _bottomShadowRadius = values.bottomShadowRadius;
+    _bottomShadowOffset = values.bottomShadowOffset;
+    _bottomShadowOpacity = values.bottomShadowOpacity;
   }
   return self;
 }
@@ -64,21 +121,6 @@ static const float kAmbientShadowOpacity = (float)0.08;
   return emptyShadowMetrics;
 }
 
-+ (CGFloat)ambientShadowBlur:(CGFloat)points {
-  CGFloat blur = (CGFloat)0.889544 * points - (CGFloat)0.003701;
-  return blur;
-}
-
-+ (CGFloat)keyShadowBlur:(CGFloat)points {
-  CGFloat blur = (CGFloat)0.666920 * points - (CGFloat)0.001648;
-  return blur;
-}
-
-+ (CGFloat)keyShadowYOff:(CGFloat)points {
-  CGFloat yOff = (CGFloat)1.23118 * points - (CGFloat)0.03933;
-  return yOff;
-}
-
 @end
 
 @interface MDCShadowLayer ()
@@ -87,11 +129,19 @@ static const float kAmbientShadowOpacity = (float)0.08;
 @property(nonatomic, strong) CAShapeLayer *bottomShadow;
 @property(nonatomic, strong) CAShapeLayer *topShadowMask;
 @property(nonatomic, strong) CAShapeLayer *bottomShadowMask;
+@property(nonatomic, strong) CALayer *shadowImageLayer;
 
 @end
 
 @implementation MDCShadowLayer {
   BOOL _shadowPathIsInvalid;
+  // The bounds the shadow masks were last configured for.
+  CGRect _shadowMaskBounds;
+  // The parameters of the image currently displayed by shadowImageLayer.
+  CGFloat _shadowImageElevation;
+  CGFloat _shadowImageCornerRadius;
+  UIColor *_shadowImageColor;
+  BOOL _shadowImageMasked;
 }
 
 - (instancetype)init {
@@ -120,6 +170,7 @@ static const float kAmbientShadowOpacity = (float)0.08;
       MDCShadowLayer *otherLayer = (MDCShadowLayer *)layer;
       _elevation = otherLayer.elevation;
       _shadowMaskEnabled = otherLayer.isShadowMaskEnabled;
+      _shadowImageEnabled = otherLayer.isShadowImageEnabled;
       _bottomShadow = [[CAShapeLayer alloc] initWithLayer:otherLayer.bottomShadow];
       _topShadow = [[CAShapeLayer alloc] initWithLayer:otherLayer.topShadow];
       _topShadowMask = [[CAShapeLayer alloc] initWithLayer:otherLayer.topShadowMask];
@@ -152,7 +203,7 @@ static const float kAmbientShadowOpacity = (float)0.08;
   }
 
   // Setup shadow layer state based off _elevation and _shadowMaskEnabled
-  MDCShadowMetrics *shadowMetrics = [MDCShadowMetrics metricsWithElevation:_elevation];
+  MDCShadowMetricsValues shadowMetrics = MDCShadowMetricsValuesForElevation(_elevation);
   _topShadow.shadowOffset = shadowMetrics.topShadowOffset;
   _topShadow.shadowRadius = shadowMetrics.topShadowRadius;
   _topShadow.shadowOpacity = shadowMetrics.topShadowOpacity;
@@ -171,8 +222,7 @@ static const float kAmbientShadowOpacity = (float)0.08;
 
   // TODO(#1021): We shouldn't be calling property accessors in an init method.
   if (_shadowMaskEnabled) {
-    [self configureShadowLayerMaskForLayer:_topShadowMask];
-    [self configureShadowLayerMaskForLayer:_bottomShadowMask];
+    [self configureShadowMasks];
     _topShadow.mask = _topShadowMask;
     _bottomShadow.mask = _bottomShadowMask;
   }
@@ -208,9 +258,9 @@ static const float kAmbientShadowOpacity = (float)0.08;
 
   _topShadow.cornerRadius = cornerRadius;
   _bottomShadow.cornerRadius = cornerRadius;
+  [self setNeedsShadowImageUpdate];
   if (_shadowMaskEnabled) {
-    [self configureShadowLayerMaskForLayer:_topShadowMask];
-    [self configureShadowLayerMaskForLayer:_bottomShadowMask];
+    [self configureShadowMasks];
     _topShadow.mask = _topShadowMask;
     _bottomShadow.mask = _bottomShadowMask;
   }
@@ -218,11 +268,11 @@ static const float kAmbientShadowOpacity = (float)0.08;
 
 - (void)setShadowPath:(CGPathRef)shadowPath {
   super.shadowPath = shadowPath;
+  [self setNeedsShadowImageUpdate];
   _topShadow.shadowPath = shadowPath;
   _bottomShadow.shadowPath = shadowPath;
   if (_shadowMaskEnabled) {
-    [self configureShadowLayerMaskForLayer:_topShadowMask];
-    [self configureShadowLayerMaskForLayer:_bottomShadowMask];
+    [self configureShadowMasks];
   }
 }
 
@@ -230,6 +280,7 @@ static const float kAmbientShadowOpacity = (float)0.08;
   super.shadowColor = shadowColor;
   _topShadow.shadowColor = shadowColor;
   _bottomShadow.shadowColor = shadowColor;
+  [self setNeedsShadowImageUpdate];
 }
 
 #pragma mark - shouldRasterize forwarding
@@ -244,7 +295,7 @@ static const float kAmbientShadowOpacity = (float)0.08;
 
 // Returns how far aware the shadow is spread from the edge of the layer.
 + (CGSize)shadowSpreadForElevation:(CGFloat)elevation {
-  MDCShadowMetrics *metrics = [MDCShadowMetrics metricsWithElevation:elevation];
+  MDCShadowMetricsValues metrics = MDCShadowMetricsValuesForElevation(elevation);
 
   CGSize shadowSpread = CGSizeZero;
   shadowSpread.width = MAX(metrics.topShadowRadius, metrics.bottomShadowRadius) +
@@ -259,9 +310,9 @@ static const float kAmbientShadowOpacity = (float)0.08;
 
 - (void)setShadowMaskEnabled:(BOOL)shadowMaskEnabled {
   _shadowMaskEnabled = shadowMaskEnabled;
+  [self setNeedsShadowImageUpdate];
   if (_shadowMaskEnabled) {
-    [self configureShadowLayerMaskForLayer:_topShadowMask];
-    [self configureShadowLayerMaskForLayer:_bottomShadowMask];
+    [self configureShadowMasks];
     _topShadow.mask = _topShadowMask;
     _bottomShadow.mask = _bottomShadowMask;
   } else {
@@ -270,6 +321,12 @@ static const float kAmbientShadowOpacity = (float)0.08;
   }
 }
 
+- (void)configureShadowMasks {
+  [self configureShadowLayerMaskForLayer:_topShadowMask];
+  [self configureShadowLayerMaskForLayer:_bottomShadowMask];
+  _shadowMaskBounds = self.bounds;
+}
+
 // Creates a layer mask that has a hole cut inside so that the original contents
 // of the view is no obscured by the shadow the top/bottom pseudo shadow layers
 // cast.
@@ -306,7 +363,7 @@ static const float kAmbientShadowOpacity = (float)0.08;
 - (void)setElevation:(CGFloat)elevation {
   _elevation = elevation;
 
-  MDCShadowMetrics *shadowMetrics = [MDCShadowMetrics metricsWithElevation:elevation];
+  MDCShadowMetricsValues shadowMetrics = MDCShadowMetricsValuesForElevation(elevation);
 
   _topShadow.shadowOffset = shadowMetrics.topShadowOffset;
   _topShadow.shadowRadius = shadowMetrics.topShadowRadius;
@@ -314,11 +371,99 @@ static const float kAmbientShadowOpacity = (float)0.08;
   _bottomShadow.shadowOffset = shadowMetrics.bottomShadowOffset;
   _bottomShadow.shadowRadius = shadowMetrics.bottomShadowRadius;
   _bottomShadow.shadowOpacity = shadowMetrics.bottomShadowOpacity;
+  [self setNeedsShadowImageUpdate];
+}
+
+#pragma mark - Shadow Image
+
+- (void)setShadowImageEnabled:(BOOL)shadowImageEnabled {
+  _shadowImageEnabled = shadowImageEnabled;
+  [self setNeedsShadowImageUpdate];
+}
+
+- (void)setNeedsShadowImageUpdate {
+  if (_shadowImageEnabled || _shadowImageLayer) {
+    [self setNeedsLayout];
+  }
+}
+
+/**
+ Shows either the shared shadow image or the two shadow layers, depending on shadowImageEnabled and
+ whether the layer's shape and shadow color can be represented by the image.
+ */
+- (void)layoutShadowImage {
+  CGFloat elevation = MAX(_elevation, 0);
+  BOOL usesShadowImage = _shadowImageEnabled && self.shadowPath == nil;
+  if (usesShadowImage && !_shadowImageLayer) {
+    _shadowImageLayer = [CALayer layer];
+    _shadowImageLayer.delegate = self;
+    [self insertSublayer:_shadowImageLayer atIndex:0];
+  }
+  if (usesShadowImage && elevation > 0) {
+    usesShadowImage = [self updateShadowImageWithElevation:elevation];
+  }
+  _topShadow.hidden = usesShadowImage;
+  _bottomShadow.hidden = usesShadowImage;
+  if (!usesShadowImage) {
+    _shadowImageLayer.hidden = YES;
+    return;
+  }
+
+  _shadowImageLayer.hidden = elevation <= 0;
+  if (elevation <= 0) {
+    return;
+  }
+
+  CGFloat outset = [MDCShadowImageCache shadowOutsetForElevation:elevation];
+  _shadowImageLayer.frame = CGRectInset(self.bounds, -outset, -outset);
+}
+
+/**
+ Displays the shadow image for the layer's current parameters in shadowImageLayer.
+
+ @return NO if the shadow image cannot represent the layer's shadow color.
+ */
+- (BOOL)updateShadowImageWithElevation:(CGFloat)elevation {
+  CGFloat cornerRadius = MAX(self.cornerRadius, 0);
+  CGColorRef shadowColor = self.shadowColor;
+  if (_shadowImageLayer.contents && _shadowImageElevation == elevation &&
+      _shadowImageCornerRadius == cornerRadius && _shadowImageMasked == _shadowMaskEnabled &&
+      shadowColor && CGColorEqualToColor(_shadowImageColor.CGColor, shadowColor)) {
+    return YES;
+  }
+
+  CGFloat scale = [UIScreen mainScreen].scale;
+  UIImage *image = [[MDCShadowImageCache sharedCache] shadowImageWithElevation:elevation
+                                                                  cornerRadius:cornerRadius
+                                                                   shadowColor:shadowColor
+                                                                        masked:_shadowMaskEnabled
+                                                                         scale:scale];
+  if (!image) {
+    return NO;
+  }
+
+  CGSize imageSize = image.size;
+  UIEdgeInsets capInsets = image.capInsets;
+  _shadowImageLayer.contents = (__bridge id)image.CGImage;
+  _shadowImageLayer.contentsScale = image.scale;
+  _shadowImageLayer.contentsCenter =
+      CGRectMake(capInsets.left / imageSize.width, capInsets.top / imageSize.height,
+                 1 / imageSize.width, 1 / imageSize.height);
+  _shadowImageElevation = elevation;
+  _shadowImageCornerRadius = cornerRadius;
+  _shadowImageColor = [UIColor colorWithCGColor:shadowColor];
+  _shadowImageMasked = _shadowMaskEnabled;
+  return YES;
 }
 
 #pragma mark - CALayerDelegate
 
 - (id<CAAction>)actionForLayer:(CALayer *)layer forKey:(NSString *)event {
+  if (layer == _shadowImageLayer &&
+      ([event isEqualToString:@"contents"] || [event isEqualToString:@"contentsCenter"])) {
+    // Swapping the shared shadow image should not cross-fade.
+    return (id<CAAction>)[NSNull null];
+  }
   if ([event isEqualToString:@"path"] || [event isEqualToString:@"shadowPath"]) {
     // We have to create a pending animation because if we are inside a UIKit animation block we
     // won't know any properties of the animation block until it is commited.
@@ -343,9 +488,14 @@ static const float kAmbientShadowOpacity = (float)0.08;
   _topShadow.position = CGPointMake(CGRectGetMidX(bounds), CGRectGetMidY(bounds));
   _topShadow.bounds = bounds;
 
-  if (_shadowMaskEnabled) {
-    [self configureShadowLayerMaskForLayer:_topShadowMask];
-    [self configureShadowLayerMaskForLayer:_bottomShadowMask];
+  if (_shadowImageEnabled || _shadowImageLayer) {
+    [self layoutShadowImage];
+  }
+
+  // The masks only depend on the bounds, the shadowPath and the cornerRadius. The latter two
+  // reconfigure the masks when they are set, so only the bounds need to be checked here.
+  if (_shadowMaskEnabled && !CGRectEqualToRect(_shadowMaskBounds, bounds)) {
+    [self configureShadowMasks];
   }
   // Enforce shadowPaths because otherwise no shadows can be drawn. If a shadowPath
   // is already set, use that, otherwise fallback to just a regular rect because path.
@@ -0,0 +1,56 @@
+// Copyright 2019-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <UIKit/UIKit.h>
+
+/**
+ A shared cache of resizable images containing both the key and ambient Material shadows of a
+ rounded rectangle.
+
+ Each image is a nine-slice image: its capInsets cover the shadow outset plus the corner radius,
+ and the single point in the middle stretches to any size. Masked images leave the interior of the
+ rounded rectangle transparent, matching the "cutout" shadow mask of MDCShadowLayer.
+
+ Only use MDCShadowImageCache from the main thread.
+ */
+@interface MDCShadowImageCache : NSObject
+
++ (nonnull instancetype)sharedCache;
+
+/**
+ Returns the shadow image for the given parameters, rendering it on first use.
+
+ @param elevation The elevation in points. Must be greater than zero.
+ @param cornerRadius The corner radius of the rounded rectangle casting the shadow.
+ @param shadowColor The color of both shadows, as in CALayer's shadowColor.
+ @param masked Whether the shadow is cut out of the interior of the rounded rectangle.
+ @param scale The scale of the rendered image.
+ @return The shadow image, or nil if @c shadowColor is NULL or not expressible in RGB.
+ */
+- (nullable UIImage *)shadowImageWithElevation:(CGFloat)elevation
+                                  cornerRadius:(CGFloat)cornerRadius
+                                   shadowColor:(nullable CGColorRef)shadowColor
+                                        masked:(BOOL)masked
+                                         scale:(CGFloat)scale;
+
+/**
+ The distance by which the shadow in a shadow image extends past the rounded rectangle on each
+ side.
+ */
++ (CGFloat)shadowOutsetForElevation:(CGFloat)elevation;
+
+/** The number of images rendered so far. Intended for tests. */
+@property(nonatomic, readonly) NSUInteger renderCount;
+
+@end
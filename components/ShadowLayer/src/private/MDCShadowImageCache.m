@@ -0,0 +1,203 @@
+// Copyright 2019-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "MDCShadowImageCache.h"
+
+#import "MDCShadowLayer.h"
+
+static const NSUInteger kShadowImageCountLimit = 64;
+
+/**
+ The parameters of a shadow image. Lengths and the scale are in hundredths, color components in
+ 256ths.
+ */
+typedef struct {
+  int32_t elevation;
+  int32_t cornerRadius;
+  int32_t scale;
+  uint8_t red;
+  uint8_t green;
+  uint8_t blue;
+  uint8_t alpha;
+  BOOL masked;
+} MDCShadowImageKeyValue;
+
+/** Identifies a cached shadow image. */
+@interface MDCShadowImageKey : NSObject {
+ @public
+  MDCShadowImageKeyValue _value;
+}
+@end
+
+@implementation MDCShadowImageKey
+
+- (NSUInteger)hash {
+  NSUInteger hash = (NSUInteger)_value.elevation;
+  hash = hash * 31 + (NSUInteger)_value.cornerRadius;
+  hash = hash * 31 + (NSUInteger)_value.scale;
+  hash = hash * 31 + (((NSUInteger)_value.red << 24) | ((NSUInteger)_value.green << 16) |
+                      ((NSUInteger)_value.blue << 8) | _value.alpha);
+  return hash * 31 + (_value.masked ? 1 : 0);
+}
+
+- (BOOL)isEqual:(id)object {
+  if (self == object) {
+    return YES;
+  }
+  if (![object isKindOfClass:[MDCShadowImageKey class]]) {
+    return NO;
+  }
+  MDCShadowImageKeyValue other = ((MDCShadowImageKey *)object)->_value;
+  return _value.elevation == other.elevation && _value.cornerRadius == other.cornerRadius &&
+         _value.scale == other.scale && _value.red == other.red && _value.green == other.green &&
+         _value.blue == other.blue && _value.alpha == other.alpha &&
+         _value.masked == other.masked;
+}
+
+@end
+
+static uint8_t MDCShadowImageColorComponent(CGFloat component) {
+  return (uint8_t)lround(MIN(MAX(component, 0), 1) * 255);
+}
+
+@implementation MDCShadowImageCache {
+  NSCache<MDCShadowImageKey *, UIImage *> *_images;
+}
+
++ (instancetype)sharedCache {
+  static MDCShadowImageCache *sharedCache;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    sharedCache = [[MDCShadowImageCache alloc] init];
+  });
+  return sharedCache;
+}
+
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    _images = [[NSCache alloc] init];
+    _images.countLimit = kShadowImageCountLimit;
+  }
+  return self;
+}
+
++ (CGFloat)shadowOutsetForElevation:(CGFloat)elevation {
+  MDCShadowMetricsValues metrics = MDCShadowMetricsValuesForElevation(elevation);
+  // A Core Animation shadow with a given shadowRadius visibly extends about twice that far.
+  CGFloat blurExtent = 2 * MAX(metrics.topShadowRadius, metrics.bottomShadowRadius);
+  CGFloat offset = MAX(ABS(metrics.topShadowOffset.height), ABS(metrics.bottomShadowOffset.height));
+  return ceil(blurExtent + offset);
+}
+
+- (UIImage *)shadowImageWithElevation:(CGFloat)elevation
+                         cornerRadius:(CGFloat)cornerRadius
+                          shadowColor:(CGColorRef)shadowColor
+                               masked:(BOOL)masked
+                                scale:(CGFloat)scale {
+  CGFloat red, green, blue, alpha;
+  if (!shadowColor ||
+      ![[UIColor colorWithCGColor:shadowColor] getRed:&red green:&green blue:&blue alpha:&alpha]) {
+    return nil;
+  }
+
+  MDCShadowImageKey *key = [[MDCShadowImageKey alloc] init];
+  key->_value.elevation = (int32_t)lround(elevation * 100);
+  key->_value.cornerRadius = (int32_t)lround(cornerRadius * 100);
+  key->_value.scale = (int32_t)lround(scale * 100);
+  key->_value.red = MDCShadowImageColorComponent(red);
+  key->_value.green = MDCShadowImageColorComponent(green);
+  key->_value.blue = MDCShadowImageColorComponent(blue);
+  key->_value.alpha = MDCShadowImageColorComponent(alpha);
+  key->_value.masked = masked;
+
+  UIImage *image = [_images objectForKey:key];
+  if (!image) {
+    // Render the color the key stands for, so every lookup of this key gets the same image.
+    UIColor *keyColor = [UIColor colorWithRed:key->_value.red / (CGFloat)255
+                                        green:key->_value.green / (CGFloat)255
+                                         blue:key->_value.blue / (CGFloat)255
+                                        alpha:key->_value.alpha / (CGFloat)255];
+    image = [self renderShadowImageWithElevation:elevation
+                                    cornerRadius:cornerRadius
+                                     shadowColor:keyColor
+                                          masked:masked
+                                           scale:scale];
+    [_images setObject:image forKey:key];
+  }
+  return image;
+}
+
+- (UIImage *)renderShadowImageWithElevation:(CGFloat)elevation
+                               cornerRadius:(CGFloat)cornerRadius
+                                shadowColor:(UIColor *)shadowColor
+                                     masked:(BOOL)masked
+                                      scale:(CGFloat)scale {
+  _renderCount += 1;
+
+  MDCShadowMetricsValues metrics = MDCShadowMetricsValuesForElevation(elevation);
+  CGFloat outset = [[self class] shadowOutsetForElevation:elevation];
+  // Without the mask the shadow fills the shape, so the stretched middle point must lie deep
+  // enough inside the shape for the blurred shadow to be uniform there.
+  CGFloat capInset = outset + (masked ? cornerRadius : MAX(cornerRadius, outset));
+  CGSize imageSize = CGSizeMake(2 * capInset + 1, 2 * capInset + 1);
+  CGRect shapeRect = CGRectInset((CGRect){CGPointZero, imageSize}, outset, outset);
+
+  // The shape itself is never visible, only its shadows are. Fill it one image width to the left,
+  // outside of the image, and shift the shadows back by the same amount.
+  CGFloat shapeShift = imageSize.width;
+  UIBezierPath *shape =
+      [UIBezierPath bezierPathWithRoundedRect:CGRectOffset(shapeRect, -shapeShift, 0)
+                                 cornerRadius:cornerRadius];
+
+  UIGraphicsBeginImageContextWithOptions(imageSize, NO, scale);
+  CGContextRef context = UIGraphicsGetCurrentContext();
+  [[UIColor blackColor] setFill];
+
+  // Shadow offsets and blurs are specified in base space, so they are not scaled by the CTM.
+  // Core Animation's shadowRadius corresponds to half of Core Graphics' blur, and the layer's
+  // shadowOpacity multiplies the alpha of its shadowColor.
+  CGFloat shadowAlpha = CGColorGetAlpha(shadowColor.CGColor);
+  CGColorRef ambientColor =
+      [shadowColor colorWithAlphaComponent:shadowAlpha * metrics.topShadowOpacity].CGColor;
+  CGContextSetShadowWithColor(context,
+                              CGSizeMake((metrics.topShadowOffset.width + shapeShift) * scale,
+                                         metrics.topShadowOffset.height * scale),
+                              2 * metrics.topShadowRadius * scale, ambientColor);
+  [shape fill];
+
+  CGColorRef keyColor =
+      [shadowColor colorWithAlphaComponent:shadowAlpha * metrics.bottomShadowOpacity].CGColor;
+  CGContextSetShadowWithColor(context,
+                              CGSizeMake((metrics.bottomShadowOffset.width + shapeShift) * scale,
+                                         metrics.bottomShadowOffset.height * scale),
+                              2 * metrics.bottomShadowRadius * scale, keyColor);
+  [shape fill];
+
+  if (masked) {
+    // Cut the shape out so the shadow never shows through translucent content.
+    CGContextSetShadowWithColor(context, CGSizeZero, 0, NULL);
+    [[UIBezierPath bezierPathWithRoundedRect:shapeRect cornerRadius:cornerRadius]
+        fillWithBlendMode:kCGBlendModeClear
+                    alpha:1];
+  }
+
+  UIImage *image = UIGraphicsGetImageFromCurrentImageContext();
+  UIGraphicsEndImageContext();
+
+  return [image resizableImageWithCapInsets:UIEdgeInsetsMake(capInset, capInset, capInset, capInset)
+                               resizingMode:UIImageResizingModeStretch];
+}
+
+@end
@@ -0,0 +1,260 @@
+// Copyright 2019-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "MDCShadowImageCache.h"
+#import "MaterialShadowLayer.h"
+
+@interface MDCShadowLayer (ShadowImageTests)
+@property(nonatomic, strong) CAShapeLayer *topShadow;
+@property(nonatomic, strong) CAShapeLayer *bottomShadow;
+@property(nonatomic, strong) CALayer *shadowImageLayer;
+@end
+
+@interface MDCShadowLayerShadowImageTests : XCTestCase
+@end
+
+/**
+ Reads the premultiplied RGBA bytes of the pixel in the middle of @c image.
+ */
+static void GetCenterPixel(UIImage *image, uint8_t rgba[4]) {
+  CGImageRef cgImage = image.CGImage;
+  CGFloat width = CGImageGetWidth(cgImage);
+  CGFloat height = CGImageGetHeight(cgImage);
+  CGColorSpaceRef colorSpace = CGColorSpaceCreateDeviceRGB();
+  CGContextRef context =
+      CGBitmapContextCreate(rgba, 1, 1, 8, 4, colorSpace, kCGImageAlphaPremultipliedLast);
+  CGColorSpaceRelease(colorSpace);
+  // Bitmap contexts have their origin in the bottom left, so move the middle pixel onto (0, 0).
+  CGFloat x = floor(width / 2);
+  CGFloat y = floor(height / 2);
+  CGContextDrawImage(context, CGRectMake(-x, y + 1 - height, width, height), cgImage);
+  CGContextRelease(context);
+}
+
+@implementation MDCShadowLayerShadowImageTests
+
+- (MDCShadowLayer *)shadowImageLayerWithElevation:(CGFloat)elevation
+                                     cornerRadius:(CGFloat)cornerRadius {
+  MDCShadowLayer *layer = [[MDCShadowLayer alloc] init];
+  layer.bounds = CGRectMake(0, 0, 120, 80);
+  layer.cornerRadius = cornerRadius;
+  layer.elevation = elevation;
+  layer.shadowImageEnabled = YES;
+  [layer layoutIfNeeded];
+  return layer;
+}
+
+- (void)testShadowImageIsDisabledByDefault {
+  // Given
+  MDCShadowLayer *layer = [[MDCShadowLayer alloc] init];
+
+  // Then
+  XCTAssertFalse(layer.isShadowImageEnabled);
+}
+
+- (void)testShadowImageReplacesShadowLayers {
+  // When
+  MDCShadowLayer *layer = [self shadowImageLayerWithElevation:MDCShadowElevationCardResting
+                                                 cornerRadius:4];
+
+  // Then
+  XCTAssertTrue(layer.topShadow.hidden);
+  XCTAssertTrue(layer.bottomShadow.hidden);
+  XCTAssertFalse(layer.shadowImageLayer.hidden);
+  XCTAssertNotNil(layer.shadowImageLayer.contents);
+  CGFloat outset = [MDCShadowImageCache shadowOutsetForElevation:MDCShadowElevationCardResting];
+  XCTAssertTrue(CGRectEqualToRect(layer.shadowImageLayer.frame,
+                                  CGRectInset(layer.bounds, -outset, -outset)));
+}
+
+- (void)testLayersWithSameParametersShareShadowImage {
+  // When
+  MDCShadowLayer *layer1 = [self shadowImageLayerWithElevation:MDCShadowElevationCardResting
+                                                  cornerRadius:4];
+  MDCShadowLayer *layer2 = [self shadowImageLayerWithElevation:MDCShadowElevationCardResting
+                                                  cornerRadius:4];
+  NSUInteger renderCount = [MDCShadowImageCache sharedCache].renderCount;
+  MDCShadowLayer *layer3 = [self shadowImageLayerWithElevation:MDCShadowElevationCardResting
+                                                  cornerRadius:4];
+
+  // Then
+  XCTAssertEqual(layer1.shadowImageLayer.contents, layer2.shadowImageLayer.contents);
+  XCTAssertEqual(layer1.shadowImageLayer.contents, layer3.shadowImageLayer.contents);
+  XCTAssertEqual([MDCShadowImageCache sharedCache].renderCount, renderCount);
+}
+
+- (void)testElevationChangeUpdatesShadowImage {
+  // Given
+  MDCShadowLayer *layer = [self shadowImageLayerWithElevation:MDCShadowElevationCardResting
+                                                 cornerRadius:4];
+  id restingContents = layer.shadowImageLayer.contents;
+
+  // When
+  layer.elevation = MDCShadowElevationCardPickedUp;
+  [layer layoutIfNeeded];
+
+  // Then
+  XCTAssertNotEqual(layer.shadowImageLayer.contents, restingContents);
+}
+
+- (void)testCustomShadowPathFallsBackToShadowLayers {
+  // Given
+  MDCShadowLayer *layer = [self shadowImageLayerWithElevation:MDCShadowElevationCardResting
+                                                 cornerRadius:4];
+
+  // When
+  layer.shadowPath = [UIBezierPath bezierPathWithOvalInRect:layer.bounds].CGPath;
+  [layer layoutIfNeeded];
+
+  // Then
+  XCTAssertFalse(layer.topShadow.hidden);
+  XCTAssertFalse(layer.bottomShadow.hidden);
+  XCTAssertTrue(layer.shadowImageLayer.hidden);
+}
+
+- (void)testShadowColorChangeUpdatesShadowImage {
+  // Given
+  MDCShadowLayer *layer = [self shadowImageLayerWithElevation:MDCShadowElevationCardResting
+                                                 cornerRadius:4];
+  id blackContents = layer.shadowImageLayer.contents;
+
+  // When
+  layer.shadowColor = [UIColor redColor].CGColor;
+  [layer layoutIfNeeded];
+
+  // Then
+  XCTAssertFalse(layer.shadowImageLayer.hidden);
+  XCTAssertNotEqual(layer.shadowImageLayer.contents, blackContents);
+}
+
+- (void)testShadowMaskChangeUpdatesShadowImage {
+  // Given
+  MDCShadowLayer *layer = [self shadowImageLayerWithElevation:MDCShadowElevationCardResting
+                                                 cornerRadius:4];
+  id maskedContents = layer.shadowImageLayer.contents;
+
+  // When
+  layer.shadowMaskEnabled = NO;
+  [layer layoutIfNeeded];
+
+  // Then
+  XCTAssertFalse(layer.shadowImageLayer.hidden);
+  XCTAssertNotEqual(layer.shadowImageLayer.contents, maskedContents);
+}
+
+- (void)testNilShadowColorFallsBackToShadowLayers {
+  // Given
+  MDCShadowLayer *layer = [self shadowImageLayerWithElevation:MDCShadowElevationCardResting
+                                                 cornerRadius:4];
+
+  // When
+  layer.shadowColor = NULL;
+  [layer layoutIfNeeded];
+
+  // Then
+  XCTAssertFalse(layer.topShadow.hidden);
+  XCTAssertFalse(layer.bottomShadow.hidden);
+  XCTAssertTrue(layer.shadowImageLayer.hidden);
+}
+
+- (void)testShadowImagesOfDifferentColorsAreRenderedSeparately {
+  // Given
+  MDCShadowImageCache *cache = [[MDCShadowImageCache alloc] init];
+  [cache shadowImageWithElevation:MDCShadowElevationCardResting
+                     cornerRadius:4
+                      shadowColor:[UIColor blackColor].CGColor
+                           masked:YES
+                            scale:2];
+
+  // When
+  [cache shadowImageWithElevation:MDCShadowElevationCardResting
+                     cornerRadius:4
+                      shadowColor:[UIColor redColor].CGColor
+                           masked:YES
+                            scale:2];
+  [cache shadowImageWithElevation:MDCShadowElevationCardResting
+                     cornerRadius:4
+                      shadowColor:[UIColor redColor].CGColor
+                           masked:YES
+                            scale:2];
+
+  // Then
+  XCTAssertEqual(cache.renderCount, 2U);
+}
+
+- (void)testShadowImageIsDrawnInTheShadowColor {
+  // Given
+  MDCShadowImageCache *cache = [[MDCShadowImageCache alloc] init];
+
+  // When
+  UIImage *image = [cache shadowImageWithElevation:MDCShadowElevationCardResting
+                                      cornerRadius:4
+                                       shadowColor:[UIColor redColor].CGColor
+                                            masked:NO
+                                             scale:2];
+
+  // Then
+  uint8_t rgba[4] = {0};
+  GetCenterPixel(image, rgba);
+  XCTAssertGreaterThan(rgba[0], 0);
+  XCTAssertEqual(rgba[1], 0);
+  XCTAssertEqual(rgba[2], 0);
+  XCTAssertGreaterThan(rgba[3], 0);
+}
+
+- (void)testMaskedShadowImageIsTransparentInsideTheShape {
+  // Given
+  MDCShadowImageCache *cache = [[MDCShadowImageCache alloc] init];
+
+  // When
+  UIImage *image = [cache shadowImageWithElevation:MDCShadowElevationCardResting
+                                      cornerRadius:4
+                                       shadowColor:[UIColor blackColor].CGColor
+                                            masked:YES
+                                             scale:2];
+
+  // Then
+  uint8_t rgba[4] = {0};
+  GetCenterPixel(image, rgba);
+  XCTAssertEqual(rgba[3], 0);
+}
+
+- (void)testUnmaskedShadowImageKeepsTheShadowInsideTheShape {
+  // Given
+  MDCShadowImageCache *cache = [[MDCShadowImageCache alloc] init];
+
+  // When
+  UIImage *image = [cache shadowImageWithElevation:MDCShadowElevationCardResting
+                                      cornerRadius:4
+                                       shadowColor:[UIColor blackColor].CGColor
+                                            masked:NO
+                                             scale:2];
+
+  // Then
+  uint8_t rgba[4] = {0};
+  GetCenterPixel(image, rgba);
+  XCTAssertGreaterThan(rgba[3], 0);
+}
+
+- (void)testZeroElevationHidesShadowImage {
+  // When
+  MDCShadowLayer *layer = [self shadowImageLayerWithElevation:0 cornerRadius:4];
+
+  // Then
+  XCTAssertTrue(layer.shadowImageLayer.hidden);
+}
+
+@end
@@ -15,6 +15,8 @@
 #import <XCTest/XCTest.h>
 #import "MaterialShadowLayer.h"
 
+static const NSInteger kBenchmarkIterations = 100000;
+
 @interface ShadowLayerTests : XCTestCase
 @end
 
@@ -29,4 +31,55 @@
   XCTAssertTrue(shadowLayer.isShadowMaskEnabled);
 }
 
+- (void)testMetricsForStandardElevationsAreShared {
+  // When
+  MDCShadowMetrics *metrics1 = [MDCShadowMetrics metricsWithElevation:MDCShadowElevationCardResting];
+  MDCShadowMetrics *metrics2 = [MDCShadowMetrics metricsWithElevation:MDCShadowElevationCardResting];
+
+  // Then
+  XCTAssertEqual(metrics1, metrics2);
+}
+
+- (void)testMetricsValuesMatchMetricsObjects {
+  CGFloat elevations[] = {-1, 0, (CGFloat)0.5, 1, 2, 3, 4, 6, 8, (CGFloat)8.5, 12, 16, 24, 30};
+  for (size_t i = 0; i < sizeof(elevations) / sizeof(elevations[0]); ++i) {
+    // When
+    MDCShadowMetrics *metrics = [MDCShadowMetrics metricsWithElevation:elevations[i]];
+    MDCShadowMetricsValues values = MDCShadowMetricsValuesForElevation(elevations[i]);
+
+    // Then
+    XCTAssertEqualWithAccuracy(values.topShadowRadius, metrics.topShadowRadius, 0.0001);
+    XCTAssertTrue(CGSizeEqualToSize(values.topShadowOffset, metrics.topShadowOffset));
+    XCTAssertEqualWithAccuracy(values.topShadowOpacity, metrics.topShadowOpacity, 0.0001);
+    XCTAssertEqualWithAccuracy(values.bottomShadowRadius, metrics.bottomShadowRadius, 0.0001);
+    XCTAssertTrue(CGSizeEqualToSize(values.bottomShadowOffset, metrics.bottomShadowOffset));
+    XCTAssertEqualWithAccuracy(values.bottomShadowOpacity, metrics.bottomShadowOpacity, 0.0001);
+  }
+}
+
+#pragma mark - Performance
+
+// Simulates an elevation animation from resting to pressed, one lookup per frame.
+- (void)testPerformanceMetricsObjectsForAnimatedElevation {
+  [self measureBlock:^{
+    CGFloat radius = 0;
+    for (NSInteger i = 0; i < kBenchmarkIterations; ++i) {
+      CGFloat elevation = 2 + (CGFloat)(i % 60) / 10;
+      radius += [MDCShadowMetrics metricsWithElevation:elevation].bottomShadowRadius;
+    }
+    XCTAssertGreaterThan(radius, 0);
+  }];
+}
+
+- (void)testPerformanceMetricsValuesForAnimatedElevation {
+  [self measureBlock:^{
+    CGFloat radius = 0;
+    for (NSInteger i = 0; i < kBenchmarkIterations; ++i) {
+      CGFloat elevation = 2 + (CGFloat)(i % 60) / 10;
+      radius += MDCShadowMetricsValuesForElevation(elevation).bottomShadowRadius;
+    }
+    XCTAssertGreaterThan(radius, 0);
+  }];
+}
+
 @end
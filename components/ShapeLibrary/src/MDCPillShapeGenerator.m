@@ -16,37 +16,60 @@
 
 #import "MDCPillShapeGenerator.h"
 
-#import "MDCRoundedCornerTreatment.h"
-#import "MaterialMath.h"
+/**
+ Creates the path of a rectangle of the given size whose corners are rounded by half of its shorter
+ side. This traces the same outline as an MDCRectangleShapeGenerator with MDCRoundedCornerTreatment
+ corners: clockwise from the top of the top-left corner, starting at (0, radius).
+ */
+static CGPathRef MDCPillPathCreateWithSize(CGSize size) {
+  CGRect rect = CGRectStandardize((CGRect){CGPointZero, size});
+  CGFloat radius = (CGFloat)0.5 * MIN(CGRectGetWidth(rect), CGRectGetHeight(rect));
+  CGFloat minX = CGRectGetMinX(rect);
+  CGFloat minY = CGRectGetMinY(rect);
+  CGFloat maxX = CGRectGetMaxX(rect);
+  CGFloat maxY = CGRectGetMaxY(rect);
+
+  CGMutablePathRef path = CGPathCreateMutable();
+  CGPathMoveToPoint(path, NULL, minX, minY + radius);
+  CGPathAddArcToPoint(path, NULL, minX, minY, minX + radius, minY, radius);
+  CGPathAddLineToPoint(path, NULL, maxX - radius, minY);
+  CGPathAddArcToPoint(path, NULL, maxX, minY, maxX, minY + radius, radius);
+  CGPathAddLineToPoint(path, NULL, maxX, maxY - radius);
+  CGPathAddArcToPoint(path, NULL, maxX, maxY, maxX - radius, maxY, radius);
+  CGPathAddLineToPoint(path, NULL, minX + radius, maxY);
+  CGPathAddArcToPoint(path, NULL, minX, maxY, minX, maxY - radius, radius);
+  CGPathAddLineToPoint(path, NULL, minX, minY + radius);
+  CGPathCloseSubpath(path);
+  return path;
+}
 
 @implementation MDCPillShapeGenerator {
-  MDCRectangleShapeGenerator *_rectangleGenerator;
-  MDCRoundedCornerTreatment *_cornerShape;
+  // The path returned by the last pathForSize: call, returned again while the size is unchanged.
+  CGPathRef _lastPath;
+  CGSize _lastSize;
 }
 
-- (instancetype)init {
-  if (self = [super init]) {
-    [self commonInit];
-  }
-  return self;
+- (void)dealloc {
+  CGPathRelease(_lastPath);
 }
 
 - (id)copyWithZone:(NSZone *)__unused zone {
   return [[[self class] alloc] init];
 }
 
-- (void)commonInit {
-  _cornerShape = [[MDCRoundedCornerTreatment alloc] init];
-  _rectangleGenerator = [[MDCRectangleShapeGenerator alloc] init];
-  [_rectangleGenerator setCorners:_cornerShape];
-}
-
 - (CGPathRef)pathForSize:(CGSize)size {
-  CGFloat radius = (CGFloat)0.5 * MIN(MDCFabs(size.width), MDCFabs(size.height));
-  if (radius > 0) {
-    [_rectangleGenerator setCorners:[[MDCRoundedCornerTreatment alloc] initWithRadius:radius]];
+  if (_lastPath && CGSizeEqualToSize(size, _lastSize)) {
+    return _lastPath;
+  }
+
+  // Callers do not own the returned path, so a path handed out earlier must stay valid until the
+  // current autorelease pool drains.
+  if (_lastPath) {
+    CFAutorelease(_lastPath);
   }
-  return [_rectangleGenerator pathForSize:size];
+  _lastPath = MDCPillPathCreateWithSize(size);
+  _lastSize = size;
+  return _lastPath;
 }
 
 @end
@@ -38,4 +38,16 @@
   return [[[self class] alloc] initWithSize:_size style:_style];
 }
 
+- (BOOL)isEqualToEdgeTreatment:(MDCEdgeTreatment *)edgeTreatment {
+  if (![super isEqualToEdgeTreatment:edgeTreatment]) {
+    return NO;
+  }
+  MDCTriangleEdgeTreatment *otherEdge = (MDCTriangleEdgeTreatment *)edgeTreatment;
+  return self.size == otherEdge.size && self.style == otherEdge.style;
+}
+
+- (NSUInteger)hash {
+  return [super hash] ^ @(self.size).hash ^ @(self.style).hash;
+}
+
 @end
@@ -0,0 +1,128 @@
+// Copyright 2015-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "MaterialShapeLibrary.h"
+#import "MaterialShapes.h"
+
+static const NSInteger kBenchmarkIterations = 10000;
+
+/** Returns the path an MDCRectangleShapeGenerator with rounded corners generates for a pill. */
+static CGPathRef ReferencePillPathForSize(CGSize size) {
+  MDCRectangleShapeGenerator *generator = [[MDCRectangleShapeGenerator alloc] init];
+  CGFloat radius = (CGFloat)0.5 * MIN(size.width, size.height);
+  [generator setCorners:[[MDCRoundedCornerTreatment alloc] initWithRadius:radius]];
+  return [generator pathForSize:size];
+}
+
+@interface MDCPillShapeGeneratorTests : XCTestCase
+@end
+
+@implementation MDCPillShapeGeneratorTests
+
+- (void)testPathMatchesRoundedRectangleShapeGenerator {
+  // Given
+  MDCPillShapeGenerator *generator = [[MDCPillShapeGenerator alloc] init];
+  NSArray<NSValue *> *sizes = @[
+    [NSValue valueWithCGSize:CGSizeMake(120, 32)],
+    [NSValue valueWithCGSize:CGSizeMake(32, 120)],
+    [NSValue valueWithCGSize:CGSizeMake(40, 40)],
+  ];
+
+  for (NSValue *sizeValue in sizes) {
+    CGSize size = sizeValue.CGSizeValue;
+
+    // When
+    CGPathRef path = [generator pathForSize:size];
+    CGPathRef referencePath = ReferencePillPathForSize(size);
+
+    // Then
+    CGRect bounds = CGPathGetBoundingBox(path);
+    CGRect referenceBounds = CGPathGetBoundingBox(referencePath);
+    XCTAssertEqualWithAccuracy(CGRectGetMinX(bounds), CGRectGetMinX(referenceBounds), 0.001);
+    XCTAssertEqualWithAccuracy(CGRectGetMinY(bounds), CGRectGetMinY(referenceBounds), 0.001);
+    XCTAssertEqualWithAccuracy(CGRectGetWidth(bounds), CGRectGetWidth(referenceBounds), 0.001);
+    XCTAssertEqualWithAccuracy(CGRectGetHeight(bounds), CGRectGetHeight(referenceBounds), 0.001);
+    for (CGFloat x = (CGFloat)0.5; x < size.width; x += 1) {
+      for (CGFloat y = (CGFloat)0.5; y < size.height; y += 1) {
+        CGPoint point = CGPointMake(x, y);
+        XCTAssertEqual(CGPathContainsPoint(path, NULL, point, false),
+                       CGPathContainsPoint(referencePath, NULL, point, false), @"%@ at %@",
+                       sizeValue, NSStringFromCGPoint(point));
+      }
+    }
+  }
+}
+
+- (void)testRepeatedSizeReturnsSamePath {
+  // Given
+  MDCPillShapeGenerator *generator = [[MDCPillShapeGenerator alloc] init];
+  CGPathRef firstPath = [generator pathForSize:CGSizeMake(100, 30)];
+
+  // When
+  CGPathRef secondPath = [generator pathForSize:CGSizeMake(100, 30)];
+
+  // Then
+  XCTAssertEqual(firstPath, secondPath);
+}
+
+- (void)testNewSizeKeepsPreviousPathValid {
+  // Given
+  MDCPillShapeGenerator *generator = [[MDCPillShapeGenerator alloc] init];
+  CGPathRef firstPath = [generator pathForSize:CGSizeMake(100, 30)];
+
+  // When
+  CGPathRef secondPath = [generator pathForSize:CGSizeMake(50, 30)];
+
+  // Then
+  XCTAssertNotEqual(firstPath, secondPath);
+  XCTAssertEqualWithAccuracy(CGRectGetWidth(CGPathGetBoundingBox(firstPath)), 100, 0.001);
+  XCTAssertEqualWithAccuracy(CGRectGetWidth(CGPathGetBoundingBox(secondPath)), 50, 0.001);
+}
+
+- (void)testZeroSizeGeneratesEmptyBounds {
+  // Given
+  MDCPillShapeGenerator *generator = [[MDCPillShapeGenerator alloc] init];
+
+  // When
+  CGPathRef path = [generator pathForSize:CGSizeZero];
+
+  // Then
+  XCTAssertTrue(CGRectEqualToRect(CGPathGetBoundingBox(path), CGRectZero));
+}
+
+#pragma mark - Performance
+
+- (void)testPerformancePathForChangingSize {
+  MDCPillShapeGenerator *generator = [[MDCPillShapeGenerator alloc] init];
+  [self measureBlock:^{
+    @autoreleasepool {
+      for (NSInteger i = 0; i < kBenchmarkIterations; ++i) {
+        [generator pathForSize:CGSizeMake(100 + (i % 2), 32)];
+      }
+    }
+  }];
+}
+
+- (void)testPerformancePathForRepeatedSize {
+  MDCPillShapeGenerator *generator = [[MDCPillShapeGenerator alloc] init];
+  [self measureBlock:^{
+    for (NSInteger i = 0; i < kBenchmarkIterations; ++i) {
+      [generator pathForSize:CGSizeMake(100, 32)];
+    }
+  }];
+}
+
+@end
@@ -0,0 +1,231 @@
+// Copyright 2019-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "MaterialShapeLibrary.h"
+#import "MaterialShapes.h"
+
+/** A corner treatment subclass that adds state without overriding -isEqual:. */
+@interface MDCPathCacheTestsOpaqueCornerTreatment : MDCRoundedCornerTreatment
+@property(nonatomic, assign) CGFloat extra;
+@end
+
+@implementation MDCPathCacheTestsOpaqueCornerTreatment
+@end
+
+/** An edge treatment subclass that extends equality through -isEqualToEdgeTreatment:. */
+@interface MDCPathCacheTestsOffsetTriangleEdgeTreatment : MDCTriangleEdgeTreatment
+@property(nonatomic, assign) CGFloat offset;
+@end
+
+@implementation MDCPathCacheTestsOffsetTriangleEdgeTreatment
+
+- (id)copyWithZone:(NSZone *)zone {
+  MDCPathCacheTestsOffsetTriangleEdgeTreatment *copy = [super copyWithZone:zone];
+  copy.offset = self.offset;
+  return copy;
+}
+
+- (BOOL)isEqualToEdgeTreatment:(MDCEdgeTreatment *)edgeTreatment {
+  return [super isEqualToEdgeTreatment:edgeTreatment] &&
+         self.offset == ((MDCPathCacheTestsOffsetTriangleEdgeTreatment *)edgeTreatment).offset;
+}
+
+- (NSUInteger)hash {
+  return [super hash] ^ @(self.offset).hash;
+}
+
+@end
+
+@interface MDCRectangleShapeGeneratorPathCacheTests : XCTestCase
+@property(nonatomic, strong) MDCShapePathCache *cache;
+@end
+
+@implementation MDCRectangleShapeGeneratorPathCacheTests
+
+- (void)setUp {
+  [super setUp];
+
+  self.cache = [[MDCShapePathCache alloc] initWithCountLimit:8];
+}
+
+- (void)tearDown {
+  self.cache = nil;
+
+  [super tearDown];
+}
+
+- (MDCRectangleShapeGenerator *)roundedGeneratorWithRadius:(CGFloat)radius {
+  MDCRectangleShapeGenerator *generator = [[MDCRectangleShapeGenerator alloc] init];
+  [generator setCorners:[[MDCRoundedCornerTreatment alloc] initWithRadius:radius]];
+  generator.pathCache = self.cache;
+  return generator;
+}
+
+- (void)testEqualGeneratorsSharePathForSameSize {
+  // Given
+  MDCRectangleShapeGenerator *generator1 = [self roundedGeneratorWithRadius:4];
+  MDCRectangleShapeGenerator *generator2 = [self roundedGeneratorWithRadius:4];
+
+  // When
+  CGPathRef path1 = [generator1 pathForSize:CGSizeMake(100, 50)];
+  CGPathRef path2 = [generator2 pathForSize:CGSizeMake(100, 50)];
+
+  // Then
+  XCTAssertEqual(path1, path2);
+  XCTAssertEqual(self.cache.missCount, 1U);
+  XCTAssertEqual(self.cache.hitCount, 1U);
+}
+
+- (void)testDifferentSizesDoNotSharePaths {
+  // Given
+  MDCRectangleShapeGenerator *generator = [self roundedGeneratorWithRadius:4];
+
+  // When
+  CGPathRef path1 = [generator pathForSize:CGSizeMake(100, 50)];
+  CGPathRef path2 = [generator pathForSize:CGSizeMake(100, 60)];
+
+  // Then
+  XCTAssertNotEqual(path1, path2);
+  XCTAssertEqual(self.cache.missCount, 2U);
+  XCTAssertEqual(self.cache.hitCount, 0U);
+}
+
+- (void)testMutatingTreatmentInvalidatesCachedPath {
+  // Given
+  MDCRectangleShapeGenerator *generator = [self roundedGeneratorWithRadius:4];
+  CGPathRef originalPath = CGPathRetain([generator pathForSize:CGSizeMake(100, 50)]);
+
+  // When
+  ((MDCRoundedCornerTreatment *)generator.topLeftCorner).radius = 10;
+  CGPathRef mutatedPath = [generator pathForSize:CGSizeMake(100, 50)];
+
+  // Then
+  XCTAssertFalse(CGPathEqualToPath(originalPath, mutatedPath));
+  MDCRectangleShapeGenerator *uncachedGenerator = [self roundedGeneratorWithRadius:4];
+  uncachedGenerator.pathCache = nil;
+  ((MDCRoundedCornerTreatment *)uncachedGenerator.topLeftCorner).radius = 10;
+  XCTAssertTrue(
+      CGPathEqualToPath(mutatedPath, [uncachedGenerator pathForSize:CGSizeMake(100, 50)]));
+  XCTAssertEqual(self.cache.hitCount, 0U);
+  CGPathRelease(originalPath);
+}
+
+- (void)testChangingOffsetInvalidatesCachedPath {
+  // Given
+  MDCRectangleShapeGenerator *generator = [self roundedGeneratorWithRadius:4];
+  [generator pathForSize:CGSizeMake(100, 50)];
+
+  // When
+  generator.topLeftCornerOffset = CGPointMake(5, 5);
+  [generator pathForSize:CGSizeMake(100, 50)];
+
+  // Then
+  XCTAssertEqual(self.cache.missCount, 2U);
+  XCTAssertEqual(self.cache.hitCount, 0U);
+}
+
+- (void)testEqualTriangleEdgesSharePath {
+  // Given
+  MDCRectangleShapeGenerator *generator1 = [self roundedGeneratorWithRadius:4];
+  MDCRectangleShapeGenerator *generator2 = [self roundedGeneratorWithRadius:4];
+  [generator1 setEdges:[[MDCTriangleEdgeTreatment alloc] initWithSize:3
+                                                                 style:MDCTriangleEdgeStyleCut]];
+  [generator2 setEdges:[[MDCTriangleEdgeTreatment alloc] initWithSize:3
+                                                                 style:MDCTriangleEdgeStyleCut]];
+
+  // When
+  CGPathRef path1 = [generator1 pathForSize:CGSizeMake(100, 50)];
+  CGPathRef path2 = [generator2 pathForSize:CGSizeMake(100, 50)];
+
+  // Then
+  XCTAssertEqual(path1, path2);
+  XCTAssertEqual(self.cache.hitCount, 1U);
+}
+
+- (void)testEdgeSubclassesExtendEqualityThroughTheHook {
+  // Given
+  MDCPathCacheTestsOffsetTriangleEdgeTreatment *edge1 =
+      [[MDCPathCacheTestsOffsetTriangleEdgeTreatment alloc] initWithSize:3
+                                                                   style:MDCTriangleEdgeStyleCut];
+  MDCPathCacheTestsOffsetTriangleEdgeTreatment *edge2 = [edge1 copy];
+  edge2.offset = 5;
+  MDCRectangleShapeGenerator *generator1 = [self roundedGeneratorWithRadius:4];
+  MDCRectangleShapeGenerator *generator2 = [self roundedGeneratorWithRadius:4];
+  [generator1 setEdges:edge1];
+  [generator2 setEdges:edge2];
+
+  // When
+  [generator1 pathForSize:CGSizeMake(100, 50)];
+  [generator2 pathForSize:CGSizeMake(100, 50)];
+
+  // Then
+  XCTAssertNotEqualObjects(edge1, edge2);
+  XCTAssertEqualObjects(edge1, [edge1 copy]);
+  XCTAssertEqual(self.cache.hitCount, 0U);
+  XCTAssertEqual(self.cache.missCount, 2U);
+}
+
+- (void)testNegativeSizesAreCachedByValue {
+  // Given
+  MDCRectangleShapeGenerator *generator1 = [self roundedGeneratorWithRadius:4];
+  MDCRectangleShapeGenerator *generator2 = [self roundedGeneratorWithRadius:4];
+  [generator1 setEdges:[[MDCTriangleEdgeTreatment alloc] initWithSize:-3
+                                                                 style:MDCTriangleEdgeStyleCut]];
+  [generator2 setEdges:[[MDCTriangleEdgeTreatment alloc] initWithSize:-3
+                                                                 style:MDCTriangleEdgeStyleCut]];
+
+  // When
+  CGPathRef path1 = [generator1 pathForSize:CGSizeMake(-100, -50)];
+  CGPathRef path2 = [generator2 pathForSize:CGSizeMake(-100, -50)];
+
+  // Then
+  XCTAssertEqual(path1, path2);
+  XCTAssertEqual(self.cache.hitCount, 1U);
+}
+
+- (void)testTreatmentsWithoutValueEqualityAreNotCached {
+  // Given
+  MDCRectangleShapeGenerator *generator = [self roundedGeneratorWithRadius:4];
+  generator.topLeftCorner = [[MDCPathCacheTestsOpaqueCornerTreatment alloc] initWithRadius:4];
+
+  // When
+  [generator pathForSize:CGSizeMake(100, 50)];
+  [generator pathForSize:CGSizeMake(100, 50)];
+
+  // Then
+  XCTAssertEqual(self.cache.hitCount, 0U);
+  XCTAssertEqual(self.cache.missCount, 0U);
+}
+
+- (void)testCachedPathMatchesUncachedPath {
+  // Given
+  MDCRectangleShapeGenerator *cachedGenerator = [self roundedGeneratorWithRadius:(CGFloat)0.25];
+  cachedGenerator.topLeftCorner.valueType = MDCCornerTreatmentValueTypePercentage;
+  MDCRectangleShapeGenerator *uncachedGenerator = [self roundedGeneratorWithRadius:(CGFloat)0.25];
+  uncachedGenerator.topLeftCorner.valueType = MDCCornerTreatmentValueTypePercentage;
+  uncachedGenerator.pathCache = nil;
+
+  // When
+  [cachedGenerator pathForSize:CGSizeMake(80, 40)];
+  CGPathRef cachedPath = [cachedGenerator pathForSize:CGSizeMake(80, 40)];
+
+  // Then
+  XCTAssertEqual(self.cache.hitCount, 1U);
+  XCTAssertTrue(
+      CGPathEqualToPath(cachedPath, [uncachedGenerator pathForSize:CGSizeMake(80, 40)]));
+}
+
+@end
@@ -35,4 +35,15 @@
  */
 - (nonnull MDCPathGenerator *)pathGeneratorForEdgeWithLength:(CGFloat)length;
 
+/**
+ Returns YES if the receiver generates the same paths as @c edgeTreatment, which is an instance of
+ the receiver's class. -isEqual: calls this once it has checked the classes.
+
+ Subclasses that add state should override this method, call super and compare their own
+ properties, and extend -hash to match.
+
+ @param edgeTreatment The edge treatment to compare with.
+ */
+- (BOOL)isEqualToEdgeTreatment:(nonnull MDCEdgeTreatment *)edgeTreatment;
+
 @end
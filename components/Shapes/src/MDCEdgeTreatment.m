@@ -32,4 +32,22 @@
   return [[[self class] alloc] init];
 }
 
+- (BOOL)isEqual:(id)object {
+  if (object == self) {
+    return YES;
+  }
+  if (!object || ![[object class] isEqual:[self class]]) {
+    return NO;
+  }
+  return [self isEqualToEdgeTreatment:(MDCEdgeTreatment *)object];
+}
+
+- (BOOL)isEqualToEdgeTreatment:(__unused MDCEdgeTreatment *)edgeTreatment {
+  return YES;
+}
+
+- (NSUInteger)hash {
+  return [[self class] hash];
+}
+
 @end
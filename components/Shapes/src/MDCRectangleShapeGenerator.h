@@ -18,6 +18,7 @@
 
 @class MDCCornerTreatment;
 @class MDCEdgeTreatment;
+@class MDCShapePathCache;
 
 /**
  An MDCShapeGenerating for creating shaped rectanglular CGPaths.
@@ -51,6 +52,19 @@
 @property(nonatomic, strong) MDCEdgeTreatment *bottomEdge;
 @property(nonatomic, strong) MDCEdgeTreatment *leftEdge;
 
+/**
+ An optional cache in which generated paths are stored and looked up.
+
+ When set, generators whose treatments and offsets are equal share a single immutable path per
+ size. Lookups compare the current values of the treatments, so mutating a treatment after a path
+ was cached produces a new path rather than a stale one. Paths are only cached when every treatment
+ provides value-based equality, through -isEqual: for corners and -isEqualToEdgeTreatment: for
+ edges; otherwise a new path is generated on every call.
+
+ Defaults to nil.
+ */
+@property(nonatomic, strong, nullable) MDCShapePathCache *pathCache;
+
 /**
  Convenience to set all corners to the same MDCCornerTreatment instance.
  */
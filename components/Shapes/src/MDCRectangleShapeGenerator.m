@@ -14,9 +14,12 @@
 
 #import "MDCRectangleShapeGenerator.h"
 
+#import <objc/runtime.h>
+
 #import "MDCCornerTreatment.h"
 #import "MDCEdgeTreatment.h"
 #import "MDCPathGenerator.h"
+#import "MDCShapePathCache.h"
 #import "MaterialMath.h"
 
 static inline CGFloat CGPointDistanceToPoint(CGPoint a, CGPoint b) {
@@ -39,6 +42,72 @@ typedef enum : NSUInteger {
   MDCShapeCornerBottomLeft,
 } MDCShapeCornerPosition;
 
+/**
+ Returns YES if @c treatment compares by value, i.e. its class is @c baseClass or overrides the
+ @c equalitySelector it inherits. Subclasses that add state without overriding it would otherwise
+ compare equal to treatments that generate different paths.
+ */
+static BOOL MDCTreatmentHasValueEquality(id treatment, Class baseClass, SEL equalitySelector) {
+  if (!treatment) {
+    return YES;
+  }
+  Class treatmentClass = [treatment class];
+  if (treatmentClass == baseClass) {
+    return YES;
+  }
+  Class superclass = class_getSuperclass(treatmentClass);
+  return class_getMethodImplementation(treatmentClass, equalitySelector) !=
+         class_getMethodImplementation(superclass, equalitySelector);
+}
+
+static inline BOOL MDCTreatmentsEqual(id first, id second) {
+  return first == second || [first isEqual:second];
+}
+
+/**
+ Identifies the path generated by an MDCRectangleShapeGenerator for a given size by value.
+ */
+@interface MDCRectangleShapeGeneratorPathKey : NSObject {
+ @public
+  Class _generatorClass;
+  CGSize _size;
+  MDCCornerTreatment *_corners[4];
+  CGPoint _cornerOffsets[4];
+  MDCEdgeTreatment *_edges[4];
+  NSUInteger _hash;
+}
+@end
+
+@implementation MDCRectangleShapeGeneratorPathKey
+
+- (BOOL)isEqual:(id)object {
+  if (object == self) {
+    return YES;
+  }
+  if (![object isKindOfClass:[MDCRectangleShapeGeneratorPathKey class]]) {
+    return NO;
+  }
+  MDCRectangleShapeGeneratorPathKey *other = (MDCRectangleShapeGeneratorPathKey *)object;
+  if (_hash != other->_hash || _generatorClass != other->_generatorClass ||
+      !CGSizeEqualToSize(_size, other->_size)) {
+    return NO;
+  }
+  for (NSInteger i = 0; i < 4; i++) {
+    if (!CGPointEqualToPoint(_cornerOffsets[i], other->_cornerOffsets[i]) ||
+        !MDCTreatmentsEqual(_corners[i], other->_corners[i]) ||
+        !MDCTreatmentsEqual(_edges[i], other->_edges[i])) {
+      return NO;
+    }
+  }
+  return YES;
+}
+
+- (NSUInteger)hash {
+  return _hash;
+}
+
+@end
+
 @implementation MDCRectangleShapeGenerator
 
 - (instancetype)init {
@@ -67,6 +136,8 @@ typedef enum : NSUInteger {
   copy.bottomEdge = [copy.bottomEdge copyWithZone:zone];
   copy.leftEdge = [copy.leftEdge copyWithZone:zone];
 
+  copy.pathCache = self.pathCache;
+
   return copy;
 }
 
@@ -123,7 +194,56 @@ typedef enum : NSUInteger {
   }
 }
 
+- (BOOL)canCachePaths {
+  for (NSInteger i = 0; i < 4; i++) {
+    if (!MDCTreatmentHasValueEquality([self cornerTreatmentForPosition:i],
+                                      [MDCCornerTreatment class], @selector(isEqual:)) ||
+        !MDCTreatmentHasValueEquality([self edgeTreatmentForPosition:i], [MDCEdgeTreatment class],
+                                      @selector(isEqualToEdgeTreatment:))) {
+      return NO;
+    }
+  }
+  return YES;
+}
+
+- (MDCRectangleShapeGeneratorPathKey *)pathKeyForSize:(CGSize)size copyTreatments:(BOOL)copy {
+  MDCRectangleShapeGeneratorPathKey *key = [[MDCRectangleShapeGeneratorPathKey alloc] init];
+  key->_generatorClass = [self class];
+  key->_size = size;
+  NSUInteger hash = @(size.width).hash * 31 + @(size.height).hash;
+  for (NSInteger i = 0; i < 4; i++) {
+    MDCCornerTreatment *corner = [self cornerTreatmentForPosition:i];
+    MDCEdgeTreatment *edge = [self edgeTreatmentForPosition:i];
+    key->_corners[i] = copy ? [corner copy] : corner;
+    key->_edges[i] = copy ? [edge copy] : edge;
+    key->_cornerOffsets[i] = [self cornerOffsetForPosition:i];
+    hash = hash * 31 + corner.hash;
+    hash = hash * 31 + edge.hash;
+  }
+  key->_hash = hash;
+  return key;
+}
+
 - (CGPathRef)pathForSize:(CGSize)size {
+  MDCShapePathCache *pathCache = self.pathCache;
+  if (!pathCache || ![self canCachePaths]) {
+    return (CGPathRef)CFAutorelease([self createPathForSize:size]);
+  }
+
+  // Look up with the live treatments and only copy them when the path is inserted, so that a hit
+  // does not allocate any treatments.
+  CGPathRef cachedPath = [pathCache pathForKey:[self pathKeyForSize:size copyTreatments:NO]];
+  if (cachedPath) {
+    return cachedPath;
+  }
+  CGMutablePathRef path = [self createPathForSize:size];
+  CGPathRef storedPath = [pathCache setPath:path
+                                     forKey:[self pathKeyForSize:size copyTreatments:YES]];
+  CGPathRelease(path);
+  return storedPath;
+}
+
+- (CGMutablePathRef)createPathForSize:(CGSize)size CF_RETURNS_RETAINED {
   CGMutablePathRef path = CGPathCreateMutable();
   MDCPathGenerator *cornerPaths[4];
   CGAffineTransform cornerTransforms[4];
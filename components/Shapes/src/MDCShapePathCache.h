@@ -0,0 +1,86 @@
+// Copyright 2019-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <CoreGraphics/CoreGraphics.h>
+#import <Foundation/Foundation.h>
+
+/**
+ A bounded cache of immutable CGPaths that can be shared between shape generators.
+
+ Shape generators look paths up by a key describing everything that affects the generated
+ geometry, so generators that describe the same shape share a single path per size. Keys must
+ implement value-based -isEqual: and -hash and must not be mutated after insertion.
+
+ MDCShapePathCache is safe to use from any thread.
+ */
+@interface MDCShapePathCache : NSObject
+
+/**
+ A process-wide cache suitable for assigning to the @c pathCache of shape generators that should
+ share their paths.
+ */
++ (nonnull instancetype)sharedCache;
+
+/**
+ Creates a cache that holds at most @c countLimit paths. Paths are evicted once the limit is
+ reached and when the system is low on memory.
+ */
+- (nonnull instancetype)initWithCountLimit:(NSUInteger)countLimit NS_DESIGNATED_INITIALIZER;
+
+/**
+ Creates a cache with a default count limit of 256 paths.
+ */
+- (nonnull instancetype)init;
+
+/**
+ The maximum number of paths held by the cache.
+ */
+@property(nonatomic, readonly) NSUInteger countLimit;
+
+/**
+ The number of lookups that returned a cached path.
+ */
+@property(nonatomic, readonly) NSUInteger hitCount;
+
+/**
+ The number of lookups that did not find a cached path.
+ */
+@property(nonatomic, readonly) NSUInteger missCount;
+
+/**
+ Returns the path stored for @c key, or NULL if there is none. Updates @c hitCount or
+ @c missCount.
+
+ The returned path is not owned by the caller.
+ */
+- (nullable CGPathRef)pathForKey:(nonnull id)key;
+
+/**
+ Stores an immutable copy of @c path for @c key.
+
+ @return The stored path. It is not owned by the caller.
+ */
+- (nonnull CGPathRef)setPath:(nonnull CGPathRef)path forKey:(nonnull id)key;
+
+/**
+ Removes every path from the cache. Does not reset the counters.
+ */
+- (void)removeAllPaths;
+
+/**
+ Resets @c hitCount and @c missCount to zero.
+ */
+- (void)resetCounters;
+
+@end
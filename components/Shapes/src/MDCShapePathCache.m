@@ -0,0 +1,86 @@
+// Copyright 2019-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "MDCShapePathCache.h"
+
+#include <stdatomic.h>
+
+static const NSUInteger kDefaultCountLimit = 256;
+
+@implementation MDCShapePathCache {
+  NSCache *_paths;
+  atomic_ulong _hitCount;
+  atomic_ulong _missCount;
+}
+
++ (instancetype)sharedCache {
+  static MDCShapePathCache *sharedCache;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    sharedCache = [[MDCShapePathCache alloc] init];
+  });
+  return sharedCache;
+}
+
+- (instancetype)init {
+  return [self initWithCountLimit:kDefaultCountLimit];
+}
+
+- (instancetype)initWithCountLimit:(NSUInteger)countLimit {
+  self = [super init];
+  if (self) {
+    _countLimit = countLimit;
+    _paths = [[NSCache alloc] init];
+    _paths.countLimit = countLimit;
+    atomic_init(&_hitCount, 0);
+    atomic_init(&_missCount, 0);
+  }
+  return self;
+}
+
+- (NSUInteger)hitCount {
+  return (NSUInteger)atomic_load_explicit(&_hitCount, memory_order_relaxed);
+}
+
+- (NSUInteger)missCount {
+  return (NSUInteger)atomic_load_explicit(&_missCount, memory_order_relaxed);
+}
+
+- (CGPathRef)pathForKey:(id)key {
+  id path = [_paths objectForKey:key];
+  if (!path) {
+    atomic_fetch_add_explicit(&_missCount, 1, memory_order_relaxed);
+    return NULL;
+  }
+  atomic_fetch_add_explicit(&_hitCount, 1, memory_order_relaxed);
+  // The cache may evict the path at any time, so keep it alive until the caller is done with it.
+  return (CGPathRef)CFAutorelease(CFBridgingRetain(path));
+}
+
+- (CGPathRef)setPath:(CGPathRef)path forKey:(id)key {
+  id immutablePath = CFBridgingRelease(CGPathCreateCopy(path));
+  [_paths setObject:immutablePath forKey:key];
+  return (CGPathRef)CFAutorelease(CFBridgingRetain(immutablePath));
+}
+
+- (void)removeAllPaths {
+  [_paths removeAllObjects];
+}
+
+- (void)resetCounters {
+  atomic_store_explicit(&_hitCount, 0, memory_order_relaxed);
+  atomic_store_explicit(&_missCount, 0, memory_order_relaxed);
+}
+
+@end
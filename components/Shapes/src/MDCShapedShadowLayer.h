@@ -61,6 +61,24 @@
  */
 @property(nonatomic, strong, nullable) id<MDCShapeGenerating> shapeGenerator;
 
+/*
+ Whether layoutSublayers should skip regenerating the path when nothing that affects it changed.
+
+ When enabled, the path, and the shadow path and shadow masks derived from it, are only regenerated
+ when the bounds size, the shapeGenerator or the shapedBorderWidth changed since the path was last
+ set. Assigning shapeGenerator always regenerates the path, even if the same generator is assigned
+ again, so reassign the generator after mutating it in place.
+
+ Defaults to NO.
+ */
+@property(nonatomic, assign) BOOL skipsRedundantPathUpdates;
+
+/*
+ The number of times the path was regenerated from shapeGenerator. Intended for tests that verify
+ that layout does not regenerate the path unnecessarily.
+ */
+@property(nonatomic, readonly) NSUInteger pathUpdateCount;
+
 /*
  The created CAShapeLayer representing the generated shape path for the implementing UIView
  from the shapeGenerator.
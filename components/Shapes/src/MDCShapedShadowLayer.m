@@ -16,7 +16,13 @@
 
 #import "MDCShapeGenerating.h"
 
-@implementation MDCShapedShadowLayer
+@implementation MDCShapedShadowLayer {
+  // The inputs the current path was generated from. Only used if skipsRedundantPathUpdates is YES.
+  CGSize _pathSize;
+  __weak id<MDCShapeGenerating> _pathShapeGenerator;
+  CGFloat _pathBorderWidth;
+  BOOL _pathIsValid;
+}
 
 - (instancetype)init {
   self = [super init];
@@ -40,6 +46,7 @@
     MDCShapedShadowLayer *otherLayer = (MDCShapedShadowLayer *)layer;
 
     _shapeGenerator = [otherLayer.shapeGenerator copyWithZone:NULL];
+    _skipsRedundantPathUpdates = otherLayer.skipsRedundantPathUpdates;
     // We don't need to copy fillColor because that gets copied by [super initWithLayer:].
 
     // [CALayer initWithLayer:] copies all sublayers, so we have to manually fetch our CAShapeLayer.
@@ -64,7 +71,9 @@
   // to be correctly set before MDCShadowLayer performs layoutSublayers.
   if (self.shapeGenerator) {
     CGRect standardizedBounds = CGRectStandardize(self.bounds);
-    self.path = [self.shapeGenerator pathForSize:standardizedBounds.size];
+    if (![self isPathValidForSize:standardizedBounds.size]) {
+      [self updatePathForSize:standardizedBounds.size];
+    }
   }
 
   [super layoutSublayers];
@@ -79,7 +88,22 @@
   _shapeGenerator = shapeGenerator;
 
   CGRect standardizedBounds = CGRectStandardize(self.bounds);
-  self.path = [self.shapeGenerator pathForSize:standardizedBounds.size];
+  [self updatePathForSize:standardizedBounds.size];
+}
+
+- (BOOL)isPathValidForSize:(CGSize)size {
+  return self.skipsRedundantPathUpdates && _pathIsValid && _pathShapeGenerator == _shapeGenerator &&
+         CGSizeEqualToSize(_pathSize, size) && _pathBorderWidth == _shapedBorderWidth;
+}
+
+- (void)updatePathForSize:(CGSize)size {
+  self.path = [self.shapeGenerator pathForSize:size];
+  _pathUpdateCount += 1;
+
+  _pathSize = size;
+  _pathShapeGenerator = _shapeGenerator;
+  _pathBorderWidth = _shapedBorderWidth;
+  _pathIsValid = _shapeGenerator != nil;
 }
 
 - (void)setPath:(CGPathRef)path {
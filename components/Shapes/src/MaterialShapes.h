@@ -16,6 +16,7 @@
 #import "MDCEdgeTreatment.h"
 #import "MDCPathGenerator.h"
 #import "MDCRectangleShapeGenerator.h"
+#import "MDCShapePathCache.h"
 #import "MDCShapeGenerating.h"
 #import "MDCShapedShadowLayer.h"
 #import "MDCShapedView.h"
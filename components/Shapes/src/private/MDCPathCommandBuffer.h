@@ -0,0 +1,112 @@
+// Copyright 2019-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <CoreGraphics/CoreGraphics.h>
+#import <Foundation/Foundation.h>
+
+/**
+ The kind of operation stored in an MDCPathCommand. Each case maps onto exactly one CGPath
+ function.
+ */
+typedef enum : uint8_t {
+  MDCPathCommandTypeLine = 0,   // CGPathAddLineToPoint
+  MDCPathCommandTypeArc,        // CGPathAddArc
+  MDCPathCommandTypeArcTo,      // CGPathAddArcToPoint
+  MDCPathCommandTypeCurve,      // CGPathAddCurveToPoint
+  MDCPathCommandTypeQuadCurve,  // CGPathAddQuadCurveToPoint
+} MDCPathCommandType;
+
+/**
+ A single recorded path operation stored by value.
+
+ Only the member of the union matching @c type is valid.
+ */
+typedef struct {
+  MDCPathCommandType type;
+  union {
+    struct {
+      CGPoint point;
+    } line;
+    struct {
+      CGPoint center;
+      CGFloat radius;
+      CGFloat startAngle;
+      CGFloat endAngle;
+      bool clockwise;
+    } arc;
+    struct {
+      CGPoint tangentPoint;
+      CGPoint toPoint;
+      CGFloat radius;
+    } arcTo;
+    struct {
+      CGPoint control1;
+      CGPoint control2;
+      CGPoint toPoint;
+    } curve;
+    struct {
+      CGPoint control;
+      CGPoint toPoint;
+    } quadCurve;
+  };
+} MDCPathCommand;
+
+/**
+ The number of commands an MDCPathCommandBuffer can hold before it needs to allocate.
+
+ The corner and edge treatments shipped with MDC never record more than four commands, so the
+ common case never touches the heap.
+ */
+#define MDCPathCommandBufferInlineCapacity 4
+
+/**
+ A growable list of MDCPathCommands with inline storage for the first few commands.
+
+ Treat the fields as private and only use the functions below. A buffer owns its heap storage, so
+ it must not be copied by value once it has grown past its inline capacity.
+ */
+typedef struct {
+  MDCPathCommand inlineCommands[MDCPathCommandBufferInlineCapacity];
+  MDCPathCommand *_Nullable heapCommands;
+  size_t count;
+  size_t capacity;
+} MDCPathCommandBuffer;
+
+/** Prepares @c buffer for use. Does not allocate. */
+FOUNDATION_EXTERN void MDCPathCommandBufferInit(MDCPathCommandBuffer *_Nonnull buffer);
+
+/** Releases any heap storage owned by @c buffer and empties it. */
+FOUNDATION_EXTERN void MDCPathCommandBufferDestroy(MDCPathCommandBuffer *_Nonnull buffer);
+
+/**
+ Appends @c command to @c buffer, growing the backing storage if needed.
+
+ @return false if the backing storage could not be grown, in which case the command is dropped.
+ */
+FOUNDATION_EXTERN bool MDCPathCommandBufferAppend(MDCPathCommandBuffer *_Nonnull buffer,
+                                                  MDCPathCommand command);
+
+/** Returns a pointer to the first of @c buffer->count contiguous commands. */
+FOUNDATION_EXTERN const MDCPathCommand *_Nonnull MDCPathCommandBufferCommands(
+    const MDCPathCommandBuffer *_Nonnull buffer);
+
+/**
+ Replays every command in @c buffer onto @c cgPath, in order.
+
+ @param transform The transform applied to each command, or NULL for the identity.
+ */
+FOUNDATION_EXTERN void MDCPathCommandBufferApplyToCGPath(
+    const MDCPathCommandBuffer *_Nonnull buffer,
+    CGMutablePathRef _Nonnull cgPath,
+    const CGAffineTransform *_Nullable transform);
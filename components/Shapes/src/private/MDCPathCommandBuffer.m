@@ -0,0 +1,95 @@
+// Copyright 2019-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "MDCPathCommandBuffer.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+void MDCPathCommandBufferInit(MDCPathCommandBuffer *buffer) {
+  buffer->heapCommands = NULL;
+  buffer->count = 0;
+  buffer->capacity = MDCPathCommandBufferInlineCapacity;
+}
+
+void MDCPathCommandBufferDestroy(MDCPathCommandBuffer *buffer) {
+  free(buffer->heapCommands);
+  MDCPathCommandBufferInit(buffer);
+}
+
+const MDCPathCommand *MDCPathCommandBufferCommands(const MDCPathCommandBuffer *buffer) {
+  return buffer->heapCommands ? buffer->heapCommands : buffer->inlineCommands;
+}
+
+static bool MDCPathCommandBufferGrow(MDCPathCommandBuffer *buffer) {
+  size_t newCapacity = buffer->capacity * 2;
+  MDCPathCommand *newCommands;
+  if (buffer->heapCommands) {
+    newCommands = realloc(buffer->heapCommands, newCapacity * sizeof(MDCPathCommand));
+  } else {
+    newCommands = malloc(newCapacity * sizeof(MDCPathCommand));
+    if (newCommands) {
+      memcpy(newCommands, buffer->inlineCommands, buffer->count * sizeof(MDCPathCommand));
+    }
+  }
+  if (!newCommands) {
+    return false;
+  }
+  buffer->heapCommands = newCommands;
+  buffer->capacity = newCapacity;
+  return true;
+}
+
+bool MDCPathCommandBufferAppend(MDCPathCommandBuffer *buffer, MDCPathCommand command) {
+  if (buffer->count == buffer->capacity && !MDCPathCommandBufferGrow(buffer)) {
+    return false;
+  }
+  MDCPathCommand *commands =
+      buffer->heapCommands ? buffer->heapCommands : buffer->inlineCommands;
+  commands[buffer->count] = command;
+  buffer->count += 1;
+  return true;
+}
+
+void MDCPathCommandBufferApplyToCGPath(const MDCPathCommandBuffer *buffer,
+                                       CGMutablePathRef cgPath,
+                                       const CGAffineTransform *transform) {
+  const MDCPathCommand *commands = MDCPathCommandBufferCommands(buffer);
+  for (size_t i = 0; i < buffer->count; ++i) {
+    const MDCPathCommand *op = &commands[i];
+    switch (op->type) {
+      case MDCPathCommandTypeLine:
+        CGPathAddLineToPoint(cgPath, transform, op->line.point.x, op->line.point.y);
+        break;
+      case MDCPathCommandTypeArc:
+        CGPathAddArc(cgPath, transform, op->arc.center.x, op->arc.center.y, op->arc.radius,
+                     op->arc.startAngle, op->arc.endAngle, op->arc.clockwise);
+        break;
+      case MDCPathCommandTypeArcTo:
+        CGPathAddArcToPoint(cgPath, transform, op->arcTo.tangentPoint.x, op->arcTo.tangentPoint.y,
+                            op->arcTo.toPoint.x, op->arcTo.toPoint.y, op->arcTo.radius);
+        break;
+      case MDCPathCommandTypeCurve:
+        CGPathAddCurveToPoint(cgPath, transform, op->curve.control1.x, op->curve.control1.y,
+                              op->curve.control2.x, op->curve.control2.y, op->curve.toPoint.x,
+                              op->curve.toPoint.y);
+        break;
+      case MDCPathCommandTypeQuadCurve:
+        CGPathAddQuadCurveToPoint(cgPath, transform, op->quadCurve.control.x,
+                                  op->quadCurve.control.y, op->quadCurve.toPoint.x,
+                                  op->quadCurve.toPoint.y);
+        break;
+    }
+  }
+}
@@ -0,0 +1,126 @@
+// Copyright 2019-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "MDCPathCommandBuffer.h"
+#import "MaterialShapes.h"
+
+static const NSInteger kBenchmarkIterations = 10000;
+
+@interface MDCPathGeneratorTests : XCTestCase
+@end
+
+@implementation MDCPathGeneratorTests
+
+- (void)testAppendToCGPathMatchesEquivalentCGPathCalls {
+  // Given
+  MDCPathGenerator *generator = [MDCPathGenerator pathGeneratorWithStartPoint:CGPointMake(1, 2)];
+  CGAffineTransform transform = CGAffineTransformMakeTranslation(10, 20);
+
+  // When
+  [generator addLineToPoint:CGPointMake(5, 5)];
+  [generator addArcWithCenter:CGPointMake(10, 10)
+                       radius:5
+                   startAngle:0
+                     endAngle:(CGFloat)M_PI_2
+                    clockwise:YES];
+  [generator addArcWithTangentPoint:CGPointMake(20, 10) toPoint:CGPointMake(20, 20) radius:4];
+  [generator addCurveWithControlPoint1:CGPointMake(21, 21)
+                         controlPoint2:CGPointMake(22, 22)
+                               toPoint:CGPointMake(30, 30)];
+  [generator addQuadCurveWithControlPoint:CGPointMake(31, 35) toPoint:CGPointMake(40, 40)];
+  [generator addLineToPoint:CGPointMake(0, 40)];
+  CGMutablePathRef generatedPath = CGPathCreateMutable();
+  CGPathMoveToPoint(generatedPath, &transform, 1, 2);
+  [generator appendToCGPath:generatedPath transform:&transform];
+
+  // Then
+  CGMutablePathRef expectedPath = CGPathCreateMutable();
+  CGPathMoveToPoint(expectedPath, &transform, 1, 2);
+  CGPathAddLineToPoint(expectedPath, &transform, 5, 5);
+  CGPathAddArc(expectedPath, &transform, 10, 10, 5, 0, (CGFloat)M_PI_2, true);
+  CGPathAddArcToPoint(expectedPath, &transform, 20, 10, 20, 20, 4);
+  CGPathAddCurveToPoint(expectedPath, &transform, 21, 21, 22, 22, 30, 30);
+  CGPathAddQuadCurveToPoint(expectedPath, &transform, 31, 35, 40, 40);
+  CGPathAddLineToPoint(expectedPath, &transform, 0, 40);
+  XCTAssertTrue(CGPathEqualToPath(generatedPath, expectedPath));
+  XCTAssertTrue(CGPointEqualToPoint(generator.endPoint, CGPointMake(0, 40)));
+  CGPathRelease(generatedPath);
+  CGPathRelease(expectedPath);
+}
+
+- (void)testCommandBufferGrowsPastInlineCapacity {
+  // Given
+  MDCPathCommandBuffer buffer;
+  MDCPathCommandBufferInit(&buffer);
+  const size_t commandCount = MDCPathCommandBufferInlineCapacity * 5;
+
+  // When
+  for (size_t i = 0; i < commandCount; ++i) {
+    MDCPathCommand command = {.type = MDCPathCommandTypeLine};
+    command.line.point = CGPointMake(i, i);
+    XCTAssertTrue(MDCPathCommandBufferAppend(&buffer, command));
+  }
+
+  // Then
+  XCTAssertEqual(buffer.count, commandCount);
+  const MDCPathCommand *commands = MDCPathCommandBufferCommands(&buffer);
+  for (size_t i = 0; i < commandCount; ++i) {
+    XCTAssertEqual(commands[i].type, MDCPathCommandTypeLine);
+    XCTAssertEqual(commands[i].line.point.x, (CGFloat)i);
+  }
+  MDCPathCommandBufferDestroy(&buffer);
+  XCTAssertEqual(buffer.count, 0U);
+}
+
+#pragma mark - Performance
+
+// Records and replays the commands of a typical rounded corner plus edge, which is what
+// MDCRectangleShapeGenerator does eight times per pathForSize: call.
+- (void)testPerformanceRecordAndReplay {
+  CGAffineTransform transform = CGAffineTransformMakeRotation((CGFloat)M_PI_2);
+  [self measureBlock:^{
+    CGMutablePathRef path = CGPathCreateMutable();
+    CGPathMoveToPoint(path, NULL, 0, 0);
+    for (NSInteger i = 0; i < kBenchmarkIterations; ++i) {
+      MDCPathGenerator *generator = [MDCPathGenerator pathGeneratorWithStartPoint:CGPointZero];
+      [generator addArcWithCenter:CGPointMake(8, 8)
+                           radius:8
+                       startAngle:(CGFloat)M_PI
+                         endAngle:(CGFloat)(3 * M_PI_2)
+                        clockwise:YES];
+      [generator addLineToPoint:CGPointMake(100, 0)];
+      [generator appendToCGPath:path transform:&transform];
+    }
+    CGPathRelease(path);
+  }];
+}
+
+- (void)testPerformanceReplayOnly {
+  MDCPathGenerator *generator = [MDCPathGenerator pathGeneratorWithStartPoint:CGPointZero];
+  for (NSInteger i = 0; i < MDCPathCommandBufferInlineCapacity; ++i) {
+    [generator addLineToPoint:CGPointMake(i, i)];
+  }
+  [self measureBlock:^{
+    CGMutablePathRef path = CGPathCreateMutable();
+    CGPathMoveToPoint(path, NULL, 0, 0);
+    for (NSInteger i = 0; i < kBenchmarkIterations; ++i) {
+      [generator appendToCGPath:path transform:NULL];
+    }
+    CGPathRelease(path);
+  }];
+}
+
+@end
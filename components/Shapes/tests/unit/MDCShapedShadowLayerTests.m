@@ -0,0 +1,110 @@
+// Copyright 2019-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "MaterialShapes.h"
+
+@interface MDCShapedShadowLayerTests : XCTestCase
+@property(nonatomic, strong) MDCShapedShadowLayer *layer;
+@end
+
+@implementation MDCShapedShadowLayerTests
+
+- (void)setUp {
+  [super setUp];
+
+  self.layer = [[MDCShapedShadowLayer alloc] init];
+  self.layer.bounds = CGRectMake(0, 0, 100, 50);
+  self.layer.shapeGenerator = [[MDCRectangleShapeGenerator alloc] init];
+}
+
+- (void)tearDown {
+  self.layer = nil;
+
+  [super tearDown];
+}
+
+- (void)testLayoutAlwaysUpdatesPathByDefault {
+  // Given
+  NSUInteger initialCount = self.layer.pathUpdateCount;
+
+  // When
+  [self.layer layoutSublayers];
+  [self.layer layoutSublayers];
+
+  // Then
+  XCTAssertFalse(self.layer.skipsRedundantPathUpdates);
+  XCTAssertEqual(self.layer.pathUpdateCount, initialCount + 2);
+}
+
+- (void)testRepeatedLayoutDoesNotUpdatePathWhenSkippingRedundantUpdates {
+  // Given
+  self.layer.skipsRedundantPathUpdates = YES;
+  [self.layer layoutSublayers];
+  NSUInteger initialCount = self.layer.pathUpdateCount;
+
+  // When
+  for (NSInteger i = 0; i < 10; ++i) {
+    [self.layer layoutSublayers];
+  }
+
+  // Then
+  XCTAssertEqual(self.layer.pathUpdateCount, initialCount);
+}
+
+- (void)testSizeChangeUpdatesPathWhenSkippingRedundantUpdates {
+  // Given
+  self.layer.skipsRedundantPathUpdates = YES;
+  [self.layer layoutSublayers];
+  NSUInteger initialCount = self.layer.pathUpdateCount;
+
+  // When
+  self.layer.bounds = CGRectMake(0, 0, 120, 50);
+  [self.layer layoutSublayers];
+
+  // Then
+  XCTAssertEqual(self.layer.pathUpdateCount, initialCount + 1);
+  XCTAssertTrue(CGRectEqualToRect(CGPathGetBoundingBox(self.layer.path), self.layer.bounds));
+}
+
+- (void)testBorderWidthChangeUpdatesPathWhenSkippingRedundantUpdates {
+  // Given
+  self.layer.skipsRedundantPathUpdates = YES;
+  [self.layer layoutSublayers];
+  NSUInteger initialCount = self.layer.pathUpdateCount;
+
+  // When
+  self.layer.shapedBorderWidth = 2;
+  [self.layer layoutSublayers];
+
+  // Then
+  XCTAssertEqual(self.layer.pathUpdateCount, initialCount + 1);
+}
+
+- (void)testReassigningGeneratorUpdatesPathWhenSkippingRedundantUpdates {
+  // Given
+  self.layer.skipsRedundantPathUpdates = YES;
+  [self.layer layoutSublayers];
+  NSUInteger initialCount = self.layer.pathUpdateCount;
+
+  // When
+  self.layer.shapeGenerator = self.layer.shapeGenerator;
+  [self.layer layoutSublayers];
+
+  // Then
+  XCTAssertEqual(self.layer.pathUpdateCount, initialCount + 1);
+}
+
+@end
@@ -234,6 +234,55 @@
  */
 @property(nonatomic, weak, nullable) id<MDCSnackbarManagerDelegate> delegate;
 
+#pragma mark - Queueing
+
+/**
+ If enabled, a message whose category and text are equal to those of the message currently showing
+ or of a queued message is discarded instead of being queued. The discarded message's completion
+ handler is called with @c userInitiated set to NO.
+
+ Default is set to NO.
+ */
+@property(nonatomic, assign) BOOL coalescesDuplicateMessages;
+
+/**
+ The maximum number of messages accepted within any @c messageRateLimitInterval. Messages shown
+ once the limit is reached are discarded and their completion handlers are called with
+ @c userInitiated set to NO. A value of 0 disables the rate limit.
+
+ Default is set to 0.
+ */
+@property(nonatomic, assign) NSUInteger messageRateLimit;
+
+/**
+ The length of the sliding window, in seconds, over which @c messageRateLimit is enforced.
+
+ Default is set to 1.
+ */
+@property(nonatomic, assign) NSTimeInterval messageRateLimitInterval;
+
+/**
+ The number of messages accepted into the queue. Must be read on the main thread.
+ */
+@property(nonatomic, readonly) NSUInteger enqueuedMessageCount;
+
+/**
+ The number of messages discarded by @c coalescesDuplicateMessages. Must be read on the main
+ thread.
+ */
+@property(nonatomic, readonly) NSUInteger coalescedMessageCount;
+
+/**
+ The number of messages discarded by @c messageRateLimit. Must be read on the main thread.
+ */
+@property(nonatomic, readonly) NSUInteger droppedMessageCount;
+
+/**
+ Resets @c enqueuedMessageCount, @c coalescedMessageCount and @c droppedMessageCount to zero.
+ Must be called on the main thread.
+ */
+- (void)resetMessageCounters;
+
 @end
 
 /**
@@ -14,6 +14,8 @@
 
 #import "MDCSnackbarManager.h"
 
+#import <QuartzCore/QuartzCore.h>
+
 #import "MDCSnackbarMessage.h"
 #import "MDCSnackbarMessageView.h"
 #import "MaterialApplication.h"
@@ -42,6 +44,32 @@ static BOOL UIViewHasFocusedAccessibilityElement(UIView *view) {
  */
 static NSString *const kAllMessagesCategory = @"$$___ALL_MESSAGES___$$";
 
+/**
+ The default value of @c messageRateLimitInterval.
+ */
+static const NSTimeInterval kDefaultMessageRateLimitInterval = 1;
+
+/**
+ Returns the key under which messages of @c category are queued. Messages without a category are
+ queued under NSNull.
+ */
+static id<NSCopying> MDCSnackbarPendingKeyForCategory(NSString *category) {
+  return category ?: (id<NSCopying>)[NSNull null];
+}
+
+/**
+ A message waiting to be displayed along with its position in the order of arrival.
+ */
+@interface MDCSnackbarPendingMessage : NSObject {
+ @public
+  MDCSnackbarMessage *_message;
+  NSUInteger _sequenceNumber;
+}
+@end
+
+@implementation MDCSnackbarPendingMessage
+@end
+
 /**
  The 'actual' Snackbar manager which will take care of showing/hiding Snackbar messages.
  */
@@ -61,9 +89,44 @@ static NSString *const kAllMessagesCategory = @"$$___ALL_MESSAGES___$$";
 @property(nonatomic, weak) MDCSnackbarManager *manager;
 
 /**
- The list of messages waiting to be displayed.
+ The messages waiting to be displayed, keyed by MDCSnackbarPendingKeyForCategory().
+
+ Showing a message dismisses any pending message of the same category, so there is at most one
+ pending message per category.
+ */
+@property(nonatomic) NSMutableDictionary<id, MDCSnackbarPendingMessage *> *pendingMessages;
+
+/**
+ The keys of the pending messages whose category is not suspended, in order of arrival. The first
+ key identifies the next message to show unless all messages are suspended.
+ */
+@property(nonatomic) NSMutableArray<id> *showableCategoryKeys;
+
+/**
+ The sequence number given to the next enqueued message.
+ */
+@property(nonatomic) NSUInteger nextSequenceNumber;
+
+/**
+ The times, from CACurrentMediaTime(), at which recently enqueued messages arrived. Used to
+ enforce the manager's rate limit.
+ */
+@property(nonatomic) NSMutableArray<NSNumber *> *recentEnqueueTimes;
+
+/**
+ The number of messages accepted into the queue.
  */
-@property(nonatomic) NSMutableArray *pendingMessages;
+@property(nonatomic) NSUInteger enqueuedMessageCount;
+
+/**
+ The number of messages discarded because an equal message was showing or queued.
+ */
+@property(nonatomic) NSUInteger coalescedMessageCount;
+
+/**
+ The number of messages discarded because of the rate limit.
+ */
+@property(nonatomic) NSUInteger droppedMessageCount;
 
 /**
  The current suspension tokens.
@@ -100,6 +163,8 @@ static NSString *const kAllMessagesCategory = @"$$___ALL_MESSAGES___$$";
 
 - (instancetype)initWithSnackbarManager:(__weak MDCSnackbarManager *)manager;
 
+- (void)resetMessageCountersMainThread;
+
 @end
 
 @interface MDCSnackbarManagerSuspensionToken : NSObject <MDCSnackbarSuspensionToken>
@@ -124,7 +189,9 @@ static NSString *const kAllMessagesCategory = @"$$___ALL_MESSAGES___$$";
   self = [super init];
   if (self) {
     _manager = manager;
-    _pendingMessages = [[NSMutableArray alloc] init];
+    _pendingMessages = [NSMutableDictionary dictionary];
+    _showableCategoryKeys = [NSMutableArray array];
+    _recentEnqueueTimes = [NSMutableArray array];
     _suspensionTokens = [NSMutableDictionary dictionary];
   }
   return self;
@@ -132,53 +199,18 @@ static NSString *const kAllMessagesCategory = @"$$___ALL_MESSAGES___$$";
 
 #pragma mark - Message Displaying
 
-/**
- Determines whether or not a message is eligible to be shown based on the Snackbar manager's current
- configuration.
-
- @note This method should ensure that messages in the same category are not shown out of order.
- */
-- (BOOL)shouldShowMessageRightNowMainThread:(MDCSnackbarMessage *)message {
-  // If there are outstanding suspension tokens for all messages (not just specific categories),
-  // then hold off on displaying.
-  if ([self allMessagesSuspendedMainThread]) {
-    return NO;
-  }
-
-  // If there is an outstanding suspension token for this message category, then hold off on
-  // displaying.
-  if (message.category != nil && [self categorySuspended:message.category]) {
-    return NO;
-  }
-
-  return YES;
-}
-
 - (MDCSnackbarMessage *)dequeueNextShowableMessageMainThread {
-  // NOTE: In pathological cases, the iteration through the pending messages can be an O(n)
-  //       operation. Though we expect `n` to be low, to protect against needless iteration we'll
-  //       do a quick check to see if message displaying is completely suspended.
-  if ([self allMessagesSuspendedMainThread]) {
+  // Messages of suspended categories are kept out of @c showableCategoryKeys, so the next showable
+  // message is always the first one listed there.
+  if ([self allMessagesSuspendedMainThread] || self.showableCategoryKeys.count == 0) {
     return nil;
   }
 
-  __block NSUInteger messageIndex = NSNotFound;
-  [self.pendingMessages
-      enumerateObjectsUsingBlock:^(MDCSnackbarMessage *message, NSUInteger idx, BOOL *stop) {
-        if ([self shouldShowMessageRightNowMainThread:message]) {
-          messageIndex = idx;
-          *stop = YES;
-        }
-      }];
-
-  if (messageIndex != NSNotFound) {
-    MDCSnackbarMessage *message = self.pendingMessages[messageIndex];
-    [self.pendingMessages removeObjectAtIndex:messageIndex];
-
-    return message;
-  }
-
-  return nil;
+  id key = self.showableCategoryKeys.firstObject;
+  [self.showableCategoryKeys removeObjectAtIndex:0];
+  MDCSnackbarMessage *message = self.pendingMessages[key]->_message;
+  [self.pendingMessages removeObjectForKey:key];
+  return message;
 }
 
 // Dequeues and schedules the display of a particular message.
@@ -410,18 +442,101 @@ static NSString *const kAllMessagesCategory = @"$$___ALL_MESSAGES___$$";
   // Ensure that this method is called on the main thread.
   NSAssert([NSThread isMainThread], @"Method is not called on main thread.");
 
+  if (self.manager.coalescesDuplicateMessages &&
+      [self isDuplicateOfShowingOrQueuedMessage:message]) {
+    self.coalescedMessageCount += 1;
+    [message executeCompletionHandlerWithUserInteraction:NO completion:nil];
+    return;
+  }
+
+  if ([self exceedsRateLimitMainThread]) {
+    self.droppedMessageCount += 1;
+    [message executeCompletionHandlerWithUserInteraction:NO completion:nil];
+    return;
+  }
+
   // Dismiss and call the completion block for all the messages from the same category.
   [self dismissAndCallCompletionBlocksOnMainThreadWithCategory:message.category];
 
   // Add the new message to the queue, the call to @c showNextMessageIfNecessaryMainThread will take
   // care of getting it on screen. At this moment, @c message is the only message of its category
-  // in @c _sPendingMessages.
-  [self.pendingMessages addObject:message];
+  // in @c pendingMessages.
+  id key = MDCSnackbarPendingKeyForCategory(message.category);
+  MDCSnackbarPendingMessage *pendingMessage = [[MDCSnackbarPendingMessage alloc] init];
+  pendingMessage->_message = message;
+  pendingMessage->_sequenceNumber = self.nextSequenceNumber;
+  self.nextSequenceNumber += 1;
+  self.pendingMessages[key] = pendingMessage;
+  if (![self categorySuspended:key]) {
+    // The new message arrived last, so appending keeps the keys in order of arrival.
+    [self.showableCategoryKeys addObject:key];
+  }
+  self.enqueuedMessageCount += 1;
 
   // Pulse the UI as needed.
   [self showNextMessageIfNecessaryMainThread];
 }
 
+/**
+ Returns YES if a message with the same category and text as @c message is showing and not being
+ dismissed, or is waiting to be shown.
+ */
+- (BOOL)isDuplicateOfShowingOrQueuedMessage:(MDCSnackbarMessage *)message {
+  NSMutableArray<MDCSnackbarMessage *> *candidates = [NSMutableArray arrayWithCapacity:2];
+  if (self.currentSnackbar != nil && !self.currentSnackbar.dismissing) {
+    [candidates addObject:self.currentSnackbar.message];
+  }
+  MDCSnackbarPendingMessage *pendingMessage =
+      self.pendingMessages[MDCSnackbarPendingKeyForCategory(message.category)];
+  if (pendingMessage) {
+    [candidates addObject:pendingMessage->_message];
+  }
+  for (MDCSnackbarMessage *candidate in candidates) {
+    BOOL sameCategory = candidate.category == message.category ||
+                        [candidate.category isEqualToString:message.category];
+    BOOL sameText = candidate.attributedText == message.attributedText ||
+                    [candidate.attributedText isEqualToAttributedString:message.attributedText];
+    if (sameCategory && sameText) {
+      return YES;
+    }
+  }
+  return NO;
+}
+
+/**
+ Returns YES if enqueuing another message would exceed the manager's rate limit. Otherwise records
+ the current time as the arrival of a message and returns NO.
+ */
+- (BOOL)exceedsRateLimitMainThread {
+  NSUInteger rateLimit = self.manager.messageRateLimit;
+  if (rateLimit == 0) {
+    return NO;
+  }
+
+  CFTimeInterval now = CACurrentMediaTime();
+  CFTimeInterval windowStart = now - self.manager.messageRateLimitInterval;
+  NSUInteger expiredCount = 0;
+  for (NSNumber *enqueueTime in self.recentEnqueueTimes) {
+    if (enqueueTime.doubleValue > windowStart) {
+      break;
+    }
+    expiredCount += 1;
+  }
+  [self.recentEnqueueTimes removeObjectsInRange:NSMakeRange(0, expiredCount)];
+
+  if (self.recentEnqueueTimes.count >= rateLimit) {
+    return YES;
+  }
+  [self.recentEnqueueTimes addObject:@(now)];
+  return NO;
+}
+
+- (void)resetMessageCountersMainThread {
+  self.enqueuedMessageCount = 0;
+  self.coalescedMessageCount = 0;
+  self.droppedMessageCount = 0;
+}
+
 - (void)dismissAndCallCompletionBlocksOnMainThreadWithCategory:(NSString *)categoryToDismiss {
   // Ensure that this method is called on the main thread.
   NSAssert([NSThread isMainThread], @"Method is not called on main thread.");
@@ -439,24 +554,33 @@ static NSString *const kAllMessagesCategory = @"$$___ALL_MESSAGES___$$";
     }
   }
 
-  // Now that we've ensured that the currently showing Snackbar has been taken care of, we can go
-  // through pending messages and fire off their completion blocks as we remove them from the
-  // queue.
-  NSMutableIndexSet *indexesToRemove = [NSMutableIndexSet indexSet];
-  [self.pendingMessages enumerateObjectsUsingBlock:^(MDCSnackbarMessage *pendingMessage,
-                                                     NSUInteger idx, __unused BOOL *stop) {
-    if (!categoryToDismiss || [pendingMessage.category isEqualToString:categoryToDismiss]) {
-      // Mark the message for removal from the pending messages list.
-      [indexesToRemove addIndex:idx];
-
-      // Notify the outside world that this Snackbar has been completed.
-      [pendingMessage executeCompletionHandlerWithUserInteraction:NO completion:nil];
+  // Now that we've ensured that the currently showing Snackbar has been taken care of, we can fire
+  // off the completion blocks of the pending messages as we remove them from the queue.
+  NSArray<MDCSnackbarPendingMessage *> *messagesToRemove;
+  if (categoryToDismiss) {
+    id key = MDCSnackbarPendingKeyForCategory(categoryToDismiss);
+    MDCSnackbarPendingMessage *pendingMessage = self.pendingMessages[key];
+    if (!pendingMessage) {
+      return;
     }
-  }];
+    messagesToRemove = @[ pendingMessage ];
+    [self.pendingMessages removeObjectForKey:key];
+    [self.showableCategoryKeys removeObject:key];
+  } else {
+    // Notify in order of arrival, as the messages would have been shown.
+    messagesToRemove = [self.pendingMessages.allValues
+        sortedArrayUsingComparator:^NSComparisonResult(MDCSnackbarPendingMessage *first,
+                                                       MDCSnackbarPendingMessage *second) {
+          return first->_sequenceNumber < second->_sequenceNumber ? NSOrderedAscending
+                                                                   : NSOrderedDescending;
+        }];
+    [self.pendingMessages removeAllObjects];
+    [self.showableCategoryKeys removeAllObjects];
+  }
 
-  // Make sure the queued up messages aren't shown.
-  if ([indexesToRemove count]) {
-    [self.pendingMessages removeObjectsAtIndexes:indexesToRemove];
+  // Notify the outside world that these Snackbars have been completed.
+  for (MDCSnackbarPendingMessage *pendingMessage in messagesToRemove) {
+    [pendingMessage->_message executeCompletionHandlerWithUserInteraction:NO completion:nil];
   }
 }
 
@@ -474,9 +598,9 @@ static NSString *const kAllMessagesCategory = @"$$___ALL_MESSAGES___$$";
 }
 
 /**
- Returns YES if message display is suspended for the given category.
+ Returns YES if message display is suspended for the given category key.
  */
-- (BOOL)categorySuspended:(NSString *)category {
+- (BOOL)categorySuspended:(id)category {
   NSMutableSet *thisCategorySuspensions = self.suspensionTokens[category];
   if (thisCategorySuspensions.count > 0) {
     return YES;
@@ -492,6 +616,11 @@ static NSString *const kAllMessagesCategory = @"$$___ALL_MESSAGES___$$";
   if (tokens == nil) {
     tokens = [NSMutableSet set];
     self.suspensionTokens[category] = tokens;
+
+    // The category's pending message can't be shown until the category is resumed.
+    if (self.pendingMessages[category]) {
+      [self.showableCategoryKeys removeObject:category];
+    }
   }
 
   [tokens addObject:identifier];
@@ -507,12 +636,36 @@ static NSString *const kAllMessagesCategory = @"$$___ALL_MESSAGES___$$";
   // If that was the last token for this category, do some cleanup.
   if (tokens != nil && tokens.count == 0) {
     [self.suspensionTokens removeObjectForKey:category];
+    [self insertShowableCategoryKeyMainThread:category];
   }
 
   // We may have removed the last suspend, so trigger a display.
   [self showNextMessageIfNecessaryMainThread];
 }
 
+/**
+ Inserts @c key into @c showableCategoryKeys in order of arrival if it has a pending message.
+ */
+- (void)insertShowableCategoryKeyMainThread:(id)key {
+  MDCSnackbarPendingMessage *pendingMessage = self.pendingMessages[key];
+  if (!pendingMessage) {
+    return;
+  }
+  NSUInteger sequenceNumber = pendingMessage->_sequenceNumber;
+  NSUInteger lowerBound = 0;
+  NSUInteger upperBound = self.showableCategoryKeys.count;
+  while (lowerBound < upperBound) {
+    NSUInteger middle = lowerBound + (upperBound - lowerBound) / 2;
+    id middleKey = self.showableCategoryKeys[middle];
+    if (self.pendingMessages[middleKey]->_sequenceNumber < sequenceNumber) {
+      lowerBound = middle + 1;
+    } else {
+      upperBound = middle;
+    }
+  }
+  [self.showableCategoryKeys insertObject:key atIndex:lowerBound];
+}
+
 @end
 
 #pragma mark - Public API
@@ -545,6 +698,7 @@ static NSString *const kAllMessagesCategory = @"$$___ALL_MESSAGES___$$";
   self = [super init];
   if (self) {
     _internalManager = [[MDCSnackbarManagerInternal alloc] initWithSnackbarManager:self];
+    _messageRateLimitInterval = kDefaultMessageRateLimitInterval;
   }
   return self;
 }
@@ -609,6 +763,32 @@ static NSString *const kAllMessagesCategory = @"$$___ALL_MESSAGES___$$";
   return self.internalManager.overlayView.alignment;
 }
 
+#pragma mark - Queueing
+
+- (NSUInteger)enqueuedMessageCount {
+  NSAssert([NSThread isMainThread], @"enqueuedMessageCount must be read on main thread.");
+
+  return self.internalManager.enqueuedMessageCount;
+}
+
+- (NSUInteger)coalescedMessageCount {
+  NSAssert([NSThread isMainThread], @"coalescedMessageCount must be read on main thread.");
+
+  return self.internalManager.coalescedMessageCount;
+}
+
+- (NSUInteger)droppedMessageCount {
+  NSAssert([NSThread isMainThread], @"droppedMessageCount must be read on main thread.");
+
+  return self.internalManager.droppedMessageCount;
+}
+
+- (void)resetMessageCounters {
+  NSAssert([NSThread isMainThread], @"resetMessageCounters must be called on main thread.");
+
+  [self.internalManager resetMessageCountersMainThread];
+}
+
 #pragma mark - Suspension
 
 - (id<MDCSnackbarSuspensionToken>)suspendMessagesWithCategory:(NSString *)category {
@@ -19,6 +19,7 @@
 #import "MDCSnackbarMessageView.h"
 
 #import "MaterialAnimationTiming.h"
+#import "MaterialLocalizedStrings.h"
 #import "MaterialTypography.h"
 #import "private/MDCSnackbarMessageViewInternal.h"
 #import "private/MDCSnackbarOverlayView.h"
@@ -333,11 +334,9 @@ static const MDCFontTextStyle kButtonTextStyle = MDCFontTextStyleButton;
     [_label setContentHuggingPriority:UILayoutPriorityDefaultLow
                               forAxis:UILayoutConstraintAxisHorizontal];
 
-    NSString *accessibilityHintKey =
-        kMaterialSnackbarStringTable[kStr_MaterialSnackbarMessageViewTitleA11yHint];
-    NSString *accessibilityHint = NSLocalizedStringFromTableInBundle(
-        accessibilityHintKey, kMaterialSnackbarStringsTableName, [[self class] bundle],
-        @"Dismissal accessibility hint for Snackbar");
+    // Dismissal accessibility hint for Snackbar
+    NSString *accessibilityHint =
+        [[[self class] stringTable] stringForID:kStr_MaterialSnackbarMessageViewTitleA11yHint];
 
     // For UIAccessibility purposes, the label is the primary 'button' for dismissing the Snackbar,
     // so we'll make sure the label is treated like a button.
@@ -1063,6 +1062,20 @@ static const MDCFontTextStyle kButtonTextStyle = MDCFontTextStyleButton;
   return scaleAnimation;
 }
 
+#pragma mark - Strings
+
++ (MDCLocalizedStringTable *)stringTable {
+  static MDCLocalizedStringTable *stringTable;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    stringTable = [MDCLocalizedStringTable tableNamed:kMaterialSnackbarStringsTableName
+                                             inBundle:[self bundle]
+                                                 keys:kMaterialSnackbarStringTable
+                                                count:kNumMaterialSnackbarStrings];
+  });
+  return stringTable;
+}
+
 #pragma mark - Resource bundle
 
 + (NSBundle *)bundle {
@@ -0,0 +1,143 @@
+// Copyright 2015-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#import <XCTest/XCTest.h>
+
+#import "MaterialSnackbar.h"
+
+@interface MDCSnackbarManagerQueueTests : XCTestCase
+@property(nonatomic, strong) MDCSnackbarManager *manager;
+@property(nonatomic, strong) id<MDCSnackbarSuspensionToken> suspensionToken;
+@end
+
+@implementation MDCSnackbarManagerQueueTests
+
+- (void)setUp {
+  [super setUp];
+
+  self.manager = [[MDCSnackbarManager alloc] init];
+  // Keep every message queued so that no Snackbar views are presented.
+  self.suspensionToken = [self.manager suspendAllMessages];
+}
+
+- (void)tearDown {
+  [self.manager dismissAndCallCompletionBlocksWithCategory:nil];
+  [self waitForMainQueue];
+  self.suspensionToken = nil;
+  self.manager = nil;
+
+  [super tearDown];
+}
+
+/** Waits for the work that MDCSnackbarManager dispatched to the main queue. */
+- (void)waitForMainQueue {
+  XCTestExpectation *expectation = [self expectationWithDescription:@"main queue"];
+  dispatch_async(dispatch_get_main_queue(), ^{
+    [expectation fulfill];
+  });
+  [self waitForExpectationsWithTimeout:1 handler:nil];
+}
+
+- (void)testDuplicateMessagesAreCoalescedWhenEnabled {
+  // Given
+  self.manager.coalescesDuplicateMessages = YES;
+  __block NSInteger completionCount = 0;
+
+  // When
+  for (NSInteger i = 0; i < 5; i++) {
+    MDCSnackbarMessage *message = [MDCSnackbarMessage messageWithText:@"You are offline"];
+    message.category = @"network";
+    message.completionHandler = ^(__unused BOOL userInitiated) {
+      completionCount += 1;
+    };
+    [self.manager showMessage:message];
+  }
+  [self waitForMainQueue];
+  // Completion handlers are dispatched by the work above, so wait for them too.
+  [self waitForMainQueue];
+
+  // Then
+  XCTAssertEqual(self.manager.enqueuedMessageCount, 1U);
+  XCTAssertEqual(self.manager.coalescedMessageCount, 4U);
+  XCTAssertEqual(self.manager.droppedMessageCount, 0U);
+  XCTAssertEqual(completionCount, 4);
+  XCTAssertTrue([self.manager hasMessagesShowingOrQueued]);
+}
+
+- (void)testMessagesWithDifferentTextAreNotCoalesced {
+  // Given
+  self.manager.coalescesDuplicateMessages = YES;
+
+  // When
+  [self.manager showMessage:[MDCSnackbarMessage messageWithText:@"You are offline"]];
+  [self.manager showMessage:[MDCSnackbarMessage messageWithText:@"You are online"]];
+  [self waitForMainQueue];
+
+  // Then
+  XCTAssertEqual(self.manager.enqueuedMessageCount, 2U);
+  XCTAssertEqual(self.manager.coalescedMessageCount, 0U);
+}
+
+- (void)testDuplicateMessagesAreNotCoalescedByDefault {
+  // When
+  for (NSInteger i = 0; i < 5; i++) {
+    [self.manager showMessage:[MDCSnackbarMessage messageWithText:@"You are offline"]];
+  }
+  [self waitForMainQueue];
+
+  // Then
+  XCTAssertEqual(self.manager.enqueuedMessageCount, 5U);
+  XCTAssertEqual(self.manager.coalescedMessageCount, 0U);
+}
+
+- (void)testMessagesOverRateLimitAreDropped {
+  // Given
+  self.manager.messageRateLimit = 2;
+  self.manager.messageRateLimitInterval = 60;
+  __block NSInteger completionCount = 0;
+
+  // When
+  for (NSInteger i = 0; i < 5; i++) {
+    MDCSnackbarMessage *message =
+        [MDCSnackbarMessage messageWithText:[NSString stringWithFormat:@"Message %ld", (long)i]];
+    message.category = [NSString stringWithFormat:@"category %ld", (long)i];
+    message.completionHandler = ^(__unused BOOL userInitiated) {
+      completionCount += 1;
+    };
+    [self.manager showMessage:message];
+  }
+  [self waitForMainQueue];
+  // Completion handlers are dispatched by the work above, so wait for them too.
+  [self waitForMainQueue];
+
+  // Then
+  XCTAssertEqual(self.manager.enqueuedMessageCount, 2U);
+  XCTAssertEqual(self.manager.droppedMessageCount, 3U);
+  XCTAssertEqual(completionCount, 3);
+}
+
+- (void)testResetMessageCounters {
+  // Given
+  [self.manager showMessage:[MDCSnackbarMessage messageWithText:@"You are offline"]];
+  [self waitForMainQueue];
+
+  // When
+  [self.manager resetMessageCounters];
+
+  // Then
+  XCTAssertEqual(self.manager.enqueuedMessageCount, 0U);
+  XCTAssertEqual(self.manager.coalescedMessageCount, 0U);
+  XCTAssertEqual(self.manager.droppedMessageCount, 0U);
+}
+
+@end
@@ -810,6 +810,14 @@ static void *kItemPropertyContext = &kItemPropertyContext;
   /// effect, this will be set to nil.
   NSDictionary *_correctedAttributesForIndexPath;
 
+  /// The RTL-corrected layout attributes sorted by the minimum x of their frames, for binary
+  /// searching in layoutAttributesForElementsInRect:. Nil when no RTL correction is in effect.
+  NSArray<UICollectionViewLayoutAttributes *> *_correctedAttributesSortedByMinX;
+
+  /// The widest frame in _correctedAttributesSortedByMinX, which bounds how far left of a rect an
+  /// intersecting item can start.
+  CGFloat _correctedAttributesMaximumWidth;
+
   /// Controls the use of a padded collection view content size.
   BOOL _isPaddingCollectionViewContentSize;
 
@@ -827,6 +835,7 @@ static void *kItemPropertyContext = &kItemPropertyContext;
   // Build a new map of adjusted attributes if needed.
   if (shouldRelayoutAttributesForRTL || shouldPadContentSizeForRTL) {
     NSMutableDictionary *newAttributes = [NSMutableDictionary dictionary];
+    NSMutableArray<UICollectionViewLayoutAttributes *> *orderedAttributes = [NSMutableArray array];
     const NSInteger sectionCount = self.collectionView.numberOfSections;
     for (NSInteger sectionIndex = 0; sectionIndex < sectionCount; sectionIndex++) {
       const NSInteger itemCount = [self.collectionView numberOfItemsInSection:sectionIndex];
@@ -849,12 +858,16 @@ static void *kItemPropertyContext = &kItemPropertyContext;
         }
 
         newAttributes[indexPath] = attributes;
+        [orderedAttributes addObject:attributes];
       }
     }
     _correctedAttributesForIndexPath = newAttributes;
+    [self updateCorrectedAttributesSortedByMinXWithAttributes:orderedAttributes];
   } else {
     // Clear out the map to indicate that no corrections are in effect.
     _correctedAttributesForIndexPath = nil;
+    _correctedAttributesSortedByMinX = nil;
+    _correctedAttributesMaximumWidth = 0;
   }
 
   // Apply global content size padding.
@@ -877,13 +890,38 @@ static void *kItemPropertyContext = &kItemPropertyContext;
 }
 
 - (nullable NSArray *)layoutAttributesForElementsInRect:(CGRect)rect {
-  if (_correctedAttributesForIndexPath) {
-    NSPredicate *predicate =
-        [NSPredicate predicateWithBlock:^BOOL(UICollectionViewLayoutAttributes *layoutAttributes,
-                                              __unused NSDictionary *__nullable bindings) {
-          return CGRectIntersectsRect(layoutAttributes.frame, rect);
-        }];
-    return [_correctedAttributesForIndexPath.allValues filteredArrayUsingPredicate:predicate];
+  if (_correctedAttributesSortedByMinX) {
+    NSArray<UICollectionViewLayoutAttributes *> *sortedAttributes =
+        _correctedAttributesSortedByMinX;
+    const NSUInteger count = sortedAttributes.count;
+
+    // Binary search for the first item that starts far enough right to possibly intersect rect.
+    const CGFloat searchMinX = CGRectGetMinX(rect) - _correctedAttributesMaximumWidth;
+    NSUInteger low = 0;
+    NSUInteger high = count;
+    while (low < high) {
+      NSUInteger mid = low + (high - low) / 2;
+      if (CGRectGetMinX(sortedAttributes[mid].frame) < searchMinX) {
+        low = mid + 1;
+      } else {
+        high = mid;
+      }
+    }
+
+    // Items are sorted by their minimum x, so stop at the first one starting right of rect.
+    NSMutableArray<UICollectionViewLayoutAttributes *> *attributesInRect = [NSMutableArray array];
+    const CGFloat rectMaxX = CGRectGetMaxX(rect);
+    for (NSUInteger i = low; i < count; ++i) {
+      UICollectionViewLayoutAttributes *attributes = sortedAttributes[i];
+      CGRect frame = attributes.frame;
+      if (CGRectGetMinX(frame) > rectMaxX) {
+        break;
+      }
+      if (CGRectIntersectsRect(frame, rect)) {
+        [attributesInRect addObject:attributes];
+      }
+    }
+    return attributesInRect;
   }
 
   // No RTL correction needed.
@@ -907,6 +945,46 @@ static void *kItemPropertyContext = &kItemPropertyContext;
 
 #pragma mark - Private
 
+/// Stores @c attributes, given in index path order, sorted by the minimum x of their frames.
+/// Item bar layouts are a single row, so the corrected attributes are nearly always already in
+/// descending (flipped) or ascending (padded only) order. Detecting that takes one pass, so
+/// relayouts for bounds changes do not need to sort.
+- (void)updateCorrectedAttributesSortedByMinXWithAttributes:
+    (NSArray<UICollectionViewLayoutAttributes *> *)attributes {
+  BOOL isAscending = YES;
+  BOOL isDescending = YES;
+  CGFloat maximumWidth = 0;
+  CGFloat previousMinX = -CGFLOAT_MAX;
+  CGFloat previousMinXDescending = CGFLOAT_MAX;
+  for (UICollectionViewLayoutAttributes *itemAttributes in attributes) {
+    CGRect frame = itemAttributes.frame;
+    CGFloat minX = CGRectGetMinX(frame);
+    isAscending = isAscending && minX >= previousMinX;
+    isDescending = isDescending && minX <= previousMinXDescending;
+    previousMinX = minX;
+    previousMinXDescending = minX;
+    maximumWidth = MAX(maximumWidth, CGRectGetWidth(frame));
+  }
+
+  if (isAscending) {
+    _correctedAttributesSortedByMinX = [attributes copy];
+  } else if (isDescending) {
+    _correctedAttributesSortedByMinX = attributes.reverseObjectEnumerator.allObjects;
+  } else {
+    _correctedAttributesSortedByMinX = [attributes
+        sortedArrayUsingComparator:^NSComparisonResult(UICollectionViewLayoutAttributes *first,
+                                                       UICollectionViewLayoutAttributes *second) {
+          CGFloat firstMinX = CGRectGetMinX(first.frame);
+          CGFloat secondMinX = CGRectGetMinX(second.frame);
+          if (firstMinX < secondMinX) {
+            return NSOrderedAscending;
+          }
+          return firstMinX > secondMinX ? NSOrderedDescending : NSOrderedSame;
+        }];
+  }
+  _correctedAttributesMaximumWidth = maximumWidth;
+}
+
 /// Computes RTL-flipped attributes given superclass-calculated attributes.
 - (UICollectionViewLayoutAttributes *)flippedAttributesFromAttributes:
     (UICollectionViewLayoutAttributes *)attributes {
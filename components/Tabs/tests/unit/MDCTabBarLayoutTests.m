@@ -151,4 +151,37 @@ static NSArray<UICollectionViewCell *> *SortedCellsFromCollectionView(
   }
 }
 
+// Tests that the RTL-corrected layout returns exactly the items intersecting a queried rect.
+- (void)testRightToLeftLayoutAttributesInRectMatchIntersectingItems {
+  if (@available(iOS 9.0, *)) {
+    // Given
+    UICollectionView *collectionView = ExtractCollectionViewFromTabBar(_tabBar);
+    UICollectionViewLayout *layout = collectionView.collectionViewLayout;
+    _tabBar.mdf_semanticContentAttribute = UISemanticContentAttributeForceRightToLeft;
+    [_tabBar setNeedsLayout];
+    [_tabBar layoutIfNeeded];
+    UICollectionViewLayoutAttributes *firstAttributes =
+        [layout layoutAttributesForItemAtIndexPath:[NSIndexPath indexPathForItem:0 inSection:0]];
+    UICollectionViewLayoutAttributes *secondAttributes =
+        [layout layoutAttributesForItemAtIndexPath:[NSIndexPath indexPathForItem:1 inSection:0]];
+
+    // When
+    CGRect firstItemRect = CGRectInset(firstAttributes.frame, 1, 1);
+    NSArray<UICollectionViewLayoutAttributes *> *firstItemRectAttributes =
+        [layout layoutAttributesForElementsInRect:firstItemRect];
+    CGRect bothItemsRect = CGRectUnion(firstAttributes.frame, secondAttributes.frame);
+    NSArray<UICollectionViewLayoutAttributes *> *bothItemsRectAttributes =
+        [layout layoutAttributesForElementsInRect:bothItemsRect];
+    CGRect emptyRect = CGRectOffset(bothItemsRect, -CGRectGetMaxX(bothItemsRect) - 100, 0);
+    NSArray<UICollectionViewLayoutAttributes *> *emptyRectAttributes =
+        [layout layoutAttributesForElementsInRect:emptyRect];
+
+    // Then
+    XCTAssertEqual(firstItemRectAttributes.count, 1ul);
+    XCTAssertEqual(firstItemRectAttributes.firstObject.indexPath.item, 0);
+    XCTAssertEqual(bothItemsRectAttributes.count, 2ul);
+    XCTAssertEqual(emptyRectAttributes.count, 0ul);
+  }
+}
+
 @end
@@ -15,6 +15,7 @@
 #import "MDCTextInputControllerLegacyDefault.h"
 
 #import "MDCMultilineTextField.h"
+#import "MDCTextInputGlyphCache.h"
 #import "MDCTextInputUnderlineView.h"
 #import "private/MDCTextInputArt.h"
 
@@ -58,8 +59,7 @@ static CGFloat _underlineHeightNormalLegacyDefault =
 }
 
 - (void)setupClearButton {
-  UIImage *image = [self
-      drawnClearButtonImage:[UIColor colorWithWhite:0 alpha:[MDCTypography captionFontOpacity]]];
+  UIImage *image = [self drawnClearButtonImage];
   [self.textInput.clearButton setImage:image forState:UIControlStateNormal];
 }
 
@@ -71,22 +71,15 @@ static CGFloat _underlineHeightNormalLegacyDefault =
 
 #pragma mark - Clear Button Customization
 
-- (UIImage *)drawnClearButtonImage:(UIColor *)color {
-  CGSize clearButtonSize =
-      CGSizeMake(MDCTextInputControllerLegacyDefaultClearButtonImageSquareWidthHeight,
-                 MDCTextInputControllerLegacyDefaultClearButtonImageSquareWidthHeight);
-
+- (UIImage *)drawnClearButtonImage {
+  // The legacy glyph is drawn inside a frame measured in pixels rather than points.
   CGFloat scale = [UIScreen mainScreen].scale;
-  CGRect bounds = CGRectMake(0, 0, clearButtonSize.width * scale, clearButtonSize.height * scale);
-  UIGraphicsBeginImageContextWithOptions(bounds.size, false, scale);
-  [color setFill];
-
-  [MDCPathForClearButtonLegacyImageFrame(bounds) fill];
-  UIImage *image = UIGraphicsGetImageFromCurrentImageContext();
-  UIGraphicsEndImageContext();
-
-  image = [image imageWithRenderingMode:UIImageRenderingModeAlwaysTemplate];
-  return image;
+  CGFloat widthHeight =
+      MDCTextInputControllerLegacyDefaultClearButtonImageSquareWidthHeight * scale;
+  CGSize clearButtonSize = CGSizeMake(widthHeight, widthHeight);
+  return [[MDCTextInputGlyphCache sharedCache] imageForGlyph:MDCTextInputGlyphClearLegacy
+                                                        size:clearButtonSize
+                                                       scale:scale];
 }
 
 #pragma mark - Properties Implementation
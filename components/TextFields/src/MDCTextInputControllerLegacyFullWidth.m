@@ -19,6 +19,7 @@
 #import "MDCTextField.h"
 #import "MDCTextInput.h"
 #import "MDCTextInputCharacterCounter.h"
+#import "MDCTextInputGlyphCache.h"
 #import "MDCTextInputUnderlineView.h"
 #import "private/MDCTextInputArt.h"
 
@@ -44,29 +45,21 @@ static const CGFloat MDCTextInputControllerLegacyFullWidthClearButtonImageSquare
 }
 
 - (void)setupClearButton {
-  UIImage *image = [self
-      drawnClearButtonImage:[UIColor colorWithWhite:0 alpha:[MDCTypography captionFontOpacity]]];
+  UIImage *image = [self drawnClearButtonImage];
   [self.textInput.clearButton setImage:image forState:UIControlStateNormal];
 }
 
 #pragma mark - Clear Button Customization
 
-- (UIImage *)drawnClearButtonImage:(UIColor *)color {
-  CGSize clearButtonSize =
-      CGSizeMake(MDCTextInputControllerLegacyFullWidthClearButtonImageSquareWidthHeight,
-                 MDCTextInputControllerLegacyFullWidthClearButtonImageSquareWidthHeight);
-
+- (UIImage *)drawnClearButtonImage {
+  // The legacy glyph is drawn inside a frame measured in pixels rather than points.
   CGFloat scale = [UIScreen mainScreen].scale;
-  CGRect bounds = CGRectMake(0, 0, clearButtonSize.width * scale, clearButtonSize.height * scale);
-  UIGraphicsBeginImageContextWithOptions(bounds.size, false, scale);
-  [color setFill];
-
-  [MDCPathForClearButtonLegacyImageFrame(bounds) fill];
-  UIImage *image = UIGraphicsGetImageFromCurrentImageContext();
-  UIGraphicsEndImageContext();
-
-  image = [image imageWithRenderingMode:UIImageRenderingModeAlwaysTemplate];
-  return image;
+  CGFloat widthHeight =
+      MDCTextInputControllerLegacyFullWidthClearButtonImageSquareWidthHeight * scale;
+  CGSize clearButtonSize = CGSizeMake(widthHeight, widthHeight);
+  return [[MDCTextInputGlyphCache sharedCache] imageForGlyph:MDCTextInputGlyphClearLegacy
+                                                        size:clearButtonSize
+                                                       scale:scale];
 }
 
 @end
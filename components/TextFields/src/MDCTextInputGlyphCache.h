@@ -0,0 +1,71 @@
+// Copyright 2026-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <UIKit/UIKit.h>
+
+/**
+ The glyphs that MDCTextInputGlyphCache can render.
+ */
+typedef NS_ENUM(NSInteger, MDCTextInputGlyph) {
+  /** The clear button glyph used by MDCTextField, MDCMultilineTextField and MDCChipField. */
+  MDCTextInputGlyphClear = 0,
+
+  /** The clear button glyph used by the legacy text input controllers. */
+  MDCTextInputGlyphClearLegacy = 1,
+};
+
+/**
+ A process-wide cache of rendered glyph images, so that every text field and chip field showing the
+ same glyph at the same size shares one rasterized image.
+
+ Images are template images keyed by glyph, size and scale; color them with the tint color of the
+ view displaying them.
+
+ MDCTextInputGlyphCache is safe to use from any thread.
+ */
+@interface MDCTextInputGlyphCache : NSObject
+
+/** The cache used by MDC's text fields and chip fields. */
++ (nonnull instancetype)sharedCache;
+
+/**
+ Returns the template image of @c glyph at the given size and scale, rendering it on first use.
+
+ @param glyph The glyph to render.
+ @param size The size of the image in points. It is rounded to whole pixels at @c scale.
+ @param scale The scale of the image. Pass 0 to use the scale of the main screen.
+ */
+- (nonnull UIImage *)imageForGlyph:(MDCTextInputGlyph)glyph size:(CGSize)size scale:(CGFloat)scale;
+
+/**
+ Renders the image for @c glyph at the given size and scale on a background queue, so that the
+ first text field needing it does not have to. Intended to be called at app launch.
+
+ @param scale The scale of the image. Pass 0 to use the scale of the main screen.
+ */
+- (void)prewarmImageForGlyph:(MDCTextInputGlyph)glyph size:(CGSize)size scale:(CGFloat)scale;
+
+/**
+ Prewarms the clear button image shown by MDCTextField and MDCMultilineTextField at the scale of
+ the main screen.
+ */
+- (void)prewarmDefaultImages;
+
+/** Removes every image from the cache. Does not reset @c renderCount. */
+- (void)removeAllImages;
+
+/** The number of images rendered so far. Intended for tests. */
+@property(nonatomic, readonly) NSUInteger renderCount;
+
+@end
@@ -0,0 +1,167 @@
+// Copyright 2026-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "MDCTextInputGlyphCache.h"
+
+#import "private/MDCTextInputArt.h"
+
+#import "MaterialTypography.h"
+
+#include <math.h>
+
+static const NSUInteger kGlyphImageCountLimit = 32;
+
+/** The size of the clear button image of MDCTextField and MDCMultilineTextField. */
+static const CGFloat kDefaultClearButtonImageSquareWidthHeight = 24;
+
+/** Everything that affects a rendered image. The size is in pixels, the scale in hundredths. */
+typedef struct {
+  MDCTextInputGlyph glyph;
+  int32_t pixelWidth;
+  int32_t pixelHeight;
+  int32_t scale;
+} MDCTextInputGlyphCacheKeyValue;
+
+/** Identifies a cached glyph image. */
+@interface MDCTextInputGlyphCacheKey : NSObject {
+ @public
+  MDCTextInputGlyphCacheKeyValue _value;
+}
+@end
+
+@implementation MDCTextInputGlyphCacheKey
+
+- (NSUInteger)hash {
+  NSUInteger hash = (NSUInteger)_value.glyph;
+  hash = hash * 31 + (NSUInteger)_value.pixelWidth;
+  hash = hash * 31 + (NSUInteger)_value.pixelHeight;
+  return hash * 31 + (NSUInteger)_value.scale;
+}
+
+- (BOOL)isEqual:(id)object {
+  if (self == object) {
+    return YES;
+  }
+  if (![object isKindOfClass:[MDCTextInputGlyphCacheKey class]]) {
+    return NO;
+  }
+  MDCTextInputGlyphCacheKeyValue other = ((MDCTextInputGlyphCacheKey *)object)->_value;
+  return _value.glyph == other.glyph && _value.pixelWidth == other.pixelWidth &&
+         _value.pixelHeight == other.pixelHeight && _value.scale == other.scale;
+}
+
+@end
+
+@implementation MDCTextInputGlyphCache {
+  NSCache<MDCTextInputGlyphCacheKey *, UIImage *> *_images;
+}
+
+@synthesize renderCount = _renderCount;
+
++ (instancetype)sharedCache {
+  static MDCTextInputGlyphCache *sharedCache;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    sharedCache = [[MDCTextInputGlyphCache alloc] init];
+  });
+  return sharedCache;
+}
+
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    _images = [[NSCache alloc] init];
+    _images.countLimit = kGlyphImageCountLimit;
+  }
+  return self;
+}
+
+- (UIImage *)imageForGlyph:(MDCTextInputGlyph)glyph size:(CGSize)size scale:(CGFloat)scale {
+  if (scale <= 0) {
+    scale = [UIScreen mainScreen].scale;
+  }
+  // Sizes that round to the same number of pixels render the same image, so render the rounded
+  // size to make the image independent of which of them was requested first.
+  MDCTextInputGlyphCacheKey *key = [[MDCTextInputGlyphCacheKey alloc] init];
+  key->_value.glyph = glyph;
+  key->_value.pixelWidth = (int32_t)MAX(lround(size.width * scale), 0);
+  key->_value.pixelHeight = (int32_t)MAX(lround(size.height * scale), 0);
+  key->_value.scale = (int32_t)lround(scale * 100);
+  CGSize pixelAlignedSize =
+      CGSizeMake(key->_value.pixelWidth / scale, key->_value.pixelHeight / scale);
+  // Render while holding the lock so that concurrent requests, such as a prewarm racing the first
+  // text field, rasterize each image only once.
+  @synchronized(self) {
+    UIImage *image = [_images objectForKey:key];
+    if (!image) {
+      image = [self renderImageForGlyph:glyph size:pixelAlignedSize scale:scale];
+      [_images setObject:image forKey:key];
+    }
+    return image;
+  }
+}
+
+- (void)prewarmImageForGlyph:(MDCTextInputGlyph)glyph size:(CGSize)size scale:(CGFloat)scale {
+  if (scale <= 0) {
+    scale = [UIScreen mainScreen].scale;
+  }
+  dispatch_async(dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^{
+    [self imageForGlyph:glyph size:size scale:scale];
+  });
+}
+
+- (void)prewarmDefaultImages {
+  [self prewarmImageForGlyph:MDCTextInputGlyphClear
+                        size:CGSizeMake(kDefaultClearButtonImageSquareWidthHeight,
+                                        kDefaultClearButtonImageSquareWidthHeight)
+                       scale:0];
+}
+
+- (void)removeAllImages {
+  @synchronized(self) {
+    [_images removeAllObjects];
+  }
+}
+
+- (NSUInteger)renderCount {
+  @synchronized(self) {
+    return _renderCount;
+  }
+}
+
+#pragma mark - Private
+
+- (UIImage *)renderImageForGlyph:(MDCTextInputGlyph)glyph size:(CGSize)size scale:(CGFloat)scale {
+  _renderCount += 1;
+
+  CGRect bounds = CGRectMake(0, 0, size.width, size.height);
+  UIGraphicsBeginImageContextWithOptions(bounds.size, false, scale);
+  switch (glyph) {
+    case MDCTextInputGlyphClearLegacy:
+      [[UIColor colorWithWhite:0 alpha:[MDCTypography captionFontOpacity]] setFill];
+      [MDCPathForClearButtonLegacyImageFrame(bounds) fill];
+      break;
+    case MDCTextInputGlyphClear:
+    default:
+      [UIColor.grayColor setFill];
+      [MDCPathForClearButtonImageFrame(bounds) fill];
+      break;
+  }
+  UIImage *image = UIGraphicsGetImageFromCurrentImageContext();
+  UIGraphicsEndImageContext();
+
+  return [image imageWithRenderingMode:UIImageRenderingModeAlwaysTemplate];
+}
+
+@end
@@ -27,4 +27,5 @@
 #import "MDCTextInputControllerOutlined.h"
 #import "MDCTextInputControllerOutlinedTextArea.h"
 #import "MDCTextInputControllerUnderline.h"
+#import "MDCTextInputGlyphCache.h"
 #import "MDCTextInputUnderlineView.h"
@@ -22,6 +22,7 @@
 #import "MDCTextInputArt.h"
 #import "MDCTextInputBorderView.h"
 #import "MDCTextInputCommonFundament.h"
+#import "MDCTextInputGlyphCache.h"
 #import "MDCTextInputUnderlineView.h"
 
 #import "MaterialAnimationTiming.h"
@@ -590,17 +591,9 @@ static inline UIColor *MDCTextInputUnderlineColor() {
 - (UIImage *)drawnClearButtonImage {
   CGSize clearButtonSize = CGSizeMake(MDCTextInputClearButtonImageSquareWidthHeight,
                                       MDCTextInputClearButtonImageSquareWidthHeight);
-
-  CGRect bounds = CGRectMake(0, 0, clearButtonSize.width, clearButtonSize.height);
-  UIGraphicsBeginImageContextWithOptions(bounds.size, false, 0);
-  [UIColor.grayColor setFill];
-
-  [MDCPathForClearButtonImageFrame(bounds) fill];
-  UIImage *image = UIGraphicsGetImageFromCurrentImageContext();
-  UIGraphicsEndImageContext();
-
-  image = [image imageWithRenderingMode:UIImageRenderingModeAlwaysTemplate];
-  return image;
+  return [[MDCTextInputGlyphCache sharedCache] imageForGlyph:MDCTextInputGlyphClear
+                                                        size:clearButtonSize
+                                                       scale:0];
 }
 
 - (void)clearButtonDidTouch {
@@ -0,0 +1,160 @@
+// Copyright 2026-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "MaterialTextFields.h"
+
+static const NSInteger kTextFieldCount = 40;
+
+@interface MDCTextInputGlyphCacheTests : XCTestCase
+@end
+
+@implementation MDCTextInputGlyphCacheTests
+
+- (void)testImageIsRenderedOncePerKey {
+  // Given
+  MDCTextInputGlyphCache *cache = [[MDCTextInputGlyphCache alloc] init];
+  CGSize size = CGSizeMake(24, 24);
+
+  // When
+  UIImage *firstImage = [cache imageForGlyph:MDCTextInputGlyphClear size:size scale:2];
+  UIImage *secondImage = [cache imageForGlyph:MDCTextInputGlyphClear size:size scale:2];
+
+  // Then
+  XCTAssertEqual(firstImage, secondImage);
+  XCTAssertEqual(cache.renderCount, 1U);
+  XCTAssertEqual(firstImage.renderingMode, UIImageRenderingModeAlwaysTemplate);
+  XCTAssertEqual(firstImage.scale, 2);
+  XCTAssertTrue(CGSizeEqualToSize(firstImage.size, size));
+}
+
+- (void)testGlyphSizeAndScaleAreSeparateKeys {
+  // Given
+  MDCTextInputGlyphCache *cache = [[MDCTextInputGlyphCache alloc] init];
+  CGSize size = CGSizeMake(24, 24);
+
+  // When
+  [cache imageForGlyph:MDCTextInputGlyphClear size:size scale:2];
+  [cache imageForGlyph:MDCTextInputGlyphClearLegacy size:size scale:2];
+  [cache imageForGlyph:MDCTextInputGlyphClear size:CGSizeMake(18, 18) scale:2];
+  [cache imageForGlyph:MDCTextInputGlyphClear size:size scale:3];
+
+  // Then
+  XCTAssertEqual(cache.renderCount, 4U);
+}
+
+- (void)testSubPixelSizesAreSeparateKeys {
+  // Given
+  MDCTextInputGlyphCache *cache = [[MDCTextInputGlyphCache alloc] init];
+
+  // When
+  UIImage *wholeImage = [cache imageForGlyph:MDCTextInputGlyphClear
+                                        size:CGSizeMake(24, 24)
+                                       scale:2];
+  UIImage *halfImage = [cache imageForGlyph:MDCTextInputGlyphClear
+                                       size:CGSizeMake((CGFloat)24.5, 24)
+                                      scale:2];
+
+  // Then
+  XCTAssertNotEqual(wholeImage, halfImage);
+  XCTAssertEqual(cache.renderCount, 2U);
+  XCTAssertTrue(CGSizeEqualToSize(halfImage.size, CGSizeMake((CGFloat)24.5, 24)));
+}
+
+- (void)testSizesRoundingToTheSamePixelsShareOneImage {
+  // Given
+  MDCTextInputGlyphCache *cache = [[MDCTextInputGlyphCache alloc] init];
+
+  // When
+  UIImage *firstImage = [cache imageForGlyph:MDCTextInputGlyphClear
+                                        size:CGSizeMake((CGFloat)24.1, 24)
+                                       scale:2];
+  UIImage *secondImage = [cache imageForGlyph:MDCTextInputGlyphClear
+                                         size:CGSizeMake((CGFloat)23.9, 24)
+                                        scale:2];
+
+  // Then
+  XCTAssertEqual(firstImage, secondImage);
+  XCTAssertEqual(cache.renderCount, 1U);
+  XCTAssertTrue(CGSizeEqualToSize(firstImage.size, CGSizeMake(24, 24)));
+}
+
+- (void)testZeroScaleUsesMainScreenScale {
+  // Given
+  MDCTextInputGlyphCache *cache = [[MDCTextInputGlyphCache alloc] init];
+  CGSize size = CGSizeMake(24, 24);
+
+  // When
+  UIImage *image = [cache imageForGlyph:MDCTextInputGlyphClear size:size scale:0];
+  [cache imageForGlyph:MDCTextInputGlyphClear size:size scale:[UIScreen mainScreen].scale];
+
+  // Then
+  XCTAssertEqual(image.scale, [UIScreen mainScreen].scale);
+  XCTAssertEqual(cache.renderCount, 1U);
+}
+
+- (void)testPrewarmedImageIsNotRenderedAgain {
+  // Given
+  MDCTextInputGlyphCache *cache = [[MDCTextInputGlyphCache alloc] init];
+  CGSize size = CGSizeMake(24, 24);
+
+  // When
+  [cache prewarmImageForGlyph:MDCTextInputGlyphClear size:size scale:2];
+  [cache imageForGlyph:MDCTextInputGlyphClear size:size scale:2];
+
+  // Then
+  XCTAssertEqual(cache.renderCount, 1U);
+}
+
+- (void)testRemoveAllImagesRendersAgain {
+  // Given
+  MDCTextInputGlyphCache *cache = [[MDCTextInputGlyphCache alloc] init];
+  CGSize size = CGSizeMake(24, 24);
+  [cache imageForGlyph:MDCTextInputGlyphClear size:size scale:2];
+
+  // When
+  [cache removeAllImages];
+  [cache imageForGlyph:MDCTextInputGlyphClear size:size scale:2];
+
+  // Then
+  XCTAssertEqual(cache.renderCount, 2U);
+}
+
+- (void)testTextFieldsShareOneClearButtonImage {
+  // Given
+  MDCTextInputGlyphCache *sharedCache = [MDCTextInputGlyphCache sharedCache];
+  [sharedCache removeAllImages];
+  NSUInteger initialRenderCount = sharedCache.renderCount;
+  NSMutableArray<MDCTextField *> *textFields = [NSMutableArray array];
+
+  // When
+  for (NSInteger i = 0; i < kTextFieldCount; ++i) {
+    MDCTextField *textField = [[MDCTextField alloc] initWithFrame:CGRectMake(0, 0, 200, 50)];
+    textField.clearButtonMode = UITextFieldViewModeAlways;
+    textField.text = @"Text";
+    [textField layoutIfNeeded];
+    [textFields addObject:textField];
+  }
+
+  // Then
+  XCTAssertEqual(sharedCache.renderCount - initialRenderCount, 1U);
+  UIImage *firstImage = [textFields.firstObject.clearButton imageForState:UIControlStateNormal];
+  XCTAssertNotNil(firstImage);
+  for (MDCTextField *textField in textFields) {
+    XCTAssertEqual([textField.clearButton imageForState:UIControlStateNormal], firstImage);
+  }
+}
+
+@end
@@ -17,8 +17,11 @@
 #import <objc/runtime.h>
 
 #import "UIFont+MaterialScalable.h"
+#import "private/MDCFontScaler+Private.h"
 #import "private/MDCFontTraits.h"
+#import "private/MDCScaledFontCache.h"
 #import "private/MDCTypographyUtilities.h"
+#import "private/UIFont+MaterialScalablePrivate.h"
 
 MDCTextStyle const MDCTextStyleHeadline1 = @"MDC.TextStyle.Headline1";
 MDCTextStyle const MDCTextStyleHeadline2 = @"MDC.TextStyle.Headline2";
@@ -34,235 +37,164 @@ MDCTextStyle const MDCTextStyleButton = @"MDC.TextStyle.Button";
 MDCTextStyle const MDCTextStyleCaption = @"MDC.TextStyle.Caption";
 MDCTextStyle const MDCTextStyleOverline = @"MDC.TextStyle.Overline";
 
+// The text styles with a scaling curve, in the order of kScalingCurveSizes.
+typedef NS_ENUM(NSInteger, MDCFontScalerStyle) {
+  MDCFontScalerStyleHeadline1,
+  MDCFontScalerStyleHeadline2,
+  MDCFontScalerStyleHeadline3,
+  MDCFontScalerStyleHeadline4,
+  MDCFontScalerStyleHeadline5,
+  MDCFontScalerStyleHeadline6,
+  MDCFontScalerStyleSubtitle1,
+  MDCFontScalerStyleSubtitle2,
+  MDCFontScalerStyleBody1,
+  MDCFontScalerStyleBody2,
+  MDCFontScalerStyleButton,
+  MDCFontScalerStyleCaption,
+  MDCFontScalerStyleOverline,
+  MDCFontScalerStyleCount,
+};
+
+// Font sizes per text style, indexed by MDCContentSizeCategoryOrdinal().
+//
+// NOTE: All scaling curves MUST include a full set of values for ALL UIContentSizeCategory values.
+// These values must not decrease as the category size increases. To put it another way, the value
+// for UIContentSizeCategoryLarge must not be smaller than the value for
+// UIContentSizeCategoryMedium.
+static const CGFloat kScalingCurveSizes[MDCFontScalerStyleCount][MDCContentSizeCategoryCount] = {
+    [MDCFontScalerStyleHeadline1] = {84, 88, 92, 96, 100, 104, 108, 108, 108, 108, 108, 108},
+    [MDCFontScalerStyleHeadline2] = {54, 56, 58, 60, 62, 64, 66, 66, 66, 66, 66, 66},
+    [MDCFontScalerStyleHeadline3] = {42, 44, 46, 48, 50, 52, 54, 54, 54, 54, 54, 54},
+    [MDCFontScalerStyleHeadline4] = {28, 30, 32, 34, 36, 38, 40, 42, 42, 42, 42, 42},
+    [MDCFontScalerStyleHeadline5] = {21, 22, 23, 24, 26, 28, 30, 32, 32, 32, 32, 32},
+    [MDCFontScalerStyleHeadline6] = {17, 18, 19, 20, 22, 24, 26, 28, 28, 28, 28, 28},
+    [MDCFontScalerStyleSubtitle1] = {13, 14, 15, 16, 18, 20, 22, 25, 30, 37, 44, 52},
+    [MDCFontScalerStyleSubtitle2] = {11, 12, 13, 14, 16, 18, 20, 22, 25, 30, 36, 42},
+    [MDCFontScalerStyleBody1] = {13, 14, 15, 16, 18, 20, 22, 26, 30, 34, 38, 42},
+    [MDCFontScalerStyleBody2] = {11, 12, 13, 14, 16, 18, 20, 22, 25, 30, 36, 42},
+    [MDCFontScalerStyleButton] = {11, 12, 13, 14, 16, 18, 20, 22, 24, 26, 28, 30},
+    [MDCFontScalerStyleCaption] = {11, 11, 11, 12, 14, 16, 18, 20, 22, 24, 26, 28},
+    [MDCFontScalerStyleOverline] = {8, 8, 9, 10, 12, 14, 16, 18, 20, 22, 24, 26},
+};
+
+static MDCTextStyle TextStyleForStyle(MDCFontScalerStyle style) {
+  switch (style) {
+    case MDCFontScalerStyleHeadline1:
+      return MDCTextStyleHeadline1;
+    case MDCFontScalerStyleHeadline2:
+      return MDCTextStyleHeadline2;
+    case MDCFontScalerStyleHeadline3:
+      return MDCTextStyleHeadline3;
+    case MDCFontScalerStyleHeadline4:
+      return MDCTextStyleHeadline4;
+    case MDCFontScalerStyleHeadline5:
+      return MDCTextStyleHeadline5;
+    case MDCFontScalerStyleHeadline6:
+      return MDCTextStyleHeadline6;
+    case MDCFontScalerStyleSubtitle1:
+      return MDCTextStyleSubtitle1;
+    case MDCFontScalerStyleSubtitle2:
+      return MDCTextStyleSubtitle2;
+    case MDCFontScalerStyleBody1:
+      return MDCTextStyleBody1;
+    case MDCFontScalerStyleBody2:
+      return MDCTextStyleBody2;
+    case MDCFontScalerStyleButton:
+      return MDCTextStyleButton;
+    case MDCFontScalerStyleCaption:
+      return MDCTextStyleCaption;
+    case MDCFontScalerStyleOverline:
+      return MDCTextStyleOverline;
+    case MDCFontScalerStyleCount:
+      break;
+  }
+  return MDCTextStyleBody1;
+}
+
+// Returns the style for the given text style, falling back to Body1 for unknown text styles.
+static MDCFontScalerStyle StyleForTextStyle(MDCTextStyle textStyle) {
+  for (NSInteger style = 0; style < MDCFontScalerStyleCount; ++style) {
+    if (textStyle == TextStyleForStyle(style)) {
+      return style;
+    }
+  }
+  for (NSInteger style = 0; style < MDCFontScalerStyleCount; ++style) {
+    if ([textStyle isEqualToString:TextStyleForStyle(style)]) {
+      return style;
+    }
+  }
+  return MDCFontScalerStyleBody1;
+}
+
+// The public scaling curve dictionaries are built once per style and shared by every scaler and
+// font, which also lets MDCFontScalerSizesForScalingCurve recognize them by identity.
+static NSArray<MDCScalingCurve> *SharedScalingCurves(void) {
+  static NSArray<MDCScalingCurve> *scalingCurves;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    NSMutableArray<MDCScalingCurve> *curves =
+        [NSMutableArray arrayWithCapacity:MDCFontScalerStyleCount];
+    for (NSInteger style = 0; style < MDCFontScalerStyleCount; ++style) {
+      NSMutableDictionary<UIContentSizeCategory, NSNumber *> *curve =
+          [NSMutableDictionary dictionaryWithCapacity:MDCContentSizeCategoryCount];
+      for (NSInteger ordinal = 0; ordinal < MDCContentSizeCategoryCount; ++ordinal) {
+        curve[MDCContentSizeCategoryForOrdinal(ordinal)] = @(kScalingCurveSizes[style][ordinal]);
+      }
+      [curves addObject:[curve copy]];
+    }
+    scalingCurves = [curves copy];
+  });
+  return scalingCurves;
+}
+
+const CGFloat *MDCFontScalerSizesForScalingCurve(MDCScalingCurve scalingCurve) {
+  if (!scalingCurve) {
+    return NULL;
+  }
+  NSArray<MDCScalingCurve> *scalingCurves = SharedScalingCurves();
+  for (NSInteger style = 0; style < MDCFontScalerStyleCount; ++style) {
+    if (scalingCurve == scalingCurves[style]) {
+      return kScalingCurveSizes[style];
+    }
+  }
+  return NULL;
+}
+
 @implementation MDCFontScaler {
-  NSDictionary<UIContentSizeCategory, NSNumber *> *_scalingCurve;
+  MDCScalingCurve _scalingCurve;
+  const CGFloat *_scalingCurveSizes;
   MDCTextStyle _textStyle;
 }
 
 + (instancetype)scalerForMaterialTextStyle:(MDCTextStyle)textStyle {
-  return [[MDCFontScaler alloc] initForMaterialTextStyle:textStyle];
+  // Subclasses may rely on getting a new scaler from each call, so only share scalers when the
+  // receiver is MDCFontScaler itself.
+  if (self != [MDCFontScaler class]) {
+    return [[MDCFontScaler alloc] initForMaterialTextStyle:textStyle];
+  }
+
+  // Scalers are immutable, so a single instance per style is shared by all callers.
+  static NSArray<MDCFontScaler *> *sharedScalers;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    NSMutableArray<MDCFontScaler *> *scalers =
+        [NSMutableArray arrayWithCapacity:MDCFontScalerStyleCount];
+    for (NSInteger style = 0; style < MDCFontScalerStyleCount; ++style) {
+      [scalers addObject:[[MDCFontScaler alloc] initForMaterialTextStyle:TextStyleForStyle(style)]];
+    }
+    sharedScalers = [scalers copy];
+  });
+  return sharedScalers[StyleForTextStyle(textStyle)];
 }
 
 - (instancetype)initForMaterialTextStyle:(MDCTextStyle)textStyle {
   self = [super init];
   if (self) {
-    _textStyle = [textStyle copy];
-
-    // NOTE: All scaling curves MUST include a full set of values for ALL UIContentSizeCategory
-    // values. This values must not decrease as the category size increases. To put it another
-    // way, the value for UIContentSizeCategoryLarge must not be smaller than the value for
-    // UIContentSizeCategoryMedium.
-    if ([MDCTextStyleHeadline1 isEqualToString:textStyle]) {
-      NSDictionary<UIContentSizeCategory, NSNumber *> *scalingCurve = @{
-        UIContentSizeCategoryExtraSmall : @84,
-        UIContentSizeCategorySmall : @88,
-        UIContentSizeCategoryMedium : @92,
-        UIContentSizeCategoryLarge : @96,
-        UIContentSizeCategoryExtraLarge : @100,
-        UIContentSizeCategoryExtraExtraLarge : @104,
-        UIContentSizeCategoryExtraExtraExtraLarge : @108,
-        UIContentSizeCategoryAccessibilityMedium : @108,
-        UIContentSizeCategoryAccessibilityLarge : @108,
-        UIContentSizeCategoryAccessibilityExtraLarge : @108,
-        UIContentSizeCategoryAccessibilityExtraExtraLarge : @108,
-        UIContentSizeCategoryAccessibilityExtraExtraExtraLarge : @108
-      };
-      _scalingCurve = scalingCurve;
-    } else if ([MDCTextStyleHeadline2 isEqualToString:textStyle]) {
-      NSDictionary<UIContentSizeCategory, NSNumber *> *scalingCurve = @{
-        UIContentSizeCategoryExtraSmall : @54,
-        UIContentSizeCategorySmall : @56,
-        UIContentSizeCategoryMedium : @58,
-        UIContentSizeCategoryLarge : @60,
-        UIContentSizeCategoryExtraLarge : @62,
-        UIContentSizeCategoryExtraExtraLarge : @64,
-        UIContentSizeCategoryExtraExtraExtraLarge : @66,
-        UIContentSizeCategoryAccessibilityMedium : @66,
-        UIContentSizeCategoryAccessibilityLarge : @66,
-        UIContentSizeCategoryAccessibilityExtraLarge : @66,
-        UIContentSizeCategoryAccessibilityExtraExtraLarge : @66,
-        UIContentSizeCategoryAccessibilityExtraExtraExtraLarge : @66
-      };
-      _scalingCurve = scalingCurve;
-    } else if ([MDCTextStyleHeadline3 isEqualToString:textStyle]) {
-      NSDictionary<UIContentSizeCategory, NSNumber *> *scalingCurve = @{
-        UIContentSizeCategoryExtraSmall : @42,
-        UIContentSizeCategorySmall : @44,
-        UIContentSizeCategoryMedium : @46,
-        UIContentSizeCategoryLarge : @48,
-        UIContentSizeCategoryExtraLarge : @50,
-        UIContentSizeCategoryExtraExtraLarge : @52,
-        UIContentSizeCategoryExtraExtraExtraLarge : @54,
-        UIContentSizeCategoryAccessibilityMedium : @54,
-        UIContentSizeCategoryAccessibilityLarge : @54,
-        UIContentSizeCategoryAccessibilityExtraLarge : @54,
-        UIContentSizeCategoryAccessibilityExtraExtraLarge : @54,
-        UIContentSizeCategoryAccessibilityExtraExtraExtraLarge : @54
-      };
-      _scalingCurve = scalingCurve;
-    } else if ([MDCTextStyleHeadline4 isEqualToString:textStyle]) {
-      NSDictionary<UIContentSizeCategory, NSNumber *> *scalingCurve = @{
-        UIContentSizeCategoryExtraSmall : @28,
-        UIContentSizeCategorySmall : @30,
-        UIContentSizeCategoryMedium : @32,
-        UIContentSizeCategoryLarge : @34,
-        UIContentSizeCategoryExtraLarge : @36,
-        UIContentSizeCategoryExtraExtraLarge : @38,
-        UIContentSizeCategoryExtraExtraExtraLarge : @40,
-        UIContentSizeCategoryAccessibilityMedium : @42,
-        UIContentSizeCategoryAccessibilityLarge : @42,
-        UIContentSizeCategoryAccessibilityExtraLarge : @42,
-        UIContentSizeCategoryAccessibilityExtraExtraLarge : @42,
-        UIContentSizeCategoryAccessibilityExtraExtraExtraLarge : @42
-      };
-      _scalingCurve = scalingCurve;
-    } else if ([MDCTextStyleHeadline5 isEqualToString:textStyle]) {
-      NSDictionary<UIContentSizeCategory, NSNumber *> *scalingCurve = @{
-        UIContentSizeCategoryExtraSmall : @21,
-        UIContentSizeCategorySmall : @22,
-        UIContentSizeCategoryMedium : @23,
-        UIContentSizeCategoryLarge : @24,
-        UIContentSizeCategoryExtraLarge : @26,
-        UIContentSizeCategoryExtraExtraLarge : @28,
-        UIContentSizeCategoryExtraExtraExtraLarge : @30,
-        UIContentSizeCategoryAccessibilityMedium : @32,
-        UIContentSizeCategoryAccessibilityLarge : @32,
-        UIContentSizeCategoryAccessibilityExtraLarge : @32,
-        UIContentSizeCategoryAccessibilityExtraExtraLarge : @32,
-        UIContentSizeCategoryAccessibilityExtraExtraExtraLarge : @32
-      };
-      _scalingCurve = scalingCurve;
-    } else if ([MDCTextStyleHeadline6 isEqualToString:textStyle]) {
-      NSDictionary<UIContentSizeCategory, NSNumber *> *scalingCurve = @{
-        UIContentSizeCategoryExtraSmall : @17,
-        UIContentSizeCategorySmall : @18,
-        UIContentSizeCategoryMedium : @19,
-        UIContentSizeCategoryLarge : @20,
-        UIContentSizeCategoryExtraLarge : @22,
-        UIContentSizeCategoryExtraExtraLarge : @24,
-        UIContentSizeCategoryExtraExtraExtraLarge : @26,
-        UIContentSizeCategoryAccessibilityMedium : @28,
-        UIContentSizeCategoryAccessibilityLarge : @28,
-        UIContentSizeCategoryAccessibilityExtraLarge : @28,
-        UIContentSizeCategoryAccessibilityExtraExtraLarge : @28,
-        UIContentSizeCategoryAccessibilityExtraExtraExtraLarge : @28
-      };
-      _scalingCurve = scalingCurve;
-    } else if ([MDCTextStyleSubtitle1 isEqualToString:textStyle]) {
-      NSDictionary<UIContentSizeCategory, NSNumber *> *scalingCurve = @{
-        UIContentSizeCategoryExtraSmall : @13,
-        UIContentSizeCategorySmall : @14,
-        UIContentSizeCategoryMedium : @15,
-        UIContentSizeCategoryLarge : @16,
-        UIContentSizeCategoryExtraLarge : @18,
-        UIContentSizeCategoryExtraExtraLarge : @20,
-        UIContentSizeCategoryExtraExtraExtraLarge : @22,
-        UIContentSizeCategoryAccessibilityMedium : @25,
-        UIContentSizeCategoryAccessibilityLarge : @30,
-        UIContentSizeCategoryAccessibilityExtraLarge : @37,
-        UIContentSizeCategoryAccessibilityExtraExtraLarge : @44,
-        UIContentSizeCategoryAccessibilityExtraExtraExtraLarge : @52
-      };
-      _scalingCurve = scalingCurve;
-    } else if ([MDCTextStyleSubtitle2 isEqualToString:textStyle]) {
-      NSDictionary<UIContentSizeCategory, NSNumber *> *scalingCurve = @{
-        UIContentSizeCategoryExtraSmall : @11,
-        UIContentSizeCategorySmall : @12,
-        UIContentSizeCategoryMedium : @13,
-        UIContentSizeCategoryLarge : @14,
-        UIContentSizeCategoryExtraLarge : @16,
-        UIContentSizeCategoryExtraExtraLarge : @18,
-        UIContentSizeCategoryExtraExtraExtraLarge : @20,
-        UIContentSizeCategoryAccessibilityMedium : @22,
-        UIContentSizeCategoryAccessibilityLarge : @25,
-        UIContentSizeCategoryAccessibilityExtraLarge : @30,
-        UIContentSizeCategoryAccessibilityExtraExtraLarge : @36,
-        UIContentSizeCategoryAccessibilityExtraExtraExtraLarge : @42
-      };
-      _scalingCurve = scalingCurve;
-    } else if ([MDCTextStyleBody2 isEqualToString:textStyle]) {
-      NSDictionary<UIContentSizeCategory, NSNumber *> *scalingCurve = @{
-        UIContentSizeCategoryExtraSmall : @11,
-        UIContentSizeCategorySmall : @12,
-        UIContentSizeCategoryMedium : @13,
-        UIContentSizeCategoryLarge : @14,
-        UIContentSizeCategoryExtraLarge : @16,
-        UIContentSizeCategoryExtraExtraLarge : @18,
-        UIContentSizeCategoryExtraExtraExtraLarge : @20,
-        UIContentSizeCategoryAccessibilityMedium : @22,
-        UIContentSizeCategoryAccessibilityLarge : @25,
-        UIContentSizeCategoryAccessibilityExtraLarge : @30,
-        UIContentSizeCategoryAccessibilityExtraExtraLarge : @36,
-        UIContentSizeCategoryAccessibilityExtraExtraExtraLarge : @42
-      };
-      _scalingCurve = scalingCurve;
-    } else if ([MDCTextStyleButton isEqualToString:textStyle]) {
-      NSDictionary<UIContentSizeCategory, NSNumber *> *scalingCurve = @{
-        UIContentSizeCategoryExtraSmall : @11,
-        UIContentSizeCategorySmall : @12,
-        UIContentSizeCategoryMedium : @13,
-        UIContentSizeCategoryLarge : @14,
-        UIContentSizeCategoryExtraLarge : @16,
-        UIContentSizeCategoryExtraExtraLarge : @18,
-        UIContentSizeCategoryExtraExtraExtraLarge : @20,
-        UIContentSizeCategoryAccessibilityMedium : @22,
-        UIContentSizeCategoryAccessibilityLarge : @24,
-        UIContentSizeCategoryAccessibilityExtraLarge : @26,
-        UIContentSizeCategoryAccessibilityExtraExtraLarge : @28,
-        UIContentSizeCategoryAccessibilityExtraExtraExtraLarge : @30
-      };
-      _scalingCurve = scalingCurve;
-    } else if ([MDCTextStyleCaption isEqualToString:textStyle]) {
-      NSDictionary<UIContentSizeCategory, NSNumber *> *scalingCurve = @{
-        UIContentSizeCategoryExtraSmall : @11,
-        UIContentSizeCategorySmall : @11,
-        UIContentSizeCategoryMedium : @11,
-        UIContentSizeCategoryLarge : @12,
-        UIContentSizeCategoryExtraLarge : @14,
-        UIContentSizeCategoryExtraExtraLarge : @16,
-        UIContentSizeCategoryExtraExtraExtraLarge : @18,
-        UIContentSizeCategoryAccessibilityMedium : @20,
-        UIContentSizeCategoryAccessibilityLarge : @22,
-        UIContentSizeCategoryAccessibilityExtraLarge : @24,
-        UIContentSizeCategoryAccessibilityExtraExtraLarge : @26,
-        UIContentSizeCategoryAccessibilityExtraExtraExtraLarge : @28
-      };
-      _scalingCurve = scalingCurve;
-    } else if ([MDCTextStyleOverline isEqualToString:textStyle]) {
-      NSDictionary<UIContentSizeCategory, NSNumber *> *scalingCurve = @{
-        UIContentSizeCategoryExtraSmall : @8,
-        UIContentSizeCategorySmall : @8,
-        UIContentSizeCategoryMedium : @9,
-        UIContentSizeCategoryLarge : @10,
-        UIContentSizeCategoryExtraLarge : @12,
-        UIContentSizeCategoryExtraExtraLarge : @14,
-        UIContentSizeCategoryExtraExtraExtraLarge : @16,
-        UIContentSizeCategoryAccessibilityMedium : @18,
-        UIContentSizeCategoryAccessibilityLarge : @20,
-        UIContentSizeCategoryAccessibilityExtraLarge : @22,
-        UIContentSizeCategoryAccessibilityExtraExtraLarge : @24,
-        UIContentSizeCategoryAccessibilityExtraExtraExtraLarge : @26
-      };
-      _scalingCurve = scalingCurve;
-    } else {
-      // If nothing matches, return the metrics for MDCTextStyleBody1
-      _textStyle = [MDCTextStyleBody1 copy];
-      NSDictionary<UIContentSizeCategory, NSNumber *> *scalingCurve = @{
-        UIContentSizeCategoryExtraSmall : @13,
-        UIContentSizeCategorySmall : @14,
-        UIContentSizeCategoryMedium : @15,
-        UIContentSizeCategoryLarge : @16,
-        UIContentSizeCategoryExtraLarge : @18,
-        UIContentSizeCategoryExtraExtraLarge : @20,
-        UIContentSizeCategoryExtraExtraExtraLarge : @22,
-        UIContentSizeCategoryAccessibilityMedium : @26,
-        UIContentSizeCategoryAccessibilityLarge : @30,
-        UIContentSizeCategoryAccessibilityExtraLarge : @34,
-        UIContentSizeCategoryAccessibilityExtraExtraLarge : @38,
-        UIContentSizeCategoryAccessibilityExtraExtraExtraLarge : @42
-      };
-      _scalingCurve = scalingCurve;
-    }
+    // If nothing matches, use the metrics for MDCTextStyleBody1.
+    MDCFontScalerStyle style = StyleForTextStyle(textStyle);
+    _textStyle = TextStyleForStyle(style);
+    _scalingCurve = SharedScalingCurves()[style];
+    _scalingCurveSizes = kScalingCurveSizes[style];
   }
 
   return self;
@@ -272,35 +204,31 @@ MDCTextStyle const MDCTextStyleOverline = @"MDC.TextStyle.Overline";
   // If it is available, query the preferredContentSizeCategory.
   UIContentSizeCategory sizeCategory = GetCurrentSizeCategory();
 
-  // We create a new font to ensure we have a complete set of font traits.
-  // They we apply our new scaling curve before returning a scaled font.
-  UIFont *templateFont = [UIFont fontWithDescriptor:font.fontDescriptor size:0.0];
-  templateFont.mdc_scalingCurve = _scalingCurve;
-  UIFont *scaledFont = [templateFont mdc_scaledFontForSizeCategory:sizeCategory];
-
-  return scaledFont;
+  MDCScalingCurve scalingCurve = _scalingCurve;
+  return [[MDCScaledFontCache sharedCache]
+      fontWithDescriptor:font.fontDescriptor
+            scalingCurve:scalingCurve
+            sizeCategory:sizeCategory
+               fontBlock:^UIFont * {
+                 // We create a new font to ensure we have a complete set of font traits.
+                 // They we apply our new scaling curve before returning a scaled font.
+                 UIFont *templateFont = [UIFont fontWithDescriptor:font.fontDescriptor size:0.0];
+                 MDCFontAttachImmutableScalingCurve(templateFont, scalingCurve);
+                 return [templateFont mdc_scaledFontForSizeCategory:sizeCategory];
+               }];
 }
 
 - (CGFloat)scaledValueForValue:(CGFloat)value {
-  UIContentSizeCategory defaultSizeCategory = UIContentSizeCategoryLarge;
   // If it is available, query the preferredContentSizeCategory.
-  UIContentSizeCategory currentSizeCategory = GetCurrentSizeCategory();
-
-  NSNumber *defaultFontSizeNumber = _scalingCurve[defaultSizeCategory];
-  NSNumber *currentFontSizeNumber = _scalingCurve[currentSizeCategory];
+  NSInteger currentOrdinal = MDCContentSizeCategoryOrdinal(GetCurrentSizeCategory());
 
-  // Guard against broken / incomplete scaling curves by returning self if fontSizeNumber is nil.
-  if (currentFontSizeNumber == nil || defaultFontSizeNumber == nil) {
+  // Guard against unknown size categories by returning the value unscaled.
+  if (currentOrdinal == NSNotFound) {
     return value;
   }
 
-  CGFloat currentFontSize = (CGFloat)currentFontSizeNumber.doubleValue;
-  CGFloat defaultFontSize = (CGFloat)defaultFontSizeNumber.doubleValue;
-
-  // Guard against broken / incomplete scaling curves by returning self if fontSize <= 0.0.
-  if (currentFontSize <= 0.0 || defaultFontSize <= 0.0) {
-    return value;
-  }
+  CGFloat currentFontSize = _scalingCurveSizes[currentOrdinal];
+  CGFloat defaultFontSize = _scalingCurveSizes[MDCContentSizeCategoryOrdinalLarge];
 
   return (currentFontSize / defaultFontSize) * value;
 }
@@ -13,6 +13,10 @@
 // limitations under the License.
 
 #import "MDCTypography.h"
+
+#include <stdatomic.h>
+
+#import "MaterialMath.h"
 #import "private/UIFont+MaterialTypographyPrivate.h"
 
 static id<MDCTypographyFontLoading> gFontLoader = nil;
@@ -184,11 +188,42 @@ const CGFloat MDCTypographySecondaryOpacity = (CGFloat)0.54;
 
 @end
 
-@interface MDCSystemFontLoader ()
+// The styles of font vended by MDCSystemFontLoader. Zero is reserved for empty cache slots.
+typedef NS_ENUM(uint32_t, MDCSystemFontLoaderStyle) {
+  MDCSystemFontLoaderStyleLight = 1,
+  MDCSystemFontLoaderStyleRegular,
+  MDCSystemFontLoaderStyleMedium,
+  MDCSystemFontLoaderStyleBold,
+  MDCSystemFontLoaderStyleItalic,
+  MDCSystemFontLoaderStyleBoldItalic,
+};
+
+// The number of fonts remembered by the main thread cache. Must be a power of two.
+#define MDCSystemFontLoaderMainThreadCacheSize 32
+
+// Packs a font style and a point size, in thousandths of a point, into one integer.
+static inline uint64_t FontCacheKey(MDCSystemFontLoaderStyle style, CGFloat fontSize) {
+  return ((uint64_t)style << 32) | (uint32_t)(int32_t)MDCRound(fontSize * 1000);
+}
+
+@interface MDCSystemFontLoader () {
+  // A small direct-mapped cache that is only read and written on the main thread, where nearly all
+  // fonts are requested, so that cache hits take no locks and allocate nothing.
+  uint64_t _mainThreadFontKeys[MDCSystemFontLoaderMainThreadCacheSize];
+  UIFont *_mainThreadFonts[MDCSystemFontLoaderMainThreadCacheSize];
+  NSUInteger _mainThreadFontsGeneration;
+
+  // Incremented when the content size category changes, so that the main thread cache is
+  // invalidated even if the notification is posted on another thread.
+  atomic_ulong _fontsGeneration;
+}
 
 /*
  In collectionView scrolling tests, manually caching UIFonts performs around 4.5 times better
  (e.g. 230 ms vs. 1,080 ms in one test) than calling [UIFont systemFontForSize:weight:] every time.
+
+ Fonts are keyed by the NSNumber of a FontCacheKey, which is a tagged pointer and does not
+ allocate.
  */
 @property(nonatomic, strong) NSCache *fontCache;
 
@@ -200,6 +235,7 @@ const CGFloat MDCTypographySecondaryOpacity = (CGFloat)0.54;
   self = [super init];
   if (self) {
     _fontCache = [[NSCache alloc] init];
+    atomic_init(&_fontsGeneration, 0);
     [[NSNotificationCenter defaultCenter] addObserver:self
                                              selector:@selector(didChangeContentSizeCategory)
                                                  name:UIContentSizeCategoryDidChangeNotification
@@ -210,11 +246,52 @@ const CGFloat MDCTypographySecondaryOpacity = (CGFloat)0.54;
 
 - (void)didChangeContentSizeCategory {
   [_fontCache removeAllObjects];
+  atomic_fetch_add_explicit(&_fontsGeneration, 1, memory_order_relaxed);
+}
+
+static inline NSUInteger MainThreadCacheSlot(uint64_t cacheKey) {
+  // Fibonacci hashing spreads neighbouring sizes of the same style across the slots.
+  return (NSUInteger)((cacheKey * 0x9E3779B97F4A7C15ull) >> 59) &
+         (MDCSystemFontLoaderMainThreadCacheSize - 1);
+}
+
+- (nullable UIFont *)cachedFontForKey:(uint64_t)cacheKey {
+  BOOL isMainThread = [NSThread isMainThread];
+  NSUInteger slot = MainThreadCacheSlot(cacheKey);
+  if (isMainThread) {
+    NSUInteger generation =
+        (NSUInteger)atomic_load_explicit(&_fontsGeneration, memory_order_relaxed);
+    if (generation != _mainThreadFontsGeneration) {
+      for (NSUInteger i = 0; i < MDCSystemFontLoaderMainThreadCacheSize; ++i) {
+        _mainThreadFontKeys[i] = 0;
+        _mainThreadFonts[i] = nil;
+      }
+      _mainThreadFontsGeneration = generation;
+    } else if (_mainThreadFontKeys[slot] == cacheKey) {
+      return _mainThreadFonts[slot];
+    }
+  }
+
+  UIFont *font = [self.fontCache objectForKey:@(cacheKey)];
+  if (font && isMainThread) {
+    _mainThreadFontKeys[slot] = cacheKey;
+    _mainThreadFonts[slot] = font;
+  }
+  return font;
+}
+
+- (void)cacheFont:(UIFont *)font forKey:(uint64_t)cacheKey {
+  [self.fontCache setObject:font forKey:@(cacheKey)];
+  if ([NSThread isMainThread]) {
+    NSUInteger slot = MainThreadCacheSlot(cacheKey);
+    _mainThreadFontKeys[slot] = cacheKey;
+    _mainThreadFonts[slot] = font;
+  }
 }
 
 - (nullable UIFont *)lightFontOfSize:(CGFloat)fontSize {
-  NSString *cacheKey = [NSString stringWithFormat:@"%@-%06f", NSStringFromSelector(_cmd), fontSize];
-  UIFont *font = [self.fontCache objectForKey:cacheKey];
+  uint64_t cacheKey = FontCacheKey(MDCSystemFontLoaderStyleLight, fontSize);
+  UIFont *font = [self cachedFontForKey:cacheKey];
   if (font) {
     return font;
   }
@@ -228,14 +305,14 @@ const CGFloat MDCTypographySecondaryOpacity = (CGFloat)0.54;
   }
 #pragma clang diagnostic pop
   if (font) {
-    [self.fontCache setObject:font forKey:cacheKey];
+    [self cacheFont:font forKey:cacheKey];
   }
   return font;
 }
 
 - (UIFont *)regularFontOfSize:(CGFloat)fontSize {
-  NSString *cacheKey = [NSString stringWithFormat:@"%@-%06f", NSStringFromSelector(_cmd), fontSize];
-  UIFont *font = [self.fontCache objectForKey:cacheKey];
+  uint64_t cacheKey = FontCacheKey(MDCSystemFontLoaderStyleRegular, fontSize);
+  UIFont *font = [self cachedFontForKey:cacheKey];
   if (font) {
     return font;
   }
@@ -249,14 +326,14 @@ const CGFloat MDCTypographySecondaryOpacity = (CGFloat)0.54;
   }
 #pragma clang diagnostic pop
 
-  [self.fontCache setObject:font forKey:cacheKey];
+  [self cacheFont:font forKey:cacheKey];
 
   return (UIFont *)font;
 }
 
 - (nullable UIFont *)mediumFontOfSize:(CGFloat)fontSize {
-  NSString *cacheKey = [NSString stringWithFormat:@"%@-%06f", NSStringFromSelector(_cmd), fontSize];
-  UIFont *font = [self.fontCache objectForKey:cacheKey];
+  uint64_t cacheKey = FontCacheKey(MDCSystemFontLoaderStyleMedium, fontSize);
+  UIFont *font = [self cachedFontForKey:cacheKey];
   if (font) {
     return font;
   }
@@ -271,14 +348,14 @@ const CGFloat MDCTypographySecondaryOpacity = (CGFloat)0.54;
 #pragma clang diagnostic pop
 
   if (font) {
-    [self.fontCache setObject:font forKey:cacheKey];
+    [self cacheFont:font forKey:cacheKey];
   }
   return font;
 }
 
 - (UIFont *)boldFontOfSize:(CGFloat)fontSize {
-  NSString *cacheKey = [NSString stringWithFormat:@"%@-%06f", NSStringFromSelector(_cmd), fontSize];
-  UIFont *font = [self.fontCache objectForKey:cacheKey];
+  uint64_t cacheKey = FontCacheKey(MDCSystemFontLoaderStyleBold, fontSize);
+  UIFont *font = [self cachedFontForKey:cacheKey];
   if (font) {
     return font;
   }
@@ -292,28 +369,28 @@ const CGFloat MDCTypographySecondaryOpacity = (CGFloat)0.54;
   }
 #pragma clang diagnostic pop
 
-  [self.fontCache setObject:font forKey:cacheKey];
+  [self cacheFont:font forKey:cacheKey];
 
   return font;
 }
 
 - (UIFont *)italicFontOfSize:(CGFloat)fontSize {
-  NSString *cacheKey = [NSString stringWithFormat:@"%@-%06f", NSStringFromSelector(_cmd), fontSize];
-  UIFont *font = [self.fontCache objectForKey:cacheKey];
+  uint64_t cacheKey = FontCacheKey(MDCSystemFontLoaderStyleItalic, fontSize);
+  UIFont *font = [self cachedFontForKey:cacheKey];
   if (font) {
     return font;
   }
 
   font = [UIFont italicSystemFontOfSize:fontSize];
 
-  [self.fontCache setObject:font forKey:cacheKey];
+  [self cacheFont:font forKey:cacheKey];
 
   return font;
 }
 
 - (nullable UIFont *)boldItalicFontOfSize:(CGFloat)fontSize {
-  NSString *cacheKey = [NSString stringWithFormat:@"%@-%06f", NSStringFromSelector(_cmd), fontSize];
-  UIFont *font = [self.fontCache objectForKey:cacheKey];
+  uint64_t cacheKey = FontCacheKey(MDCSystemFontLoaderStyleBoldItalic, fontSize);
+  UIFont *font = [self cachedFontForKey:cacheKey];
   if (font) {
     return font;
   }
@@ -327,7 +404,7 @@ const CGFloat MDCTypographySecondaryOpacity = (CGFloat)0.54;
   UIFontDescriptor *nonnullDescriptor = descriptor;
   font = [UIFont fontWithDescriptor:nonnullDescriptor size:fontSize];
 
-  [self.fontCache setObject:font forKey:cacheKey];
+  [self cacheFont:font forKey:cacheKey];
 
   return font;
 }
@@ -19,38 +19,57 @@
 #import "MaterialApplication.h"
 
 #import "MDCTypography.h"
+#import "private/MDCFontScaler+Private.h"
+#import "private/MDCScaledFontCache.h"
 #import "private/MDCTypographyUtilities.h"
+#import "private/UIFont+MaterialScalablePrivate.h"
 
 static char MDCFontScaleObjectKey;
 
 @implementation UIFont (MaterialScalable)
 
 - (UIFont *)mdc_scaledFontForSizeCategory:(UIContentSizeCategory)sizeCategory {
-  if (!self.mdc_scalingCurve) {
+  MDCScalingCurve scalingCurve = self.mdc_scalingCurve;
+  if (!scalingCurve) {
     return self;
   }
 
-  NSNumber *fontSizeNumber;
-  if (sizeCategory) {
-    fontSizeNumber = self.mdc_scalingCurve[sizeCategory];
+  CGFloat fontSize = 0;
+  const CGFloat *scalingCurveSizes = MDCFontScalerSizesForScalingCurve(scalingCurve);
+  NSInteger ordinal = MDCContentSizeCategoryOrdinal(sizeCategory);
+  if (scalingCurveSizes && ordinal != NSNotFound) {
+    // Curves attached by MDCFontScaler are read without hashing the size category.
+    fontSize = scalingCurveSizes[ordinal];
+  } else {
+    NSNumber *fontSizeNumber;
+    if (sizeCategory) {
+      fontSizeNumber = scalingCurve[sizeCategory];
+    }
+
+    // Guard against broken / incomplete scaling curves by returning self if fontSizeNumber is nil.
+    if (fontSizeNumber == nil) {
+      return self;
+    }
+
+    fontSize = (CGFloat)fontSizeNumber.doubleValue;
   }
 
-  // Guard against broken / incomplete scaling curves by returning self if fontSizeNumber is nil.
-  if (fontSizeNumber == nil) {
-    return self;
-  }
-
-  CGFloat fontSize = (CGFloat)fontSizeNumber.doubleValue;
-
   // Guard against broken scaling curves encoded with 0.0 or negative values
   if (fontSize <= 0.0) {
     return self;
   }
 
-  UIFont *scaledFont = [UIFont fontWithDescriptor:self.fontDescriptor size:fontSize];
-  scaledFont.mdc_scalingCurve = self.mdc_scalingCurve;
-
-  return scaledFont;
+  return [[MDCScaledFontCache sharedCache]
+      fontWithDescriptor:self.fontDescriptor
+            scalingCurve:scalingCurve
+            sizeCategory:sizeCategory
+               fontBlock:^UIFont * {
+                 UIFont *scaledFont = [UIFont fontWithDescriptor:self.fontDescriptor
+                                                            size:fontSize];
+                 // The curve was copied when it was attached to self, so it can be shared as is.
+                 MDCFontAttachImmutableScalingCurve(scaledFont, scalingCurve);
+                 return scaledFont;
+               }];
 }
 
 - (UIFont *)mdc_scaledFontForTraitEnvironment:(id<UITraitEnvironment>)traitEnvironment {
@@ -84,3 +103,8 @@ static char MDCFontScaleObjectKey;
 }
 
 @end
+
+void MDCFontAttachImmutableScalingCurve(UIFont *font, MDCScalingCurve scalingCurve) {
+  objc_setAssociatedObject(font, &MDCFontScaleObjectKey, scalingCurve,
+                           OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+}
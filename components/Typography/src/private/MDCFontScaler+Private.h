@@ -0,0 +1,27 @@
+// Copyright 2015-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <UIKit/UIKit.h>
+
+#import "UIFont+MaterialScalable.h"
+
+/**
+ Returns the font sizes behind @c scalingCurve if it is one of the curves attached by
+ MDCFontScaler, or NULL otherwise.
+
+ The returned array holds MDCContentSizeCategoryCount sizes indexed by
+ MDCContentSizeCategoryOrdinal() and lives for the lifetime of the process.
+ */
+FOUNDATION_EXTERN const CGFloat *_Nullable MDCFontScalerSizesForScalingCurve(
+    MDCScalingCurve _Nullable scalingCurve);
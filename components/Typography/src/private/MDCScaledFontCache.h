@@ -0,0 +1,69 @@
+// Copyright 2015-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <UIKit/UIKit.h>
+
+#import "UIFont+MaterialScalable.h"
+
+/**
+ A bounded cache of the fonts returned by the UIFont (MaterialScalable) scaling methods.
+
+ Fonts are keyed by the font descriptor they were scaled from, the identity of their scaling curve
+ and the content size category, so a Dynamic Type change creates each distinct scaled font once
+ instead of once per view.
+
+ MDCScaledFontCache is safe to use from any thread.
+ */
+@interface MDCScaledFontCache : NSObject
+
+/** The cache used by UIFont (MaterialScalable) and MDCFontScaler. */
++ (nonnull instancetype)sharedCache;
+
+/**
+ Creates a cache that holds at most @c countLimit fonts. Fonts are evicted once the limit is
+ reached and when the system is low on memory.
+ */
+- (nonnull instancetype)initWithCountLimit:(NSUInteger)countLimit NS_DESIGNATED_INITIALIZER;
+
+/** Creates a cache with a default count limit of 512 fonts. */
+- (nonnull instancetype)init;
+
+/** The number of lookups that returned a cached font. */
+@property(nonatomic, readonly) NSUInteger hitCount;
+
+/** The number of lookups that had to create a font. */
+@property(nonatomic, readonly) NSUInteger missCount;
+
+/**
+ Returns the cached font for the given key, or the result of @c fontBlock if there is none.
+
+ A cached font is only returned if its @c mdc_scalingCurve is still @c scalingCurve.
+
+ @param fontDescriptor The descriptor of the font being scaled.
+ @param scalingCurve The scaling curve attached to the font being scaled. Compared by identity.
+ @param sizeCategory The size category the font is scaled for.
+ @param fontBlock Creates the scaled font on a cache miss. Its result must carry @c scalingCurve.
+ */
+- (nonnull UIFont *)fontWithDescriptor:(nonnull UIFontDescriptor *)fontDescriptor
+                          scalingCurve:(nonnull MDCScalingCurve)scalingCurve
+                          sizeCategory:(nonnull UIContentSizeCategory)sizeCategory
+                             fontBlock:(UIFont *_Nonnull (^_Nonnull)(void))fontBlock;
+
+/** Removes every font from the cache. Does not reset the counters. */
+- (void)removeAllFonts;
+
+/** Resets @c hitCount and @c missCount to zero. */
+- (void)resetCounters;
+
+@end
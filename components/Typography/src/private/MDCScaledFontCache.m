@@ -0,0 +1,135 @@
+// Copyright 2015-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "MDCScaledFontCache.h"
+
+#include <stdatomic.h>
+
+static const NSUInteger kDefaultCountLimit = 512;
+
+@interface MDCScaledFontCacheKey : NSObject <NSCopying>
+@end
+
+@implementation MDCScaledFontCacheKey {
+  UIFontDescriptor *_fontDescriptor;
+  // Retained so that the address cannot be reused by another curve while the key is alive.
+  MDCScalingCurve _scalingCurve;
+  UIContentSizeCategory _sizeCategory;
+  NSUInteger _hash;
+}
+
+- (instancetype)initWithFontDescriptor:(UIFontDescriptor *)fontDescriptor
+                          scalingCurve:(MDCScalingCurve)scalingCurve
+                          sizeCategory:(UIContentSizeCategory)sizeCategory {
+  self = [super init];
+  if (self) {
+    _fontDescriptor = fontDescriptor;
+    _scalingCurve = scalingCurve;
+    _sizeCategory = sizeCategory;
+    _hash = fontDescriptor.hash ^ (NSUInteger)(__bridge void *)scalingCurve ^ sizeCategory.hash;
+  }
+  return self;
+}
+
+- (id)copyWithZone:(__unused NSZone *)zone {
+  return self;
+}
+
+- (NSUInteger)hash {
+  return _hash;
+}
+
+- (BOOL)isEqual:(id)object {
+  if (self == object) {
+    return YES;
+  }
+  if (![object isKindOfClass:[MDCScaledFontCacheKey class]]) {
+    return NO;
+  }
+  MDCScaledFontCacheKey *other = (MDCScaledFontCacheKey *)object;
+  return _hash == other->_hash && _scalingCurve == other->_scalingCurve &&
+         [_sizeCategory isEqualToString:other->_sizeCategory] &&
+         [_fontDescriptor isEqual:other->_fontDescriptor];
+}
+
+@end
+
+@implementation MDCScaledFontCache {
+  NSCache<MDCScaledFontCacheKey *, UIFont *> *_fonts;
+  atomic_ulong _hitCount;
+  atomic_ulong _missCount;
+}
+
++ (instancetype)sharedCache {
+  static MDCScaledFontCache *sharedCache;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    sharedCache = [[MDCScaledFontCache alloc] init];
+  });
+  return sharedCache;
+}
+
+- (instancetype)init {
+  return [self initWithCountLimit:kDefaultCountLimit];
+}
+
+- (instancetype)initWithCountLimit:(NSUInteger)countLimit {
+  self = [super init];
+  if (self) {
+    _fonts = [[NSCache alloc] init];
+    _fonts.countLimit = countLimit;
+    atomic_init(&_hitCount, 0);
+    atomic_init(&_missCount, 0);
+  }
+  return self;
+}
+
+- (NSUInteger)hitCount {
+  return (NSUInteger)atomic_load_explicit(&_hitCount, memory_order_relaxed);
+}
+
+- (NSUInteger)missCount {
+  return (NSUInteger)atomic_load_explicit(&_missCount, memory_order_relaxed);
+}
+
+- (UIFont *)fontWithDescriptor:(UIFontDescriptor *)fontDescriptor
+                  scalingCurve:(MDCScalingCurve)scalingCurve
+                  sizeCategory:(UIContentSizeCategory)sizeCategory
+                     fontBlock:(UIFont * (^)(void))fontBlock {
+  MDCScaledFontCacheKey *key = [[MDCScaledFontCacheKey alloc] initWithFontDescriptor:fontDescriptor
+                                                                        scalingCurve:scalingCurve
+                                                                        sizeCategory:sizeCategory];
+  UIFont *font = [_fonts objectForKey:key];
+  // UIKit may hand out the same font instance to unrelated callers, so a cached font may have had
+  // a different curve attached since it was cached.
+  if (font && font.mdc_scalingCurve == scalingCurve) {
+    atomic_fetch_add_explicit(&_hitCount, 1, memory_order_relaxed);
+    return font;
+  }
+  atomic_fetch_add_explicit(&_missCount, 1, memory_order_relaxed);
+  font = fontBlock();
+  [_fonts setObject:font forKey:key];
+  return font;
+}
+
+- (void)removeAllFonts {
+  [_fonts removeAllObjects];
+}
+
+- (void)resetCounters {
+  atomic_store_explicit(&_hitCount, 0, memory_order_relaxed);
+  atomic_store_explicit(&_missCount, 0, memory_order_relaxed);
+}
+
+@end
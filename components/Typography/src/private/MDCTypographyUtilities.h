@@ -15,3 +15,25 @@
 #import <UIKit/UIKit.h>
 
 UIContentSizeCategory GetCurrentSizeCategory(void);
+
+/**
+ The number of content size categories covered by a scaling curve, from
+ UIContentSizeCategoryExtraSmall through UIContentSizeCategoryAccessibilityExtraExtraExtraLarge.
+ */
+#define MDCContentSizeCategoryCount 12
+
+/** The ordinal of UIContentSizeCategoryLarge, the default content size category. */
+#define MDCContentSizeCategoryOrdinalLarge 3
+
+/**
+ @return The position of @c sizeCategory in the list of content size categories ordered from
+ smallest to largest, or NSNotFound if @c sizeCategory is nil or is not covered by scaling curves
+ (for example UIContentSizeCategoryUnspecified).
+ */
+NSInteger MDCContentSizeCategoryOrdinal(UIContentSizeCategory _Nullable sizeCategory);
+
+/**
+ @return The content size category at @c ordinal, which must be less than
+ MDCContentSizeCategoryCount.
+ */
+UIContentSizeCategory _Nonnull MDCContentSizeCategoryForOrdinal(NSInteger ordinal);
@@ -30,3 +30,50 @@ UIContentSizeCategory GetCurrentSizeCategory(void) {
 
   return sizeCategory;
 }
+
+// The UIKit constants live for the lifetime of the process, so they do not need to be retained.
+static __unsafe_unretained const UIContentSizeCategory *SizeCategoriesByOrdinal(void) {
+  static __unsafe_unretained UIContentSizeCategory sizeCategories[MDCContentSizeCategoryCount];
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    sizeCategories[0] = UIContentSizeCategoryExtraSmall;
+    sizeCategories[1] = UIContentSizeCategorySmall;
+    sizeCategories[2] = UIContentSizeCategoryMedium;
+    sizeCategories[3] = UIContentSizeCategoryLarge;
+    sizeCategories[4] = UIContentSizeCategoryExtraLarge;
+    sizeCategories[5] = UIContentSizeCategoryExtraExtraLarge;
+    sizeCategories[6] = UIContentSizeCategoryExtraExtraExtraLarge;
+    sizeCategories[7] = UIContentSizeCategoryAccessibilityMedium;
+    sizeCategories[8] = UIContentSizeCategoryAccessibilityLarge;
+    sizeCategories[9] = UIContentSizeCategoryAccessibilityExtraLarge;
+    sizeCategories[10] = UIContentSizeCategoryAccessibilityExtraExtraLarge;
+    sizeCategories[11] = UIContentSizeCategoryAccessibilityExtraExtraExtraLarge;
+  });
+  return sizeCategories;
+}
+
+NSInteger MDCContentSizeCategoryOrdinal(UIContentSizeCategory sizeCategory) {
+  if (!sizeCategory) {
+    return NSNotFound;
+  }
+  __unsafe_unretained const UIContentSizeCategory *sizeCategories = SizeCategoriesByOrdinal();
+  // UIKit hands out its constants, so a pointer comparison almost always finds the category
+  // without hashing or comparing any characters.
+  for (NSInteger ordinal = 0; ordinal < MDCContentSizeCategoryCount; ++ordinal) {
+    if (sizeCategory == sizeCategories[ordinal]) {
+      return ordinal;
+    }
+  }
+  for (NSInteger ordinal = 0; ordinal < MDCContentSizeCategoryCount; ++ordinal) {
+    if ([sizeCategory isEqualToString:sizeCategories[ordinal]]) {
+      return ordinal;
+    }
+  }
+  return NSNotFound;
+}
+
+UIContentSizeCategory MDCContentSizeCategoryForOrdinal(NSInteger ordinal) {
+  NSCAssert(ordinal >= 0 && ordinal < MDCContentSizeCategoryCount, @"Invalid ordinal %@",
+            @(ordinal));
+  return SizeCategoriesByOrdinal()[ordinal];
+}
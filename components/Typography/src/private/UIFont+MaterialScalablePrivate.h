@@ -0,0 +1,26 @@
+// Copyright 2026-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <UIKit/UIKit.h>
+
+#import "UIFont+MaterialScalable.h"
+
+/**
+ Attaches @c scalingCurve to @c font as its @c mdc_scalingCurve without copying it.
+
+ @c scalingCurve must be immutable, for example a curve read from another font's
+ @c mdc_scalingCurve.
+ */
+FOUNDATION_EXTERN void MDCFontAttachImmutableScalingCurve(UIFont *_Nonnull font,
+                                                          MDCScalingCurve _Nullable scalingCurve);
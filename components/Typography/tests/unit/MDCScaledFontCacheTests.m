@@ -0,0 +1,132 @@
+// Copyright 2015-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "MDCScaledFontCache.h"
+#import "MaterialTypography.h"
+
+@interface MDCScaledFontCacheTests : XCTestCase
+@end
+
+@implementation MDCScaledFontCacheTests
+
+- (void)testScalingTheSameFontTwiceReturnsTheCachedFont {
+  // Given
+  MDCFontScaler *scaler = [MDCFontScaler scalerForMaterialTextStyle:MDCTextStyleHeadline5];
+  UIFont *scalableFont = [scaler scaledFontWithFont:[UIFont systemFontOfSize:18.0]];
+  UIFont *firstScaledFont =
+      [scalableFont mdc_scaledFontForSizeCategory:UIContentSizeCategoryExtraExtraLarge];
+  MDCScaledFontCache *cache = [MDCScaledFontCache sharedCache];
+  NSUInteger hitCount = cache.hitCount;
+
+  // When
+  UIFont *secondScaledFont =
+      [scalableFont mdc_scaledFontForSizeCategory:UIContentSizeCategoryExtraExtraLarge];
+
+  // Then
+  XCTAssertEqual(secondScaledFont, firstScaledFont);
+  XCTAssertEqual(cache.hitCount, hitCount + 1);
+  XCTAssertEqualWithAccuracy(secondScaledFont.pointSize, 28, 0.0001);
+  XCTAssertEqual(secondScaledFont.mdc_scalingCurve, scalableFont.mdc_scalingCurve);
+}
+
+- (void)testFontsWithDifferentCurvesAreNotShared {
+  // Given
+  UIFont *font1 = [UIFont systemFontOfSize:18.0];
+  font1.mdc_scalingCurve = @{UIContentSizeCategoryLarge : @20};
+  UIFont *font2 = [UIFont fontWithDescriptor:font1.fontDescriptor size:18.0];
+  font2.mdc_scalingCurve = @{UIContentSizeCategoryLarge : @30};
+
+  // When
+  UIFont *scaledFont1 = [font1 mdc_scaledFontForSizeCategory:UIContentSizeCategoryLarge];
+  UIFont *scaledFont2 = [font2 mdc_scaledFontForSizeCategory:UIContentSizeCategoryLarge];
+
+  // Then
+  XCTAssertEqualWithAccuracy(scaledFont1.pointSize, 20, 0.0001);
+  XCTAssertEqualWithAccuracy(scaledFont2.pointSize, 30, 0.0001);
+}
+
+- (void)testCachedFontWhoseCurveWasReplacedIsNotReturned {
+  // Given
+  MDCScaledFontCache *cache = [[MDCScaledFontCache alloc] init];
+  UIFont *font = [UIFont systemFontOfSize:18.0];
+  MDCScalingCurve scalingCurve = @{UIContentSizeCategoryLarge : @18};
+  UIFont * (^fontBlock)(void) = ^UIFont * {
+    UIFont *scaledFont = [UIFont systemFontOfSize:18.0];
+    scaledFont.mdc_scalingCurve = scalingCurve;
+    return scaledFont;
+  };
+  UIFont *cachedFont = [cache fontWithDescriptor:font.fontDescriptor
+                                    scalingCurve:scalingCurve
+                                    sizeCategory:UIContentSizeCategoryLarge
+                                       fontBlock:fontBlock];
+  cachedFont.mdc_scalingCurve = @{UIContentSizeCategoryLarge : @40};
+
+  // When
+  [cache fontWithDescriptor:font.fontDescriptor
+               scalingCurve:scalingCurve
+               sizeCategory:UIContentSizeCategoryLarge
+                  fontBlock:fontBlock];
+
+  // Then
+  XCTAssertEqual(cache.missCount, 2U);
+  XCTAssertEqual(cache.hitCount, 0U);
+}
+
+#pragma mark - Performance
+
+// Rescales the fonts of a screenful of components, for each text style, through every content size
+// category, which is what an app does when the user changes their preferred text size.
+- (void)testPerformanceDynamicTypeChange {
+  NSArray<MDCTextStyle> *textStyles = @[
+    MDCTextStyleHeadline1, MDCTextStyleHeadline2, MDCTextStyleHeadline3, MDCTextStyleHeadline4,
+    MDCTextStyleHeadline5, MDCTextStyleHeadline6, MDCTextStyleSubtitle1, MDCTextStyleSubtitle2,
+    MDCTextStyleBody1, MDCTextStyleBody2, MDCTextStyleButton, MDCTextStyleCaption,
+    MDCTextStyleOverline
+  ];
+  NSArray<UIContentSizeCategory> *sizeCategories = @[
+    UIContentSizeCategoryExtraSmall,
+    UIContentSizeCategorySmall,
+    UIContentSizeCategoryMedium,
+    UIContentSizeCategoryLarge,
+    UIContentSizeCategoryExtraLarge,
+    UIContentSizeCategoryExtraExtraLarge,
+    UIContentSizeCategoryExtraExtraExtraLarge,
+    UIContentSizeCategoryAccessibilityMedium,
+    UIContentSizeCategoryAccessibilityLarge,
+    UIContentSizeCategoryAccessibilityExtraLarge,
+    UIContentSizeCategoryAccessibilityExtraExtraLarge,
+    UIContentSizeCategoryAccessibilityExtraExtraExtraLarge,
+  ];
+  NSMutableArray<UIFont *> *scalableFonts = [NSMutableArray array];
+  for (MDCTextStyle textStyle in textStyles) {
+    MDCFontScaler *scaler = [MDCFontScaler scalerForMaterialTextStyle:textStyle];
+    [scalableFonts addObject:[scaler scaledFontWithFont:[UIFont systemFontOfSize:16.0]]];
+    [scalableFonts addObject:[scaler scaledFontWithFont:[UIFont boldSystemFontOfSize:16.0]]];
+  }
+  const NSInteger componentsPerFont = 100;
+
+  [self measureBlock:^{
+    for (UIContentSizeCategory sizeCategory in sizeCategories) {
+      for (UIFont *scalableFont in scalableFonts) {
+        for (NSInteger i = 0; i < componentsPerFont; ++i) {
+          [scalableFont mdc_scaledFontForSizeCategory:sizeCategory];
+        }
+      }
+    }
+  }];
+}
+
+@end
@@ -18,6 +18,13 @@
 
 #import "MaterialMath.h"
 
+/** A subclass of MDCFontScaler, which must not be handed the shared scalers. */
+@interface MaterialScalableFontTestsFontScaler : MDCFontScaler
+@end
+
+@implementation MaterialScalableFontTestsFontScaler
+@end
+
 @interface UIFont_MaterialScalable : XCTestCase
 
 @end
@@ -304,4 +311,112 @@
 }
  */
 
+- (void)testScalerFactoryReturnsSharedInstancePerTextStyle {
+  // When
+  MDCFontScaler *scaler1 = [MDCFontScaler scalerForMaterialTextStyle:MDCTextStyleHeadline6];
+  MDCFontScaler *scaler2 = [MDCFontScaler scalerForMaterialTextStyle:MDCTextStyleHeadline6];
+  MDCFontScaler *scaler3 = [MDCFontScaler scalerForMaterialTextStyle:MDCTextStyleCaption];
+
+  // Then
+  XCTAssertEqual(scaler1, scaler2);
+  XCTAssertNotEqual(scaler1, scaler3);
+}
+
+- (void)testScalerFactoryDoesNotShareInstancesWithSubclasses {
+  // When
+  MDCFontScaler *sharedScaler = [MDCFontScaler scalerForMaterialTextStyle:MDCTextStyleHeadline6];
+  MDCFontScaler *scaler1 =
+      [MaterialScalableFontTestsFontScaler scalerForMaterialTextStyle:MDCTextStyleHeadline6];
+  MDCFontScaler *scaler2 =
+      [MaterialScalableFontTestsFontScaler scalerForMaterialTextStyle:MDCTextStyleHeadline6];
+
+  // Then
+  XCTAssertNotEqual(scaler1, sharedScaler);
+  XCTAssertNotEqual(scaler1, scaler2);
+  XCTAssertEqualWithAccuracy([scaler1 scaledValueForValue:20],
+                             [sharedScaler scaledValueForValue:20], 0.0001);
+}
+
+- (void)testScaledFontSizesMatchScalingCurve {
+  // Given
+  NSArray<MDCTextStyle> *textStyles = @[
+    MDCTextStyleHeadline1,
+    MDCTextStyleHeadline2,
+    MDCTextStyleHeadline3,
+    MDCTextStyleHeadline4,
+    MDCTextStyleHeadline5,
+    MDCTextStyleHeadline6,
+    MDCTextStyleSubtitle1,
+    MDCTextStyleSubtitle2,
+    MDCTextStyleBody1,
+    MDCTextStyleBody2,
+    MDCTextStyleButton,
+    MDCTextStyleCaption,
+    MDCTextStyleOverline,
+  ];
+
+  for (MDCTextStyle textStyle in textStyles) {
+    MDCFontScaler *scaler = [MDCFontScaler scalerForMaterialTextStyle:textStyle];
+    UIFont *scalableFont = [scaler scaledFontWithFont:[UIFont systemFontOfSize:18.0]];
+    MDCScalingCurve scalingCurve = scalableFont.mdc_scalingCurve;
+
+    // Then
+    XCTAssertEqual(scalingCurve.count, 12U);
+    for (UIContentSizeCategory sizeCategory in scalingCurve) {
+      // When
+      UIFont *scaledFont = [scalableFont mdc_scaledFontForSizeCategory:sizeCategory];
+
+      // Then
+      XCTAssertEqualWithAccuracy(scaledFont.pointSize,
+                                 (CGFloat)scalingCurve[sizeCategory].doubleValue, 0.0001);
+    }
+  }
+}
+
+- (void)testCopiedScalingCurveScalesLikeOriginal {
+  // Given
+  MDCFontScaler *scaler = [MDCFontScaler scalerForMaterialTextStyle:MDCTextStyleSubtitle1];
+  UIFont *scalableFont = [scaler scaledFontWithFont:[UIFont systemFontOfSize:18.0]];
+  UIFont *copiedCurveFont = [UIFont systemFontOfSize:18.0];
+  copiedCurveFont.mdc_scalingCurve = [scalableFont.mdc_scalingCurve mutableCopy];
+
+  // When
+  UIFont *scaledFont =
+      [scalableFont mdc_scaledFontForSizeCategory:UIContentSizeCategoryAccessibilityLarge];
+  UIFont *copiedCurveScaledFont =
+      [copiedCurveFont mdc_scaledFontForSizeCategory:UIContentSizeCategoryAccessibilityLarge];
+
+  // Then
+  XCTAssertEqualWithAccuracy(scaledFont.pointSize, 30, 0.0001);
+  XCTAssertEqualWithAccuracy(copiedCurveScaledFont.pointSize, 30, 0.0001);
+}
+
+- (void)testUnspecifiedSizeCategoryReturnsSelf {
+  if (@available(iOS 10.0, *)) {
+    // Given
+    MDCFontScaler *scaler = [MDCFontScaler scalerForMaterialTextStyle:MDCTextStyleBody1];
+    UIFont *scalableFont = [scaler scaledFontWithFont:[UIFont systemFontOfSize:18.0]];
+
+    // When
+    UIFont *scaledFont =
+        [scalableFont mdc_scaledFontForSizeCategory:UIContentSizeCategoryUnspecified];
+
+    // Then
+    XCTAssertEqual(scaledFont, scalableFont);
+  }
+}
+
+#pragma mark - Performance
+
+- (void)testPerformanceScaledValueForValue {
+  MDCFontScaler *scaler = [MDCFontScaler scalerForMaterialTextStyle:MDCTextStyleBody1];
+  [self measureBlock:^{
+    CGFloat total = 0;
+    for (NSInteger i = 0; i < 10000; ++i) {
+      total += [scaler scaledValueForValue:i];
+    }
+    XCTAssertGreaterThan(total, 0);
+  }];
+}
+
 @end
@@ -121,4 +121,53 @@
 #pragma clang diagnostic pop
 }
 
+- (void)testCachedFontsKeepTheirStyleAndSize {
+  // Given
+  MDCSystemFontLoader *fontLoader = [[MDCSystemFontLoader alloc] init];
+  UIFont *regularFont = [fontLoader regularFontOfSize:14];
+  UIFont *boldFont = [fontLoader boldFontOfSize:14];
+
+  // When
+  UIFont *cachedRegularFont = [fontLoader regularFontOfSize:14];
+  UIFont *cachedBoldFont = [fontLoader boldFontOfSize:14];
+  UIFont *largerRegularFont = [fontLoader regularFontOfSize:(CGFloat)14.5];
+
+  // Then
+  XCTAssertEqual(cachedRegularFont, regularFont);
+  XCTAssertEqual(cachedBoldFont, boldFont);
+  XCTAssertNotEqual(cachedRegularFont, cachedBoldFont);
+  XCTAssertEqualWithAccuracy(largerRegularFont.pointSize, 14.5, 0.001);
+}
+
+- (void)testContentSizeCategoryChangeKeepsReturningCorrectFonts {
+  // Given
+  MDCSystemFontLoader *fontLoader = [[MDCSystemFontLoader alloc] init];
+  [fontLoader mediumFontOfSize:20];
+
+  // When
+  [[NSNotificationCenter defaultCenter]
+      postNotificationName:UIContentSizeCategoryDidChangeNotification
+                    object:nil];
+  UIFont *font = [fontLoader mediumFontOfSize:20];
+
+  // Then
+  XCTAssertEqualWithAccuracy(font.pointSize, 20, 0.001);
+  XCTAssertEqual([fontLoader mediumFontOfSize:20], font);
+}
+
+#pragma mark - Performance
+
+// Configures the labels of a long list of cells, the way a scrolling collection view would.
+- (void)testPerformanceCellConfiguration {
+  MDCSystemFontLoader *fontLoader = [[MDCSystemFontLoader alloc] init];
+  [self measureBlock:^{
+    for (NSInteger cell = 0; cell < 10000; ++cell) {
+      [fontLoader mediumFontOfSize:16];   // Title
+      [fontLoader regularFontOfSize:14];  // Body
+      [fontLoader regularFontOfSize:12];  // Caption
+      [fontLoader mediumFontOfSize:14];   // Button
+    }
+  }];
+}
+
 @end
@@ -0,0 +1,70 @@
+// Copyright 2015-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <Foundation/Foundation.h>
+
+/**
+ The localized strings of one component's strings table, resolved once and kept in memory.
+
+ Components describe their strings with a generated C array of keys that is indexed by a string
+ ID. A table resolves every key against the component's resource bundle when it is first requested
+ and afterwards hands out strings by ID without going back to the bundle. Format strings, such as
+ accessibility templates, are returned already localized and ready to be passed to
+ +[NSString localizedStringWithFormat:].
+
+ Tables are shared process-wide and are safe to use from any thread.
+ */
+@interface MDCLocalizedStringTable : NSObject
+
+/**
+ Returns the shared table named @c tableName, creating and resolving it on first use.
+
+ Later calls with the same table name return the same table and ignore the remaining arguments.
+
+ @param tableName The name of the .strings table in @c bundle, for example @"MaterialPageControl".
+ @param bundle The component's resource bundle. If nil, every string resolves to its key.
+ @param keys The keys of the table, indexed by string ID.
+ @param count The number of keys.
+ */
++ (nonnull instancetype)tableNamed:(nonnull NSString *)tableName
+                          inBundle:(nullable NSBundle *)bundle
+                              keys:(NSString *const _Nonnull *_Nonnull)keys
+                             count:(NSUInteger)count;
+
+/**
+ The time in seconds each table took to resolve its strings, keyed by table name.
+
+ Only tables that have been created are included.
+ */
++ (nonnull NSDictionary<NSString *, NSNumber *> *)loadDurations;
+
+- (nonnull instancetype)init NS_UNAVAILABLE;
+
+/** The name of the .strings table. */
+@property(nonatomic, readonly, copy, nonnull) NSString *tableName;
+
+/** The number of strings in the table. */
+@property(nonatomic, readonly) NSUInteger count;
+
+/** The time in seconds it took to resolve the table's strings. */
+@property(nonatomic, readonly) NSTimeInterval loadDuration;
+
+/**
+ Returns the localized string for @c stringID, or its key if the bundle has no translation.
+
+ @c stringID must be smaller than @c count.
+ */
+- (nonnull NSString *)stringForID:(NSUInteger)stringID;
+
+@end
@@ -0,0 +1,85 @@
+// Copyright 2015-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "MDCLocalizedStringTable.h"
+
+@implementation MDCLocalizedStringTable {
+  NSArray<NSString *> *_strings;
+}
+
++ (NSMutableDictionary<NSString *, MDCLocalizedStringTable *> *)sharedTables {
+  static NSMutableDictionary<NSString *, MDCLocalizedStringTable *> *sharedTables;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    sharedTables = [NSMutableDictionary dictionary];
+  });
+  return sharedTables;
+}
+
++ (instancetype)tableNamed:(NSString *)tableName
+                  inBundle:(NSBundle *)bundle
+                      keys:(NSString *const *)keys
+                     count:(NSUInteger)count {
+  NSMutableDictionary<NSString *, MDCLocalizedStringTable *> *sharedTables = [self sharedTables];
+  @synchronized(sharedTables) {
+    MDCLocalizedStringTable *table = sharedTables[tableName];
+    if (!table) {
+      table = [[self alloc] initWithTableName:tableName inBundle:bundle keys:keys count:count];
+      sharedTables[table.tableName] = table;
+    }
+    return table;
+  }
+}
+
++ (NSDictionary<NSString *, NSNumber *> *)loadDurations {
+  NSMutableDictionary<NSString *, MDCLocalizedStringTable *> *sharedTables = [self sharedTables];
+  NSMutableDictionary<NSString *, NSNumber *> *loadDurations = [NSMutableDictionary dictionary];
+  @synchronized(sharedTables) {
+    for (NSString *tableName in sharedTables) {
+      loadDurations[tableName] = @(sharedTables[tableName].loadDuration);
+    }
+  }
+  return [loadDurations copy];
+}
+
+- (instancetype)initWithTableName:(NSString *)tableName
+                         inBundle:(NSBundle *)bundle
+                             keys:(NSString *const *)keys
+                            count:(NSUInteger)count {
+  self = [super init];
+  if (self) {
+    _tableName = [tableName copy];
+    CFAbsoluteTime startTime = CFAbsoluteTimeGetCurrent();
+    NSMutableArray<NSString *> *strings = [NSMutableArray arrayWithCapacity:count];
+    for (NSUInteger i = 0; i < count; ++i) {
+      NSString *string = [bundle localizedStringForKey:keys[i] value:nil table:_tableName];
+      [strings addObject:string ?: keys[i]];
+    }
+    _strings = [strings copy];
+    _loadDuration = CFAbsoluteTimeGetCurrent() - startTime;
+  }
+  return self;
+}
+
+- (NSUInteger)count {
+  return _strings.count;
+}
+
+- (NSString *)stringForID:(NSUInteger)stringID {
+  NSAssert(stringID < _strings.count, @"String ID %@ is out of range for table %@.",
+           @(stringID), _tableName);
+  return _strings[stringID];
+}
+
+@end
@@ -0,0 +1,90 @@
+// Copyright 2015-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "MaterialLocalizedStrings.h"
+
+static NSString *const kTestTableKeys[] = {
+    @"MDCLocalizedStringTableTestsFirstKey",
+    @"MDCLocalizedStringTableTestsSecondKey",
+};
+
+@interface MDCLocalizedStringTableTests : XCTestCase
+@end
+
+@implementation MDCLocalizedStringTableTests
+
+- (void)testMissingStringsResolveToTheirKeys {
+  // When
+  MDCLocalizedStringTable *table =
+      [MDCLocalizedStringTable tableNamed:@"MDCLocalizedStringTableTestsMissing"
+                                 inBundle:[NSBundle bundleForClass:[self class]]
+                                     keys:kTestTableKeys
+                                    count:2];
+
+  // Then
+  XCTAssertEqual(table.count, 2U);
+  XCTAssertEqualObjects([table stringForID:0], kTestTableKeys[0]);
+  XCTAssertEqualObjects([table stringForID:1], kTestTableKeys[1]);
+}
+
+- (void)testNilBundleResolvesToKeys {
+  // When
+  MDCLocalizedStringTable *table =
+      [MDCLocalizedStringTable tableNamed:@"MDCLocalizedStringTableTestsNilBundle"
+                                 inBundle:nil
+                                     keys:kTestTableKeys
+                                    count:2];
+
+  // Then
+  XCTAssertEqualObjects([table stringForID:1], kTestTableKeys[1]);
+}
+
+- (void)testTablesAreSharedByName {
+  // Given
+  NSString *tableName = @"MDCLocalizedStringTableTestsShared";
+  MDCLocalizedStringTable *table = [MDCLocalizedStringTable tableNamed:tableName
+                                                              inBundle:nil
+                                                                  keys:kTestTableKeys
+                                                                 count:2];
+
+  // When
+  MDCLocalizedStringTable *otherTable = [MDCLocalizedStringTable tableNamed:tableName
+                                                                   inBundle:nil
+                                                                       keys:kTestTableKeys
+                                                                      count:1];
+
+  // Then
+  XCTAssertEqual(table, otherTable);
+  XCTAssertEqual(otherTable.count, 2U);
+}
+
+- (void)testLoadDurationsAreReportedPerTable {
+  // Given
+  NSString *tableName = @"MDCLocalizedStringTableTestsLoadDuration";
+
+  // When
+  MDCLocalizedStringTable *table = [MDCLocalizedStringTable tableNamed:tableName
+                                                              inBundle:nil
+                                                                  keys:kTestTableKeys
+                                                                 count:2];
+
+  // Then
+  XCTAssertGreaterThanOrEqual(table.loadDuration, 0);
+  XCTAssertEqualObjects([MDCLocalizedStringTable loadDurations][tableName],
+                        @(table.loadDuration));
+}
+
+@end
@@ -0,0 +1,68 @@
+// Copyright 2026-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <CoreGraphics/CoreGraphics.h>
+#import <Foundation/Foundation.h>
+
+/**
+ A process-wide, size-bounded cache of circle paths.
+
+ Circles are cached by center and radius, both rounded to the nearest device pixel, and scale, so
+ all layers of the same size that show the same circle share one path.
+
+ MDCOvalPathCache is safe to use from any thread.
+ */
+@interface MDCOvalPathCache : NSObject
+
+/** The cache shared by the ink and ripple layers. */
++ (nonnull instancetype)sharedCache;
+
+/**
+ Creates a cache that holds at most @c countLimit circles. Circles are evicted once the limit is
+ reached and when the system is low on memory.
+ */
+- (nonnull instancetype)initWithCountLimit:(NSUInteger)countLimit NS_DESIGNATED_INITIALIZER;
+
+/** Creates a cache with a default count limit of 64 circles. */
+- (nonnull instancetype)init;
+
+/** The maximum number of circles held by the cache. */
+@property(nonatomic, readonly) NSUInteger countLimit;
+
+/** The number of lookups that reused a cached circle. */
+@property(nonatomic, readonly) NSUInteger hitCount;
+
+/** The number of lookups that had to generate a new circle. */
+@property(nonatomic, readonly) NSUInteger missCount;
+
+/**
+ Returns a circle path.
+
+ @param center The center of the circle. It is rounded to the nearest pixel at @c scale.
+ @param radius The radius of the circle. It is rounded to the nearest pixel at @c scale.
+ @param scale The scale of the screen the path is drawn on. A scale that is not positive is
+     treated as 1.
+ @return An immutable path that is not owned by the caller.
+ */
+- (nonnull CGPathRef)circlePathWithCenter:(CGPoint)center
+                                   radius:(CGFloat)radius
+                                    scale:(CGFloat)scale;
+
+/** Removes every circle from the cache. Does not reset the counters. */
+- (void)removeAllPaths;
+
+/** Resets @c hitCount and @c missCount to zero. */
+- (void)resetCounters;
+
+@end
@@ -0,0 +1,137 @@
+// Copyright 2026-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "MDCOvalPathCache.h"
+
+#include <stdatomic.h>
+
+#import "MaterialMath.h"
+
+static const NSUInteger kDefaultCountLimit = 64;
+
+/** A circle's center and radius in whole pixels, and its scale in hundredths. */
+typedef struct {
+  int32_t centerX;
+  int32_t centerY;
+  int32_t radius;
+  int32_t scale;
+} MDCOvalPathCacheKeyValue;
+
+/** Identifies a cached circle. */
+@interface MDCOvalPathCacheKey : NSObject {
+ @public
+  MDCOvalPathCacheKeyValue _value;
+}
+@end
+
+@implementation MDCOvalPathCacheKey
+
+- (NSUInteger)hash {
+  NSUInteger hash = (NSUInteger)_value.centerX;
+  hash = hash * 31 + (NSUInteger)_value.centerY;
+  hash = hash * 31 + (NSUInteger)_value.radius;
+  return hash * 31 + (NSUInteger)_value.scale;
+}
+
+- (BOOL)isEqual:(id)object {
+  if (self == object) {
+    return YES;
+  }
+  if (![object isKindOfClass:[MDCOvalPathCacheKey class]]) {
+    return NO;
+  }
+  MDCOvalPathCacheKeyValue other = ((MDCOvalPathCacheKey *)object)->_value;
+  return _value.centerX == other.centerX && _value.centerY == other.centerY &&
+         _value.radius == other.radius && _value.scale == other.scale;
+}
+
+@end
+
+@implementation MDCOvalPathCache {
+  NSCache<MDCOvalPathCacheKey *, id> *_paths;
+  atomic_ulong _hitCount;
+  atomic_ulong _missCount;
+}
+
++ (instancetype)sharedCache {
+  static MDCOvalPathCache *sharedCache;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    sharedCache = [[MDCOvalPathCache alloc] init];
+  });
+  return sharedCache;
+}
+
+- (instancetype)init {
+  return [self initWithCountLimit:kDefaultCountLimit];
+}
+
+- (instancetype)initWithCountLimit:(NSUInteger)countLimit {
+  self = [super init];
+  if (self) {
+    _countLimit = countLimit;
+    _paths = [[NSCache alloc] init];
+    _paths.countLimit = countLimit;
+    atomic_init(&_hitCount, 0);
+    atomic_init(&_missCount, 0);
+  }
+  return self;
+}
+
+- (NSUInteger)hitCount {
+  return (NSUInteger)atomic_load_explicit(&_hitCount, memory_order_relaxed);
+}
+
+- (NSUInteger)missCount {
+  return (NSUInteger)atomic_load_explicit(&_missCount, memory_order_relaxed);
+}
+
+- (CGPathRef)circlePathWithCenter:(CGPoint)center radius:(CGFloat)radius scale:(CGFloat)scale {
+  if (scale <= 0) {
+    scale = 1;
+  }
+  // Whole pixels and the scale together determine the circle in points.
+  MDCOvalPathCacheKey *key = [[MDCOvalPathCacheKey alloc] init];
+  key->_value.centerX = (int32_t)MDCRound(center.x * scale);
+  key->_value.centerY = (int32_t)MDCRound(center.y * scale);
+  key->_value.radius = (int32_t)MAX(MDCRound(radius * scale), 0);
+  key->_value.scale = (int32_t)MDCRound(scale * 100);
+
+  id circle = [_paths objectForKey:key];
+  if (circle) {
+    atomic_fetch_add_explicit(&_hitCount, 1, memory_order_relaxed);
+  } else {
+    atomic_fetch_add_explicit(&_missCount, 1, memory_order_relaxed);
+    CGFloat quantizedRadius = key->_value.radius / scale;
+    CGRect ovalRect = CGRectMake(key->_value.centerX / scale - quantizedRadius,
+                                 key->_value.centerY / scale - quantizedRadius,
+                                 quantizedRadius * 2, quantizedRadius * 2);
+    circle = CFBridgingRelease(CGPathCreateWithEllipseInRect(ovalRect, NULL));
+    [_paths setObject:circle forKey:key];
+  }
+
+  // The cache may evict the path at any time, so keep it alive until the caller is done with it.
+  return (CGPathRef)CFAutorelease(CFBridgingRetain(circle));
+}
+
+- (void)removeAllPaths {
+  [_paths removeAllObjects];
+}
+
+- (void)resetCounters {
+  atomic_store_explicit(&_hitCount, 0, memory_order_relaxed);
+  atomic_store_explicit(&_missCount, 0, memory_order_relaxed);
+}
+
+@end
@@ -0,0 +1,107 @@
+// Copyright 2026-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "MDCOvalPathCache.h"
+
+@interface MDCOvalPathCacheTests : XCTestCase
+@end
+
+@implementation MDCOvalPathCacheTests
+
+- (void)testCirclePathIsCenteredOnTheCenter {
+  // Given
+  MDCOvalPathCache *cache = [[MDCOvalPathCache alloc] init];
+
+  // When
+  CGPathRef path = [cache circlePathWithCenter:CGPointMake(30, 10) radius:20 scale:2];
+
+  // Then
+  CGPathRef expectedPath = CGPathCreateWithEllipseInRect(CGRectMake(10, -10, 40, 40), NULL);
+  XCTAssertTrue(CGPathEqualToPath(path, expectedPath));
+  CGPathRelease(expectedPath);
+}
+
+- (void)testCirclesOfTheSameSizeShareOnePath {
+  // Given
+  MDCOvalPathCache *cache = [[MDCOvalPathCache alloc] init];
+
+  // When
+  CGPathRef firstPath = [cache circlePathWithCenter:CGPointMake(30, 30) radius:20 scale:2];
+  CGPathRef secondPath = [cache circlePathWithCenter:CGPointMake(30, 30) radius:20 scale:2];
+
+  // Then
+  XCTAssertEqual(cache.missCount, 1U);
+  XCTAssertEqual(cache.hitCount, 1U);
+  XCTAssertEqual(firstPath, secondPath);
+}
+
+- (void)testRadiusIsRoundedToThePixelGrid {
+  // Given
+  MDCOvalPathCache *cache = [[MDCOvalPathCache alloc] init];
+
+  // When
+  [cache circlePathWithCenter:CGPointMake((CGFloat)30.1, 30) radius:(CGFloat)20.1 scale:2];
+  CGPathRef path = [cache circlePathWithCenter:CGPointMake((CGFloat)29.9, 30)
+                                        radius:(CGFloat)19.9
+                                         scale:2];
+
+  // Then
+  XCTAssertEqual(cache.missCount, 1U);
+  XCTAssertEqual(cache.hitCount, 1U);
+  XCTAssertTrue(CGRectEqualToRect(CGPathGetBoundingBox(path), CGRectMake(10, 10, 40, 40)));
+}
+
+- (void)testSubPixelCentersAreCachedSeparately {
+  // Given
+  MDCOvalPathCache *cache = [[MDCOvalPathCache alloc] init];
+
+  // When
+  [cache circlePathWithCenter:CGPointMake(30, 30) radius:20 scale:2];
+  [cache circlePathWithCenter:CGPointMake((CGFloat)30.5, 30) radius:20 scale:2];
+
+  // Then
+  XCTAssertEqual(cache.missCount, 2U);
+  XCTAssertEqual(cache.hitCount, 0U);
+}
+
+- (void)testDifferentScalesAreCachedSeparately {
+  // Given
+  MDCOvalPathCache *cache = [[MDCOvalPathCache alloc] init];
+
+  // When
+  [cache circlePathWithCenter:CGPointMake(30, 30) radius:20 scale:2];
+  [cache circlePathWithCenter:CGPointMake(30, 30) radius:20 scale:3];
+
+  // Then
+  XCTAssertEqual(cache.missCount, 2U);
+  XCTAssertEqual(cache.hitCount, 0U);
+}
+
+- (void)testResetCounters {
+  // Given
+  MDCOvalPathCache *cache = [[MDCOvalPathCache alloc] init];
+  [cache circlePathWithCenter:CGPointMake(30, 30) radius:20 scale:2];
+  [cache circlePathWithCenter:CGPointMake(30, 30) radius:20 scale:2];
+
+  // When
+  [cache resetCounters];
+
+  // Then
+  XCTAssertEqual(cache.missCount, 0U);
+  XCTAssertEqual(cache.hitCount, 0U);
+}
+
+@end
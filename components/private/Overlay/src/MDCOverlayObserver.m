@@ -17,6 +17,7 @@
 #import <CoreFoundation/CoreFoundation.h>
 #import <CoreGraphics/CoreGraphics.h>
 #import <UIKit/UIKit.h>
+#import <objc/runtime.h>
 
 #import "MDCOverlayImplementor.h"
 #import "private/MDCOverlayAnimationObserver.h"
@@ -31,11 +32,60 @@
 #define MDC_UNUSED_IN_RELEASE
 #endif
 
+/** The signature of an action registered with -addTarget:action:. */
+typedef void (*MDCOverlayObserverActionIMP)(id, SEL, MDCOverlayObserverTransition *);
+
+/**
+ A registered action along with the implementation it resolved to, so that transitions can call
+ targets directly instead of going through NSInvocation.
+ */
+@interface MDCOverlayObserverAction : NSObject {
+ @public
+  SEL _action;
+  /** The class the implementation was looked up on. */
+  Class _targetClass;
+  MDCOverlayObserverActionIMP _implementation;
+}
+@end
+
+@implementation MDCOverlayObserverAction
+
+- (void)invokeWithTarget:(id)target transition:(MDCOverlayObserverTransition *)transition {
+  // Look the implementation up again if the target's class has changed since registration, for
+  // example because it started being key-value observed.
+  Class targetClass = object_getClass(target);
+  if (targetClass != _targetClass) {
+    _targetClass = targetClass;
+    _implementation = (MDCOverlayObserverActionIMP)[target methodForSelector:_action];
+  }
+  _implementation(target, _action, transition);
+}
+
+@end
+
+/** Orders overlays by identifier. */
+static NSComparisonResult MDCOverlayObserverCompareOverlays(MDCOverlayObserverOverlay *first,
+                                                            MDCOverlayObserverOverlay *second) {
+  return [first.identifier compare:second.identifier];
+}
+
 @interface MDCOverlayObserver () <MDCOverlayAnimationObserverDelegate>
 
 /** The list of overlays currently known to this observer. */
 @property(nonatomic) NSMutableDictionary *overlays;
 
+/** The values of @c overlays ordered by identifier, kept up to date on insertion and removal. */
+@property(nonatomic) NSMutableArray<MDCOverlayObserverOverlay *> *orderedOverlays;
+
+/** An immutable copy of @c orderedOverlays, or nil if an overlay was added or removed since. */
+@property(nonatomic) NSArray<MDCOverlayObserverOverlay *> *sortedOverlaysSnapshot;
+
+/**
+ The identifiers and frames of the overlays as of the last transition, used to skip transitions
+ whose changes cancelled each other out within one run loop turn.
+ */
+@property(nonatomic) NSDictionary<NSString *, NSValue *> *transitionedFrames;
+
 /** The currently-pending transition. */
 @property(nonatomic) MDCOverlayObserverTransition *pendingTransition;
 
@@ -68,6 +118,8 @@ static MDCOverlayObserver *_sOverlayObserver;
   self = [super init];
   if (self != nil) {
     _overlays = [NSMutableDictionary dictionary];
+    _orderedOverlays = [NSMutableArray array];
+    _transitionedFrames = @{};
     _observer = [[MDCOverlayAnimationObserver alloc] init];
     _observer.delegate = self;
 
@@ -99,30 +151,74 @@ static MDCOverlayObserver *_sOverlayObserver;
   return self.overlays[identifier];
 }
 
+- (NSUInteger)orderedIndexOfOverlay:(MDCOverlayObserverOverlay *)overlay
+                             options:(NSBinarySearchingOptions)options {
+  return [self.orderedOverlays indexOfObject:overlay
+                               inSortedRange:NSMakeRange(0, self.orderedOverlays.count)
+                                     options:options
+                             usingComparator:^NSComparisonResult(id first, id second) {
+                               return MDCOverlayObserverCompareOverlays(first, second);
+                             }];
+}
+
 - (MDCOverlayObserverOverlay *)buildOverlayWithIdentifier:(NSString *)identifier {
   MDCOverlayObserverOverlay *overlay = self.overlays[identifier];
   if (overlay == nil) {
     overlay = [[MDCOverlayObserverOverlay alloc] init];
     overlay.identifier = identifier;
     self.overlays[identifier] = overlay;
+
+    NSUInteger index = [self orderedIndexOfOverlay:overlay
+                                           options:NSBinarySearchingInsertionIndex];
+    [self.orderedOverlays insertObject:overlay atIndex:index];
+    self.sortedOverlaysSnapshot = nil;
   }
 
   return overlay;
 }
 
 - (void)removeOverlayWithIdentifier:(NSString *)identifier {
+  MDCOverlayObserverOverlay *overlay = self.overlays[identifier];
+  if (overlay == nil) {
+    return;
+  }
   [self.overlays removeObjectForKey:identifier];
+
+  NSUInteger index = [self orderedIndexOfOverlay:overlay options:NSBinarySearchingFirstEqual];
+  if (index != NSNotFound) {
+    [self.orderedOverlays removeObjectAtIndex:index];
+  }
+  self.sortedOverlaysSnapshot = nil;
 }
 
 - (NSArray *)sortedOverlays {
-  NSArray *sortedKeys = [[self.overlays allKeys] sortedArrayUsingSelector:@selector(compare:)];
+  if (self.sortedOverlaysSnapshot == nil) {
+    self.sortedOverlaysSnapshot = [self.orderedOverlays copy];
+  }
+  return self.sortedOverlaysSnapshot;
+}
 
-  NSMutableArray *result = [NSMutableArray array];
-  for (NSString *key in sortedKeys) {
-    [result addObject:self.overlays[key]];
+/** Returns whether any overlay was added, removed or moved since the last transition. */
+- (BOOL)overlaysChangedSinceLastTransition {
+  if (self.orderedOverlays.count != self.transitionedFrames.count) {
+    return YES;
   }
+  for (MDCOverlayObserverOverlay *overlay in self.orderedOverlays) {
+    NSValue *frame = self.transitionedFrames[overlay.identifier];
+    if (frame == nil || !CGRectEqualToRect(frame.CGRectValue, overlay.frame)) {
+      return YES;
+    }
+  }
+  return NO;
+}
 
-  return result;
+- (void)recordTransitionedFrames {
+  NSMutableDictionary<NSString *, NSValue *> *frames =
+      [NSMutableDictionary dictionaryWithCapacity:self.orderedOverlays.count];
+  for (MDCOverlayObserverOverlay *overlay in self.orderedOverlays) {
+    frames[overlay.identifier] = [NSValue valueWithCGRect:overlay.frame];
+  }
+  self.transitionedFrames = frames;
 }
 
 #pragma mark - Input Sources
@@ -192,55 +288,39 @@ static MDCOverlayObserver *_sOverlayObserver;
 
 #pragma mark - Target/Action
 
-- (NSInvocation *)buildInvocationForTarget:(id)target action:(SEL)action {
-  NSMethodSignature *signature = [target methodSignatureForSelector:action];
-  NSInvocation *invocation = [NSInvocation invocationWithMethodSignature:signature];
-  [invocation setTarget:target];
-  [invocation setSelector:action];
-
-  return invocation;
-}
+- (NSUInteger)indexOfActionForTarget:(id)target action:(SEL)action {
+  NSMutableArray<MDCOverlayObserverAction *> *actions = [self.actionTable objectForKey:target];
 
-- (void)invokeTarget:(NSInvocation *)invocation
-      withTransition:(MDCOverlayObserverTransition *)transition {
-  NSParameterAssert(invocation != nil);
-  NSParameterAssert(transition != nil);
-
-  [invocation setArgument:&transition atIndex:2];
-  [invocation invoke];
-}
-
-- (NSUInteger)indexOfInvocationForTarget:(id)target action:(SEL)action {
-  NSMutableArray *invocations = [self.actionTable objectForKey:target];
-
-  if (invocations == nil) {
+  if (actions == nil) {
     return NSNotFound;
   }
 
-  return [invocations indexOfObjectPassingTest:^BOOL(NSInvocation *invocation,
-                                                     __unused NSUInteger idx, __unused BOOL *stop) {
-    return invocation.selector == action;
+  return [actions indexOfObjectPassingTest:^BOOL(MDCOverlayObserverAction *registeredAction,
+                                                 __unused NSUInteger idx, __unused BOOL *stop) {
+    return registeredAction->_action == action;
   }];
 }
 
 - (void)addTarget:(id)target action:(SEL)action {
   NSParameterAssert(target != nil);
 
-  NSUInteger foundIndex = [self indexOfInvocationForTarget:target action:action];
+  NSUInteger foundIndex = [self indexOfActionForTarget:target action:action];
   if (foundIndex != NSNotFound) {
     return;
   }
 
-  NSInvocation *invocation = [self buildInvocationForTarget:target action:action];
-  NSParameterAssert(invocation != nil);
+  NSAssert([target respondsToSelector:action], @"%@ does not respond to %@", target,
+           NSStringFromSelector(action));
+  MDCOverlayObserverAction *registeredAction = [[MDCOverlayObserverAction alloc] init];
+  registeredAction->_action = action;
 
-  NSMutableArray *invocations = [self.actionTable objectForKey:target];
-  if (invocations == nil) {
-    invocations = [NSMutableArray array];
-    [self.actionTable setObject:invocations forKey:target];
+  NSMutableArray<MDCOverlayObserverAction *> *actions = [self.actionTable objectForKey:target];
+  if (actions == nil) {
+    actions = [NSMutableArray array];
+    [self.actionTable setObject:actions forKey:target];
   }
 
-  [invocations addObject:invocation];
+  [actions addObject:registeredAction];
 
   if (self.overlays.count > 0) {
     // If there's already a pending transition, let the runloop take care of it, otherwise create
@@ -250,7 +330,7 @@ static MDCOverlayObserver *_sOverlayObserver;
       MDCOverlayObserverTransition *transition = [[MDCOverlayObserverTransition alloc] init];
       transition.overlays = [self sortedOverlays];
 
-      [self invokeTarget:invocation withTransition:transition];
+      [registeredAction invokeWithTarget:target transition:transition];
 
       // Run the (non-animated) transition.
       [transition runAnimation];
@@ -267,17 +347,17 @@ static MDCOverlayObserver *_sOverlayObserver;
 - (void)removeTarget:(id)target action:(SEL)action {
   NSParameterAssert(target != nil);
 
-  NSUInteger foundIndex = [self indexOfInvocationForTarget:target action:action];
+  NSUInteger foundIndex = [self indexOfActionForTarget:target action:action];
 
   if (foundIndex != NSNotFound) {
-    NSMutableArray *invocations = [self.actionTable objectForKey:target];
+    NSMutableArray<MDCOverlayObserverAction *> *actions = [self.actionTable objectForKey:target];
 
-    if (invocations.count == 1) {
-      // Clean up all the invocations if this was the only one.
+    if (actions.count == 1) {
+      // Clean up all the actions if this was the only one.
       [self removeTarget:target];
     } else {
-      // Otherwise remove this single invocation.
-      [invocations removeObjectAtIndex:foundIndex];
+      // Otherwise remove this single action.
+      [actions removeObjectAtIndex:foundIndex];
     }
   }
 }
@@ -289,21 +369,31 @@ static MDCOverlayObserver *_sOverlayObserver;
     return;
   }
 
-  // Update the transition with the latest set of overlays.
-  self.pendingTransition.overlays = [self sortedOverlays];
+  MDCOverlayObserverTransition *transition = self.pendingTransition;
+  self.pendingTransition = nil;
+
+  // Several notifications may have arrived since the transition was created. If they left every
+  // overlay where it was at the last transition, there is nothing to report.
+  if (![self overlaysChangedSinceLastTransition]) {
+    return;
+  }
+  [self recordTransitionedFrames];
 
-  // Call all of our targets and let them know a transition has happened.
-  for (id target in self.actionTable) {
-    NSArray *invocations = [self.actionTable objectForKey:target];
-    for (NSInvocation *invocation in invocations) {
-      [self invokeTarget:invocation withTransition:self.pendingTransition];
+  // Update the transition with the latest set of overlays.
+  transition.overlays = [self sortedOverlays];
+
+  // Call all of our targets and let them know a transition has happened. Targets may add or remove
+  // actions in response, so work from a snapshot of the table.
+  NSMapTable *actionTable = [self.actionTable copy];
+  for (id target in actionTable) {
+    NSArray<MDCOverlayObserverAction *> *actions = [[actionTable objectForKey:target] copy];
+    for (MDCOverlayObserverAction *action in actions) {
+      [action invokeWithTarget:target transition:transition];
     }
   }
 
   // Actually run the transition animation.
-  [self.pendingTransition runAnimation];
-
-  self.pendingTransition = nil;
+  [transition runAnimation];
 }
 
 - (void)animationObserverDidEndRunloop:(__unused MDCOverlayAnimationObserver *)observer {
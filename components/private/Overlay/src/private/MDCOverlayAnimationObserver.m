@@ -98,8 +98,10 @@ static void runloopObserverCallback(__unused CFRunLoopObserverRef observer,
 }
 
 - (void)handleObserverFired {
-  [self.delegate animationObserverDidEndRunloop:self];
+  // Reset before messaging the delegate so that changes it triggers are reported on the next turn
+  // instead of being dropped.
   _primed = NO;
+  [self.delegate animationObserverDidEndRunloop:self];
 }
 
 @end
@@ -0,0 +1,136 @@
+// Copyright 2015-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#import <XCTest/XCTest.h>
+
+#import "MaterialOverlay.h"
+
+/** Records the transitions reported by an MDCOverlayObserver. */
+@interface MDCOverlayObserverTestsTarget : NSObject
+@property(nonatomic) NSInteger transitionCount;
+@property(nonatomic, copy) NSArray<NSString *> *overlayIdentifiers;
+@end
+
+@implementation MDCOverlayObserverTestsTarget
+
+- (void)handleTransition:(id<MDCOverlayTransitioning>)transition {
+  self.transitionCount += 1;
+  NSMutableArray<NSString *> *identifiers = [NSMutableArray array];
+  [transition enumerateOverlays:^(id<MDCOverlay> overlay, __unused NSUInteger idx,
+                                  __unused BOOL *stop) {
+    [identifiers addObject:overlay.identifier];
+  }];
+  self.overlayIdentifiers = identifiers;
+}
+
+@end
+
+@interface MDCOverlayObserverTests : XCTestCase
+@property(nonatomic, strong) MDCOverlayObserver *observer;
+@property(nonatomic, strong) MDCOverlayObserverTestsTarget *target;
+@end
+
+@implementation MDCOverlayObserverTests
+
+- (void)setUp {
+  [super setUp];
+
+  self.observer = [[MDCOverlayObserver alloc] init];
+  self.target = [[MDCOverlayObserverTestsTarget alloc] init];
+  [self.observer addTarget:self.target action:@selector(handleTransition:)];
+}
+
+- (void)tearDown {
+  [self.observer removeTarget:self.target];
+  self.target = nil;
+  self.observer = nil;
+
+  [super tearDown];
+}
+
+- (void)postOverlay:(NSString *)identifier frame:(CGRect)frame immediately:(BOOL)immediately {
+  NSMutableDictionary *userInfo = [@{MDCOverlayIdentifierKey : identifier} mutableCopy];
+  if (!CGRectIsEmpty(frame)) {
+    userInfo[MDCOverlayFrameKey] = [NSValue valueWithCGRect:frame];
+  }
+  if (immediately) {
+    userInfo[MDCOverlayTransitionDurationKey] = @0;
+    userInfo[MDCOverlayTransitionImmediacyKey] = @YES;
+  }
+  [[NSNotificationCenter defaultCenter] postNotificationName:MDCOverlayDidChangeNotification
+                                                      object:nil
+                                                    userInfo:userInfo];
+}
+
+/** Lets the main run loop finish its current turn so that deferred transitions fire. */
+- (void)finishRunLoopTurn {
+  XCTestExpectation *expectation = [self expectationWithDescription:@"run loop turn"];
+  dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(0.05 * NSEC_PER_SEC)),
+                 dispatch_get_main_queue(), ^{
+                   [expectation fulfill];
+                 });
+  [self waitForExpectationsWithTimeout:1 handler:nil];
+}
+
+- (void)testOverlaysAreReportedInIdentifierOrder {
+  // When
+  [self postOverlay:@"c" frame:CGRectMake(0, 0, 10, 10) immediately:NO];
+  [self postOverlay:@"a" frame:CGRectMake(0, 10, 10, 10) immediately:NO];
+  [self postOverlay:@"b" frame:CGRectMake(0, 20, 10, 10) immediately:YES];
+
+  // Then
+  XCTAssertEqual(self.target.transitionCount, 1);
+  XCTAssertEqualObjects(self.target.overlayIdentifiers, (@[ @"a", @"b", @"c" ]));
+
+  // When
+  [self postOverlay:@"b" frame:CGRectNull immediately:YES];
+
+  // Then
+  XCTAssertEqual(self.target.transitionCount, 2);
+  XCTAssertEqualObjects(self.target.overlayIdentifiers, (@[ @"a", @"c" ]));
+}
+
+- (void)testChangesInOneRunLoopTurnAreCoalesced {
+  // When
+  [self postOverlay:@"a" frame:CGRectMake(0, 0, 10, 10) immediately:NO];
+  [self postOverlay:@"a" frame:CGRectMake(0, 0, 10, 20) immediately:NO];
+  [self postOverlay:@"b" frame:CGRectMake(0, 20, 10, 10) immediately:NO];
+  [self finishRunLoopTurn];
+
+  // Then
+  XCTAssertEqual(self.target.transitionCount, 1);
+  XCTAssertEqualObjects(self.target.overlayIdentifiers, (@[ @"a", @"b" ]));
+}
+
+- (void)testChangesThatCancelOutDoNotTransition {
+  // When
+  [self postOverlay:@"a" frame:CGRectMake(0, 0, 10, 10) immediately:NO];
+  [self postOverlay:@"a" frame:CGRectNull immediately:NO];
+  [self finishRunLoopTurn];
+
+  // Then
+  XCTAssertEqual(self.target.transitionCount, 0);
+}
+
+- (void)testRemovedTargetIsNotCalled {
+  // Given
+  [self.observer removeTarget:self.target action:@selector(handleTransition:)];
+
+  // When
+  [self postOverlay:@"a" frame:CGRectMake(0, 0, 10, 10) immediately:YES];
+
+  // Then
+  XCTAssertEqual(self.target.transitionCount, 0);
+}
+
+@end
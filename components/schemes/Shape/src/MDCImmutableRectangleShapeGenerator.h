@@ -0,0 +1,62 @@
+// Copyright 2015-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#import <Foundation/Foundation.h>
+#import "MaterialShapes.h"
+
+@class MDCShapeCategory;
+
+/**
+ An MDCRectangleShapeGenerator whose corners are taken from an MDCShapeCategory and can not be
+ changed afterwards.
+
+ Instances are interned: every shape category with equal corners maps to the same generator, so
+ theming many components with the same category shares one generator between all of them. Paths
+ are stored in +[MDCShapePathCache sharedCache], so generators that compare equal share a single
+ path per size.
+
+ Setting any of the treatments, offsets or the path cache raises an assertion and is ignored. To
+ change the shape of a single component, assign it a -copy, which is a mutable
+ MDCRectangleShapeGenerator, or turn off @c sharesGeneratorsBetweenComponents before theming.
+ */
+@interface MDCImmutableRectangleShapeGenerator : MDCRectangleShapeGenerator
+
+/**
+ Returns the shared generator for the corners of @c shapeCategory. Edges are left straight.
+
+ Generators are held weakly, so a new one is created once no component uses the previous one.
+ */
++ (nonnull instancetype)shapeGeneratorForShapeCategory:(nonnull MDCShapeCategory *)shapeCategory;
+
+/**
+ A copy of the shape category this generator was created from.
+ */
+@property(nonatomic, readonly, copy, nonnull) MDCShapeCategory *shapeCategory;
+
+/**
+ Whether shape themers give every component the shared generator. When NO, they give each
+ component its own mutable copy, which can be changed after theming.
+
+ Defaults to YES.
+ */
+@property(class, nonatomic, assign) BOOL sharesGeneratorsBetweenComponents;
+
+/**
+ The generator a shape themer should assign to a component: the receiver if
+ @c sharesGeneratorsBetweenComponents is YES, otherwise a mutable copy of it.
+ */
+- (nonnull MDCRectangleShapeGenerator *)shapeGeneratorForComponent;
+
+- (nonnull instancetype)init NS_UNAVAILABLE;
+
+@end
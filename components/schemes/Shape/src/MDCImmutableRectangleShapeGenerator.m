@@ -0,0 +1,188 @@
+// Copyright 2015-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#import "MDCImmutableRectangleShapeGenerator.h"
+
+#import "MDCShapeCategory.h"
+
+static BOOL gSharesGeneratorsBetweenComponents = YES;
+
+@implementation MDCImmutableRectangleShapeGenerator {
+  BOOL _immutable;
+  MDCShapeCategory *_shapeCategory;
+}
+
++ (instancetype)shapeGeneratorForShapeCategory:(MDCShapeCategory *)shapeCategory {
+  static NSMapTable<MDCShapeCategory *, MDCImmutableRectangleShapeGenerator *> *internTable;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    internTable = [NSMapTable strongToWeakObjectsMapTable];
+  });
+
+  @synchronized(internTable) {
+    MDCImmutableRectangleShapeGenerator *generator = [internTable objectForKey:shapeCategory];
+    if (!generator) {
+      generator = [[self alloc] initWithShapeCategory:shapeCategory];
+      // Key by the generator's own copy so that later changes to the caller's category can not
+      // corrupt the table.
+      [internTable setObject:generator forKey:generator->_shapeCategory];
+    }
+    return generator;
+  }
+}
+
+- (instancetype)initWithShapeCategory:(MDCShapeCategory *)shapeCategory {
+  self = [super init];
+  if (self) {
+    _shapeCategory = [shapeCategory copy];
+    // The category's getters return its own instances, so copy them to stop later changes to the
+    // treatments from reaching this generator.
+    [super setTopLeftCorner:[_shapeCategory.topLeftCorner copy]];
+    [super setTopRightCorner:[_shapeCategory.topRightCorner copy]];
+    [super setBottomLeftCorner:[_shapeCategory.bottomLeftCorner copy]];
+    [super setBottomRightCorner:[_shapeCategory.bottomRightCorner copy]];
+    [super setPathCache:[MDCShapePathCache sharedCache]];
+    _immutable = YES;
+  }
+  return self;
+}
+
+- (MDCShapeCategory *)shapeCategory {
+  return [_shapeCategory copy];
+}
+
++ (BOOL)sharesGeneratorsBetweenComponents {
+  return gSharesGeneratorsBetweenComponents;
+}
+
++ (void)setSharesGeneratorsBetweenComponents:(BOOL)sharesGeneratorsBetweenComponents {
+  gSharesGeneratorsBetweenComponents = sharesGeneratorsBetweenComponents;
+}
+
+- (MDCRectangleShapeGenerator *)shapeGeneratorForComponent {
+  return gSharesGeneratorsBetweenComponents ? self : [self copy];
+}
+
+- (id)copyWithZone:(NSZone *)zone {
+  MDCRectangleShapeGenerator *copy = [[MDCRectangleShapeGenerator alloc] init];
+
+  copy.topLeftCorner = [self.topLeftCorner copyWithZone:zone];
+  copy.topRightCorner = [self.topRightCorner copyWithZone:zone];
+  copy.bottomRightCorner = [self.bottomRightCorner copyWithZone:zone];
+  copy.bottomLeftCorner = [self.bottomLeftCorner copyWithZone:zone];
+
+  copy.topLeftCornerOffset = self.topLeftCornerOffset;
+  copy.topRightCornerOffset = self.topRightCornerOffset;
+  copy.bottomRightCornerOffset = self.bottomRightCornerOffset;
+  copy.bottomLeftCornerOffset = self.bottomLeftCornerOffset;
+
+  copy.topEdge = [self.topEdge copyWithZone:zone];
+  copy.rightEdge = [self.rightEdge copyWithZone:zone];
+  copy.bottomEdge = [self.bottomEdge copyWithZone:zone];
+  copy.leftEdge = [self.leftEdge copyWithZone:zone];
+
+  // Paths in the shared cache are keyed by the treatments, so the copy can keep using it after it
+  // is changed.
+  copy.pathCache = self.pathCache;
+
+  return copy;
+}
+
+#pragma mark - Mutation
+
+// Only the initializer may configure the generator.
+- (BOOL)allowsMutation {
+  NSAssert(!_immutable, @"%@ can not be modified after it has been created.",
+           NSStringFromClass([self class]));
+  return !_immutable;
+}
+
+- (void)setTopLeftCorner:(MDCCornerTreatment *)topLeftCorner {
+  if ([self allowsMutation]) {
+    [super setTopLeftCorner:topLeftCorner];
+  }
+}
+
+- (void)setTopRightCorner:(MDCCornerTreatment *)topRightCorner {
+  if ([self allowsMutation]) {
+    [super setTopRightCorner:topRightCorner];
+  }
+}
+
+- (void)setBottomLeftCorner:(MDCCornerTreatment *)bottomLeftCorner {
+  if ([self allowsMutation]) {
+    [super setBottomLeftCorner:bottomLeftCorner];
+  }
+}
+
+- (void)setBottomRightCorner:(MDCCornerTreatment *)bottomRightCorner {
+  if ([self allowsMutation]) {
+    [super setBottomRightCorner:bottomRightCorner];
+  }
+}
+
+- (void)setTopLeftCornerOffset:(CGPoint)topLeftCornerOffset {
+  if ([self allowsMutation]) {
+    [super setTopLeftCornerOffset:topLeftCornerOffset];
+  }
+}
+
+- (void)setTopRightCornerOffset:(CGPoint)topRightCornerOffset {
+  if ([self allowsMutation]) {
+    [super setTopRightCornerOffset:topRightCornerOffset];
+  }
+}
+
+- (void)setBottomLeftCornerOffset:(CGPoint)bottomLeftCornerOffset {
+  if ([self allowsMutation]) {
+    [super setBottomLeftCornerOffset:bottomLeftCornerOffset];
+  }
+}
+
+- (void)setBottomRightCornerOffset:(CGPoint)bottomRightCornerOffset {
+  if ([self allowsMutation]) {
+    [super setBottomRightCornerOffset:bottomRightCornerOffset];
+  }
+}
+
+- (void)setTopEdge:(MDCEdgeTreatment *)topEdge {
+  if ([self allowsMutation]) {
+    [super setTopEdge:topEdge];
+  }
+}
+
+- (void)setRightEdge:(MDCEdgeTreatment *)rightEdge {
+  if ([self allowsMutation]) {
+    [super setRightEdge:rightEdge];
+  }
+}
+
+- (void)setBottomEdge:(MDCEdgeTreatment *)bottomEdge {
+  if ([self allowsMutation]) {
+    [super setBottomEdge:bottomEdge];
+  }
+}
+
+- (void)setLeftEdge:(MDCEdgeTreatment *)leftEdge {
+  if ([self allowsMutation]) {
+    [super setLeftEdge:leftEdge];
+  }
+}
+
+- (void)setPathCache:(MDCShapePathCache *)pathCache {
+  if ([self allowsMutation]) {
+    [super setPathCache:pathCache];
+  }
+}
+
+@end
@@ -12,5 +12,6 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#import "MDCImmutableRectangleShapeGenerator.h"
 #import "MDCShapeCategory.h"
 #import "MDCShapeScheme.h"
@@ -0,0 +1,162 @@
+// Copyright 2015-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#import <XCTest/XCTest.h>
+
+#import "MaterialShapeLibrary.h"
+#import "MaterialShapeScheme.h"
+
+@interface MDCImmutableRectangleShapeGeneratorTests : XCTestCase
+@end
+
+@implementation MDCImmutableRectangleShapeGeneratorTests
+
+- (void)tearDown {
+  MDCImmutableRectangleShapeGenerator.sharesGeneratorsBetweenComponents = YES;
+
+  [super tearDown];
+}
+
+- (void)testEqualShapeCategoriesShareAGenerator {
+  // Given
+  MDCShapeCategory *first = [[MDCShapeCategory alloc] initCornersWithFamily:MDCShapeCornerFamilyCut
+                                                                    andSize:6];
+  MDCShapeCategory *second = [[MDCShapeCategory alloc] initCornersWithFamily:MDCShapeCornerFamilyCut
+                                                                     andSize:6];
+
+  // When
+  MDCImmutableRectangleShapeGenerator *firstGenerator =
+      [MDCImmutableRectangleShapeGenerator shapeGeneratorForShapeCategory:first];
+  MDCImmutableRectangleShapeGenerator *secondGenerator =
+      [MDCImmutableRectangleShapeGenerator shapeGeneratorForShapeCategory:second];
+
+  // Then
+  XCTAssertEqual(firstGenerator, secondGenerator);
+  XCTAssertEqualObjects(firstGenerator.shapeCategory, first);
+  XCTAssertEqualObjects(firstGenerator.topLeftCorner, first.topLeftCorner);
+}
+
+- (void)testDifferentShapeCategoriesGetDifferentGenerators {
+  // Given
+  MDCShapeCategory *cut = [[MDCShapeCategory alloc] initCornersWithFamily:MDCShapeCornerFamilyCut
+                                                                  andSize:6];
+  MDCShapeCategory *rounded =
+      [[MDCShapeCategory alloc] initCornersWithFamily:MDCShapeCornerFamilyRounded andSize:6];
+
+  // When
+  MDCImmutableRectangleShapeGenerator *cutGenerator =
+      [MDCImmutableRectangleShapeGenerator shapeGeneratorForShapeCategory:cut];
+  MDCImmutableRectangleShapeGenerator *roundedGenerator =
+      [MDCImmutableRectangleShapeGenerator shapeGeneratorForShapeCategory:rounded];
+
+  // Then
+  XCTAssertNotEqual(cutGenerator, roundedGenerator);
+}
+
+- (void)testChangingTheShapeCategoryDoesNotChangeTheGenerator {
+  // Given
+  MDCShapeCategory *shapeCategory =
+      [[MDCShapeCategory alloc] initCornersWithFamily:MDCShapeCornerFamilyRounded andSize:4];
+  MDCImmutableRectangleShapeGenerator *generator =
+      [MDCImmutableRectangleShapeGenerator shapeGeneratorForShapeCategory:shapeCategory];
+
+  // When
+  shapeCategory.topLeftCorner = [MDCCornerTreatment cornerWithCut:10];
+
+  // Then
+  XCTAssertEqualObjects(generator.topLeftCorner, [MDCCornerTreatment cornerWithRadius:4]);
+  XCTAssertNotEqual([MDCImmutableRectangleShapeGenerator
+                        shapeGeneratorForShapeCategory:shapeCategory],
+                    generator);
+}
+
+- (void)testSharedGeneratorReturnsTheSamePathForEachSize {
+  // Given
+  MDCShapeCategory *shapeCategory =
+      [[MDCShapeCategory alloc] initCornersWithFamily:MDCShapeCornerFamilyRounded andSize:8];
+  MDCImmutableRectangleShapeGenerator *generator =
+      [MDCImmutableRectangleShapeGenerator shapeGeneratorForShapeCategory:shapeCategory];
+
+  // When
+  CGPathRef firstPath = [generator pathForSize:CGSizeMake(120, 36)];
+  CGPathRef secondPath = [generator pathForSize:CGSizeMake(120, 36)];
+
+  // Then
+  XCTAssertTrue(firstPath != NULL);
+  XCTAssertEqual(firstPath, secondPath);
+}
+
+- (void)testCopiedShapeCategoriesShareTheGenerator {
+  // Given
+  MDCShapeScheme *shapeScheme = [[MDCShapeScheme alloc] init];
+
+  // When
+  MDCImmutableRectangleShapeGenerator *first = [MDCImmutableRectangleShapeGenerator
+      shapeGeneratorForShapeCategory:shapeScheme.smallComponentShape];
+  MDCImmutableRectangleShapeGenerator *second = [MDCImmutableRectangleShapeGenerator
+      shapeGeneratorForShapeCategory:[shapeScheme.smallComponentShape copy]];
+
+  // Then
+  XCTAssertEqual(first, second);
+}
+
+- (void)testCopyIsAMutableGeneratorWithTheSameShape {
+  // Given
+  MDCShapeCategory *shapeCategory =
+      [[MDCShapeCategory alloc] initCornersWithFamily:MDCShapeCornerFamilyRounded andSize:4];
+  MDCImmutableRectangleShapeGenerator *generator =
+      [MDCImmutableRectangleShapeGenerator shapeGeneratorForShapeCategory:shapeCategory];
+
+  // When
+  MDCRectangleShapeGenerator *copy = [generator copy];
+  copy.topLeftCorner = [MDCCornerTreatment cornerWithCut:10];
+
+  // Then
+  XCTAssertEqual([copy class], [MDCRectangleShapeGenerator class]);
+  XCTAssertEqualObjects(copy.topLeftCorner, [MDCCornerTreatment cornerWithCut:10]);
+  XCTAssertEqualObjects(copy.bottomRightCorner, generator.bottomRightCorner);
+  XCTAssertEqualObjects(generator.topLeftCorner, [MDCCornerTreatment cornerWithRadius:4]);
+}
+
+- (void)testShapeGeneratorForComponentIsSharedByDefault {
+  // Given
+  MDCShapeCategory *shapeCategory =
+      [[MDCShapeCategory alloc] initCornersWithFamily:MDCShapeCornerFamilyRounded andSize:4];
+  MDCImmutableRectangleShapeGenerator *generator =
+      [MDCImmutableRectangleShapeGenerator shapeGeneratorForShapeCategory:shapeCategory];
+
+  // When
+  MDCRectangleShapeGenerator *componentGenerator = [generator shapeGeneratorForComponent];
+
+  // Then
+  XCTAssertEqual(componentGenerator, generator);
+}
+
+- (void)testShapeGeneratorForComponentIsAMutableCopyWhenSharingIsOff {
+  // Given
+  MDCShapeCategory *shapeCategory =
+      [[MDCShapeCategory alloc] initCornersWithFamily:MDCShapeCornerFamilyRounded andSize:4];
+  MDCImmutableRectangleShapeGenerator *generator =
+      [MDCImmutableRectangleShapeGenerator shapeGeneratorForShapeCategory:shapeCategory];
+  MDCImmutableRectangleShapeGenerator.sharesGeneratorsBetweenComponents = NO;
+
+  // When
+  MDCRectangleShapeGenerator *componentGenerator = [generator shapeGeneratorForComponent];
+
+  // Then
+  XCTAssertNotEqual(componentGenerator, generator);
+  XCTAssertEqual([componentGenerator class], [MDCRectangleShapeGenerator class]);
+  XCTAssertEqualObjects(componentGenerator.topLeftCorner, generator.topLeftCorner);
+}
+
+@end